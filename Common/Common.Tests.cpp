@@ -0,0 +1,207 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "Clock.hpp"
+#include "GameState.hpp"
+#include "Profiler.hpp"
+#include "Scene.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <thread>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace x;
+
+static bool approxEqual(const glm::mat4& a, const glm::mat4& b) {
+    for (i32 c = 0; c < 4; c++) {
+        for (i32 r = 0; r < 4; r++) {
+            if (std::abs(a[c][r] - b[c][r]) > 1e-4f) { return false; }
+        }
+    }
+    return true;
+}
+
+TEST_CASE("Scene - Binary save and load round trip", "[Common]") {
+    static const str path      = "SceneRoundTrip.xscene";
+    static const str wholePath = "SceneRoundTripWhole.xscene";
+
+    const auto rootWorld   = Math::AffineTransform::fromTRS({100, 0, 0}, {}, {1, 1, 1});
+    const auto firstWorld  = Math::AffineTransform::fromTRS({1, 2, 3}, {0, 90, 0}, {1, 1, 1});
+    const auto secondWorld = Math::AffineTransform::fromTRS({-4, 0, 8}, {}, {2, 2, 2});
+    const auto nestedWorld = Math::AffineTransform::fromTRS({1, 7, 3}, {0, 90, 0}, {1, 1, 1});
+
+    GameState state;
+    Scene scene("RoundTrip", state);
+    const auto root   = scene.createEntity();
+    const auto first  = scene.createEntity(root);
+    const auto second = scene.createEntity(root);
+    const auto nested = scene.createEntity(first);
+    scene.setWorldTransform(root, rootWorld.toMat4());
+    scene.setWorldTransform(first, firstWorld.toMat4());
+    scene.setWorldTransform(second, secondWorld.toMat4());
+    scene.setWorldTransform(nested, nestedWorld.toMat4());
+    state.addComponent<TransformComponent>(nested).setPosition({1, 7, 3});
+
+    // Both subtrees are saved as roots, placed by their world transforms
+    const EntityId roots[] = {first, second};
+    REQUIRE(scene.saveToFile(path, roots));
+
+    GameState loadedState;
+    Scene loaded("Loaded", loadedState);
+    REQUIRE(loaded.loadFromFile(path));
+    const auto loadedRoots = loaded.getChildren(loaded.getRoot());
+    REQUIRE(loadedRoots.size() == 2);
+    REQUIRE(approxEqual(loaded.getWorldTransform(loadedRoots[0]), firstWorld.toMat4()));
+    REQUIRE(approxEqual(loaded.getWorldTransform(loadedRoots[1]), secondWorld.toMat4()));
+    REQUIRE(loaded.getChildren(loadedRoots[1]).empty());
+
+    const auto loadedNested = loaded.getChildren(loadedRoots[0]);
+    REQUIRE(loadedNested.size() == 1);
+    REQUIRE(approxEqual(loaded.getWorldTransform(loadedNested[0]), nestedWorld.toMat4()));
+    REQUIRE(loadedState.getComponent<TransformComponent>(loadedNested[0]) != nullptr);
+    REQUIRE(loadedState.getComponent<TransformComponent>(loadedRoots[0]) == nullptr);
+
+    // A whole scene is a single tree, so its root stays the root rather than gaining a parent
+    REQUIRE(loaded.saveToFile(wholePath));
+    GameState reloadedState;
+    Scene reloaded("Reloaded", reloadedState);
+    REQUIRE(reloaded.loadFromFile(wholePath));
+    const auto reloadedRoots = reloaded.getChildren(reloaded.getRoot());
+    REQUIRE(reloadedRoots.size() == 2);
+    REQUIRE(reloaded.getChildren(reloadedRoots[0]).size() == 1);
+    REQUIRE(approxEqual(reloaded.getWorldTransform(reloaded.getChildren(reloadedRoots[0])[0]),
+                        nestedWorld.toMat4()));
+
+    std::remove(path.c_str());
+    std::remove(wholePath.c_str());
+}
+
+/// Events the named thread has in a capture
+static const std::vector<ProfileEvent>* findThread(const ProfileCapture& capture,
+                                                   const char* name) {
+    for (const auto& thread : capture.threads) {
+        if (thread.name == name) { return &thread.events; }
+    }
+    return nullptr;
+}
+
+TEST_CASE("Profiler - Full rings keep the newest events", "[Common]") {
+    constexpr u32 kExtra = 100;
+    std::thread([] {
+        Profiler::setThreadName("WrapTest");
+        for (u32 i = 0; i < Profiler::kEventCapacity + kExtra; i++) {
+            Profiler::counter("Value", CAST<f64>(i));
+        }
+    }).join();
+
+    const auto capture = Profiler::instance().capture();
+    const auto* events = findThread(capture, "WrapTest");
+    REQUIRE(events != nullptr);
+    REQUIRE(events->size() == Profiler::kEventCapacity);
+    for (u32 i = 0; i < events->size(); i++) {
+        REQUIRE((*events)[i].getValue() == CAST<f64>(kExtra + i));
+    }
+}
+
+TEST_CASE("Profiler - Captures drop events lapped while copying", "[Common]") {
+    std::atomic<bool> stop {false};
+    std::atomic<bool> named {false};
+    std::thread writer([&] {
+        Profiler::setThreadName("LapTest");
+        named.store(true);
+        for (u64 i = 0; !stop.load(std::memory_order_relaxed); i++) {
+            Profiler::counter("Value", CAST<f64>(i));
+        }
+    });
+    while (!named.load()) {
+        std::this_thread::yield();
+    }
+
+    // Whatever survives a capture must be a run of consecutive, intact events
+    for (u32 c = 0; c < 20; c++) {
+        const auto capture = Profiler::instance().capture();
+        const auto* events = findThread(capture, "LapTest");
+        REQUIRE(events != nullptr);
+        REQUIRE(events->size() <= Profiler::kEventCapacity);
+        for (size_t i = 1; i < events->size(); i++) {
+            REQUIRE((*events)[i].getValue() == (*events)[i - 1].getValue() + 1.0);
+            REQUIRE(std::strcmp((*events)[i].name, "Value") == 0);
+        }
+    }
+    stop.store(true);
+    writer.join();
+}
+
+TEST_CASE("Profiler - Trace export", "[Common]") {
+    std::thread([] {
+        Profiler::setThreadName("TraceTest");
+        Profiler::frame("Frame");
+        {
+            Profiler::Scope outer("Outer");
+            Profiler::Scope inner("Inner");
+        }
+        Profiler::counter("Count", 42.0);
+    }).join();
+
+    ProfileCapture capture = Profiler::instance().capture();
+    std::erase_if(capture.threads, [](const auto& thread) { return thread.name != "TraceTest"; });
+    REQUIRE(capture.threads.size() == 1);
+    const auto& events = capture.threads[0].events;
+    REQUIRE(events.size() == 4);
+    // Scopes are recorded when they close, so the inner one comes first
+    REQUIRE(std::strcmp(events[1].name, "Inner") == 0);
+    REQUIRE(events[1].depth == 1);
+    REQUIRE(std::strcmp(events[2].name, "Outer") == 0);
+    REQUIRE(events[2].depth == 0);
+    REQUIRE(events[2].begin <= events[1].begin);
+    REQUIRE(events[2].end >= events[1].end);
+
+    const str trace = Profiler::exportTrace(capture);
+    REQUIRE(trace.starts_with("{\"traceEvents\": ["));
+    REQUIRE(trace.ends_with("]}\n"));
+    REQUIRE(trace.find(R"("args": {"name": "TraceTest"})") != str::npos);
+    REQUIRE(trace.find(R"({"name": "Inner", "ph": "X")") != str::npos);
+    REQUIRE(trace.find(R"({"name": "Outer", "ph": "X")") != str::npos);
+    REQUIRE(trace.find(R"({"name": "Frame", "ph": "i")") != str::npos);
+    REQUIRE(trace.find(R"("args": {"value": 42})") != str::npos);
+}
+
+// Wall-clock budgets only hold in optimized builds on quiet machines, so this one is hidden from
+// the default run. Run it with the [.benchmark] tag.
+TEST_CASE("Profiler - A scope costs less than 50 ns", "[Common][.benchmark]") {
+    constexpr u32 kScopes     = 1000000;
+    constexpr f64 kBudget     = 50.0;
+    const auto nanosecondsPer = [&](const auto& body) {
+        // Best of a few runs, so a preempted run doesn't fail the test
+        f64 best = std::numeric_limits<f64>::max();
+        for (u32 run = 0; run < 5; run++) {
+            const auto start = std::chrono::steady_clock::now();
+            for (u32 i = 0; i < kScopes; i++) {
+                body();
+            }
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            best = std::min(best, std::chrono::duration<f64, std::nano>(elapsed).count() / kScopes);
+        }
+        return best;
+    };
+
+    volatile u64 sink       = 0;
+    const f64 timestampCost = nanosecondsPer([&] { sink = Clock::cpuTimestamp() + sink; }) * 2;
+    const f64 scopeCost     = nanosecondsPer([] { const Profiler::Scope scope("Benchmark"); });
+    INFO("Nanoseconds per scope: " << scopeCost << ", of which reading the counter: "
+                                   << timestampCost);
+    if (timestampCost < kBudget / 2) {
+        REQUIRE(scopeCost < kBudget);
+    } else {
+        // Virtual machines may trap the time-stamp counter, which no profiler can avoid; hold
+        // what the profiler adds on top to the budget left on hardware where the read is cheap
+        WARN("Reading the time-stamp counter is slow here; checking the overhead on top of it");
+        REQUIRE(scopeCost - timestampCost < kBudget / 2);
+    }
+}
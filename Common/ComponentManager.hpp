@@ -4,65 +4,17 @@
 
 #pragma once
 
+#include "EntityId.hpp"
 #include "Resource.hpp"
 #include "Types.hpp"
 
+#include <algorithm>
+#include <span>
 #include <vector>
 #include <unordered_map>
 #include <numeric>
 
 namespace x {
-    // TODO: Put this in its own class file
-    class EntityId {
-    public:
-        constexpr EntityId() : _value(kInvalidValue) {}
-        explicit constexpr EntityId(u64 value) : _value(value) {}
-
-        constexpr u64 value() const {
-            return _value;
-        }
-
-        constexpr bool operator==(const EntityId& other) const {
-            return _value == other._value;
-        }
-
-        constexpr bool operator!=(const EntityId& other) const {
-            return _value != other._value;
-        }
-
-        constexpr bool operator<(const EntityId& other) const {
-            return _value < other._value;
-        }
-
-        constexpr bool operator>(const EntityId& other) const {
-            return _value > other._value;
-        }
-
-        constexpr bool operator<=(const EntityId& other) const {
-            return _value <= other._value;
-        }
-
-        constexpr bool operator>=(const EntityId& other) const {
-            return _value >= other._value;
-        }
-
-        constexpr u64 operator*() const {
-            return _value;
-        }
-
-        constexpr bool valid() const {
-            return _value != kInvalidValue;
-        }
-
-        static constexpr EntityId Invalid() {
-            return EntityId();
-        }
-
-    private:
-        u64 _value;
-        static constexpr u64 kInvalidValue = std::numeric_limits<u64>::max();
-    };
-
     namespace detail {
         template<typename T>
         struct release_resources {
@@ -71,19 +23,6 @@ namespace x {
     }  // namespace detail
 }  // namespace x
 
-#ifndef X_ENTITY_ID_HASH_SPECIALIZATION
-    #define X_ENTITY_ID_HASH_SPECIALIZATION
-// Allow EntityId to be used in std::unordered_map/set
-namespace std {
-    template<>
-    struct hash<x::EntityId> {
-        std::size_t operator()(const x::EntityId& id) const {
-            return std::hash<u64> {}(id.value());
-        }
-    };
-}  // namespace std
-#endif
-
 namespace x {
     // Forward declarations
     class TransformComponent;
@@ -208,6 +147,17 @@ namespace x {
             return ConstIterator(_components, _indexToEntity, _components.size());
         }
 
+        /// @brief Makes room for count more components so bulk loads don't reallocate or rehash.
+        void reserve(size_t count) {
+            const size_t total = _components.size() + count;
+            if (total <= _components.capacity()) { return; }
+            // Keep geometric growth so repeated small reservations stay amortized O(1)
+            const size_t capacity = std::max(total, _components.capacity() * 2);
+            _components.reserve(capacity);
+            _indexToEntity.reserve(capacity);
+            _entityToIndex.reserve(capacity);
+        }
+
         ComponentView addComponent(EntityId entity) {
             size_t newIndex = _components.size();
             _components.emplace_back();
@@ -216,6 +166,22 @@ namespace x {
             return {entity, _components.back()};
         }
 
+        /// @brief Appends one component per entity, copied from prototypes[i % prototypes.size()].
+        /// Cycling the prototypes lets callers stamp out many copies of the same set in one pass.
+        /// Returns the first new component; the rest follow contiguously in entity order.
+        T* addComponents(std::span<const EntityId> entities, std::span<const T> prototypes) {
+            if (entities.empty() || prototypes.empty()) { return nullptr; }
+            reserve(entities.size());
+
+            const size_t firstIndex = _components.size();
+            for (size_t i = 0; i < entities.size(); i++) {
+                _components.push_back(prototypes[i % prototypes.size()]);
+                _entityToIndex[entities[i]] = firstIndex + i;
+            }
+            _indexToEntity.insert(_indexToEntity.end(), entities.begin(), entities.end());
+            return &_components[firstIndex];
+        }
+
         void removeComponent(EntityId entity) {
             auto it = _entityToIndex.find(entity);
             if (it != _entityToIndex.end()) {
@@ -254,5 +220,10 @@ namespace x {
         const std::vector<T>& getRawComponents() const {
             return _components;
         }
+
+        /// @brief Owning entity of each component, parallel to getRawComponents()
+        const std::vector<EntityId>& getEntities() const {
+            return _indexToEntity;
+        }
     };
 }  // namespace x
\ No newline at end of file
@@ -0,0 +1,75 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+
+#include <functional>
+#include <limits>
+
+namespace x {
+    class EntityId {
+    public:
+        constexpr EntityId() : _value(kInvalidValue) {}
+        explicit constexpr EntityId(u64 value) : _value(value) {}
+
+        constexpr u64 value() const {
+            return _value;
+        }
+
+        constexpr bool operator==(const EntityId& other) const {
+            return _value == other._value;
+        }
+
+        constexpr bool operator!=(const EntityId& other) const {
+            return _value != other._value;
+        }
+
+        constexpr bool operator<(const EntityId& other) const {
+            return _value < other._value;
+        }
+
+        constexpr bool operator>(const EntityId& other) const {
+            return _value > other._value;
+        }
+
+        constexpr bool operator<=(const EntityId& other) const {
+            return _value <= other._value;
+        }
+
+        constexpr bool operator>=(const EntityId& other) const {
+            return _value >= other._value;
+        }
+
+        constexpr u64 operator*() const {
+            return _value;
+        }
+
+        constexpr bool valid() const {
+            return _value != kInvalidValue;
+        }
+
+        static constexpr EntityId Invalid() {
+            return EntityId();
+        }
+
+    private:
+        u64 _value;
+        static constexpr u64 kInvalidValue = std::numeric_limits<u64>::max();
+    };
+}  // namespace x
+
+#ifndef X_ENTITY_ID_HASH_SPECIALIZATION
+    #define X_ENTITY_ID_HASH_SPECIALIZATION
+// Allow EntityId to be used in std::unordered_map/set
+namespace std {
+    template<>
+    struct hash<x::EntityId> {
+        std::size_t operator()(const x::EntityId& id) const {
+            return std::hash<u64> {}(id.value());
+        }
+    };
+}  // namespace std
+#endif
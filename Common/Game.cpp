@@ -4,8 +4,13 @@
 
 #include "Game.hpp"
 #include "Panic.hpp"
+#include "Profiler.hpp"
+#include "ShaderManager.hpp"
+#include "Filesystem/Filesystem.hpp"
 #include "Graphics/DebugOpenGL.hpp"
 #include "Graphics/DebugUI.hpp"
+#include "Graphics/GLState.hpp"
+#include "Graphics/RenderStats.hpp"
 
 namespace x {
     static void resizeCallback(GLFWwindow* window, const int width, const int height) {
@@ -104,13 +109,19 @@ namespace x {
 
         // glfwSetInputMode(_window, GLFW_CURSOR, GLFW_CURSOR_DISABLED); // Hides cursor
 
-        _context = Context::create();
-        _clock   = Clock::create();
+        // Warm starts load linked programs instead of compiling them
+        const auto shaderCache = Filesystem::Path::currentPath() / "ShaderCache";
+        ShaderManager::instance().setCacheDirectory(shaderCache.string());
+
+        _context     = Context::create();
+        _clock       = Clock::create();
+        _gpuProfiler = std::make_unique<Graphics::GpuProfiler>();
     }
 
     IGame::~IGame() {
         if (_running) quit();  // Stop all threads
         _clock.reset();
+        _gpuProfiler.reset();
         _context.reset();
         if (debug) { Graphics::DebugUI::shutdown(); }
         glfwDestroyWindow(_window);
@@ -146,14 +157,19 @@ namespace x {
     }
 
     void IGame::updateLoop() {
+        X_PROFILE_THREAD("Update");
         while (_running) {
+            X_PROFILE_FRAME("Update");
             auto startTime = std::chrono::high_resolution_clock::now();
 
             _clock->tick();
 
             // update game state
             auto& writeState = _stateBuffer.getWriteBuffer();
-            update(writeState);
+            {
+                X_PROFILE_SCOPE("Update");
+                update(writeState);
+            }
 
             _stateBuffer.swapWriteBuffer();
             _clock->update();
@@ -165,13 +181,20 @@ namespace x {
     }
 
     void IGame::renderLoop() {
+        X_PROFILE_THREAD("Render");
         while (_running && !glfwWindowShouldClose(_window)) {
+            X_PROFILE_FRAME("Render");
             auto frameStart  = std::chrono::high_resolution_clock::now();
             auto renderStart = std::chrono::high_resolution_clock::now();
 
-            u32 queryId;
-            glGenQueries(1, &queryId);
-            glBeginQuery(GL_TIME_ELAPSED, queryId);
+            // ImGui and the previous frame's passes bind behind the tracker's back
+            Graphics::GLState::current().beginFrame();
+            Graphics::RenderStats::current().beginFrame();
+
+            // Reads back an earlier frame's timings instead of waiting on this one
+            _gpuProfiler->beginFrame();
+            // Fulfils programs submitted with compileAsync() once the driver has them ready
+            ShaderManager::instance().poll();
 
             glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
             glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -180,30 +203,31 @@ namespace x {
 
             _stateBuffer.swapReadBuffer();
             const auto& readState = _stateBuffer.getReadBuffer();
-            draw(readState);
+            {
+                X_PROFILE_SCOPE("Draw");
+                draw(readState);
+            }
 
             if (debug) {
+                X_PROFILE_SCOPE("DebugUI");
+                Graphics::GpuProfiler::Scope scope(*_gpuProfiler, "UI");
                 Graphics::DebugUI::beginFrame();
                 drawDebugUI(readState);
                 Graphics::DebugUI::endFrame();
             }
 
-            glEndQuery(GL_TIME_ELAPSED);
+            _gpuProfiler->endFrame();
             auto renderEnd      = std::chrono::high_resolution_clock::now();
             auto renderDuration = std::chrono::duration<f32, std::milli>(renderEnd - renderStart);
             _frameGraph.renderThreadTime.store(renderDuration.count());
-
-            u64 gpuTime;
-            glGetQueryObjectui64v(queryId, GL_QUERY_RESULT, &gpuTime);
-            _frameGraph.gpuTime.store(CAST<f32>(gpuTime) /
-                                      1000000.0f);  // Convert nanoseconds to milliseconds
+            _frameGraph.gpuTime.store(_gpuProfiler->getFrameTime());
 
             auto frameEnd      = std::chrono::high_resolution_clock::now();
             auto frameDuration = std::chrono::duration<f32, std::milli>(frameEnd - frameStart);
             _frameGraph.frameTime.store(frameDuration.count());
 
+            X_PROFILE_SCOPE("SwapBuffers");
             glfwSwapBuffers(_window);
-            glDeleteQueries(1, &queryId);
         }
     }
 }  // namespace x
\ No newline at end of file
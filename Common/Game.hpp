@@ -15,6 +15,7 @@
 #include "Input/InputManager.hpp"
 #include "ComponentManager.hpp"
 #include "StateBuffer.hpp"
+#include "Graphics/GpuProfiler.hpp"
 
 namespace x {
     /// @brief Handles window and context creation and manages the application lifetime
@@ -54,6 +55,7 @@ namespace x {
         GLFWwindow* _window;
         std::shared_ptr<Clock> _clock;
         std::unique_ptr<Context> _context;
+        std::unique_ptr<Graphics::GpuProfiler> _gpuProfiler;  // Scope passes from draw()
         Input::InputManager _inputManager;
         str title;
         int initWidth;
@@ -70,7 +72,7 @@ namespace x {
         struct FrameGraph {
             std::atomic<f32> mainThreadTime   = 0.0f;  // ms
             std::atomic<f32> renderThreadTime = 0.0f;  // ms
-            std::atomic<f32> gpuTime          = 0.0f;  // ms
+            std::atomic<f32> gpuTime          = 0.0f;  // ms, a few frames behind
             std::atomic<f32> frameTime        = 0.0f;  // ms
         } _frameGraph;
 
@@ -10,6 +10,12 @@ namespace x {
         return EntityId(newId);
     }
 
+    EntityId GameState::createEntities(u64 count) {
+        const auto first = _nextEntityId + 1;
+        _nextEntityId += count;
+        return EntityId(first);
+    }
+
     void GameState::destroyEntity(EntityId entity) {
         _transforms.removeComponent(entity);
         _renderables.removeComponent(entity);
@@ -17,17 +23,21 @@ namespace x {
 
     GameState GameState::clone() const {
         GameState newState;
+        newState.copyFrom(*this);
+        return newState;
+    }
 
+    void GameState::copyFrom(const GameState& other) {
         // Deep copy all components and state
         // This is called when swapping buffers
-        newState._nextEntityId = _nextEntityId;
-        newState._globalState  = _globalState;
+        _nextEntityId = other._nextEntityId;
+        _globalState  = other._globalState;
 
-        // Component Managers
-        newState._transforms  = _transforms;
-        newState._renderables = _renderables;
+        // Component Managers. Assigning over the existing ones reuses their storage.
+        _transforms  = other._transforms;
+        _renderables = other._renderables;
 
-        return newState;
+        // Render commands are not carried over; each update records its own
     }
 
     void GameState::setSun(const DirectionalLight& sun) {
@@ -10,6 +10,7 @@
 #include "LightingState.hpp"
 #include "TransformComponent.hpp"
 #include "RenderComponent.hpp"
+#include "Graphics/RenderCommandList.hpp"
 
 #include <set>
 #include <vector>
@@ -19,8 +20,12 @@ namespace x {
     class GameState {
     public:
         EntityId createEntity();
+        /// @brief Allocates count consecutive entity IDs and returns the first one.
+        EntityId createEntities(u64 count);
         void destroyEntity(EntityId entity);
         [[nodiscard]] GameState clone() const;
+        /// @brief Makes this state a deep copy of other, reusing the storage it already holds
+        void copyFrom(const GameState& other);
 
         template<typename T>
         const T* getComponent(EntityId entity) const {
@@ -77,6 +82,15 @@ namespace x {
             return _globalState._lighting;
         }
 
+        /// @brief Draws recorded by the update thread for this state, decoded by the render thread
+        [[nodiscard]] Graphics::RenderCommandList& getRenderCommands() {
+            return _renderCommands;
+        }
+
+        [[nodiscard]] const Graphics::RenderCommandList& getRenderCommands() const {
+            return _renderCommands;
+        }
+
         void setSun(const DirectionalLight& sun);
         // void updatePointLight(i32 index);
         // void updateSpotLight(i32 index);
@@ -86,7 +100,7 @@ namespace x {
         void releaseAllResources();
 
     private:
-        u64 _nextEntityId;
+        u64 _nextEntityId = 0;
 
         ComponentManager<TransformComponent> _transforms;
         ComponentManager<RenderComponent> _renderables;
@@ -96,6 +110,8 @@ namespace x {
             LightingState _lighting;
         } _globalState;
 
+        Graphics::RenderCommandList _renderCommands;
+
         template<typename T>
         void releaseComponentResources() {
             if constexpr (detail::release_resources<T>::value) {
@@ -18,13 +18,18 @@ namespace x {
     IBLPreprocessor::IBLPreprocessor(const Filesystem::Path& hdr) : _hdrPath(hdr) {
         std::cout << " -- Loading HDR: " << _hdrPath.string() << std::endl;
 
-        _equirectToCubemapShader =
-          ShaderManager::instance().getShaderProgram(EquirectToCubemap_VS_Source,
-                                                     EquirectToCubemap_FS_Source);
-        _irradianceShader = ShaderManager::instance().getShaderProgram(IrradianceMap_VS_Source,
-                                                                       IrradianceMap_FS_Source);
-        _prefilterShader  = ShaderManager::instance().getShaderProgram(PrefilteredMap_VS_Source,
-                                                                      PrefilteredMap_FS_Source);
+        // Submitted together so the driver can compile them in parallel
+        auto& shaders = ShaderManager::instance();
+        const auto equirectToCubemap =
+          shaders.compileAsync(EquirectToCubemap_VS_Source, EquirectToCubemap_FS_Source);
+        const auto irradiance =
+          shaders.compileAsync(IrradianceMap_VS_Source, IrradianceMap_FS_Source);
+        const auto prefilter =
+          shaders.compileAsync(PrefilteredMap_VS_Source, PrefilteredMap_FS_Source);
+        shaders.finish();
+        _equirectToCubemapShader = equirectToCubemap.get();
+        _irradianceShader        = irradiance.get();
+        _prefilterShader         = prefilter.get();
         // _brdfShader       = ShaderManager::instance().getShaderProgram("", "");
 
         if (!_equirectToCubemapShader or !_irradianceShader or
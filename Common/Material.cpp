@@ -5,8 +5,9 @@
 #include "Material.hpp"
 
 namespace x {
-    IMaterial::IMaterial(const std::shared_ptr<Graphics::ShaderProgram>& shader)
-        : _shaderProgram(shader) {}
+    IMaterial::IMaterial(const std::shared_ptr<Graphics::ShaderProgram>& shader,
+                         const std::shared_ptr<Graphics::ShaderProgram>& instancedShader)
+        : _shaderProgram(shader), _instancedShaderProgram(instancedShader) {}
 
     void IMaterial::setTexture(const str& name,
                                u32 slot,
@@ -14,86 +15,87 @@ namespace x {
         _textures.insert_or_assign(slot, texture);
         _shaderProgram->use();
         _shaderProgram->setInt(name, slot);
+        if (_instancedShaderProgram) {
+            _instancedShaderProgram->use();
+            _instancedShaderProgram->setInt(name, slot);
+        }
+    }
+
+    void IMaterial::setUniform(Graphics::UniformId uniform, bool value) {
+        _shaderProgram->setBool(uniform, value);
+    }
+
+    void IMaterial::setUniform(Graphics::UniformId uniform, i32 value) {
+        _shaderProgram->setInt(uniform, value);
     }
 
-    void IMaterial::setUniform(const str& name, bool value) {
-        const auto loc = getUniformLocation(name);
-        _shaderProgram->setBool(loc, value);
+    void IMaterial::setUniform(Graphics::UniformId uniform, f32 value) {
+        _shaderProgram->setFloat(uniform, value);
     }
 
-    void IMaterial::setUniform(const str& name, i32 value) {
-        const auto loc = getUniformLocation(name);
-        _shaderProgram->setInt(loc, value);
+    void IMaterial::setUniform(Graphics::UniformId uniform, f32 x, f32 y) {
+        _shaderProgram->setVec2(uniform, x, y);
     }
 
-    void IMaterial::setUniform(const str& name, f32 value) {
-        const auto loc = getUniformLocation(name);
-        _shaderProgram->setFloat(loc, value);
+    void IMaterial::setUniform(Graphics::UniformId uniform, const glm::vec2& value) {
+        _shaderProgram->setVec2(uniform, value);
     }
 
-    void IMaterial::setUniform(const str& name, f32 x, f32 y) {
-        const auto loc = getUniformLocation(name);
-        _shaderProgram->setVec2(loc, x, y);
+    void IMaterial::setUniform(Graphics::UniformId uniform, f32 x, f32 y, f32 z) {
+        _shaderProgram->setVec3(uniform, x, y, z);
     }
 
-    void IMaterial::setUniform(const str& name, const glm::vec2& value) {
-        const auto loc = getUniformLocation(name);
-        _shaderProgram->setVec2(loc, value);
+    void IMaterial::setUniform(Graphics::UniformId uniform, const glm::vec3& value) {
+        _shaderProgram->setVec3(uniform, value);
     }
 
-    void IMaterial::setUniform(const str& name, f32 x, f32 y, f32 z) {
-        const auto loc = getUniformLocation(name);
-        _shaderProgram->setVec3(loc, x, y, z);
+    void IMaterial::setUniform(Graphics::UniformId uniform, f32 x, f32 y, f32 z, f32 w) {
+        _shaderProgram->setVec4(uniform, x, y, z, w);
     }
 
-    void IMaterial::setUniform(const str& name, const glm::vec3& value) {
-        const auto loc = getUniformLocation(name);
-        _shaderProgram->setVec3(loc, value);
+    void IMaterial::setUniform(Graphics::UniformId uniform, const glm::vec4& value) {
+        _shaderProgram->setVec4(uniform, value);
     }
 
-    void IMaterial::setUniform(const str& name, f32 x, f32 y, f32 z, f32 w) {
-        const auto loc = getUniformLocation(name);
-        _shaderProgram->setVec4(loc, x, y, z, w);
+    void IMaterial::setUniform(Graphics::UniformId uniform, const glm::mat2& mat) {
+        _shaderProgram->setMat2(uniform, mat);
     }
 
-    void IMaterial::setUniform(const str& name, const glm::vec4& value) {
-        const auto loc = getUniformLocation(name);
-        _shaderProgram->setVec4(loc, value);
+    void IMaterial::setUniform(Graphics::UniformId uniform, const glm::mat3& mat) {
+        _shaderProgram->setMat3(uniform, mat);
     }
 
-    void IMaterial::setUniform(const str& name, const glm::mat2& mat) {
-        const auto loc = getUniformLocation(name);
-        _shaderProgram->setMat2(loc, mat);
+    void IMaterial::setUniform(Graphics::UniformId uniform, const glm::mat4& mat) {
+        _shaderProgram->setMat4(uniform, mat);
     }
 
-    void IMaterial::setUniform(const str& name, const glm::mat3& mat) {
-        const auto loc = getUniformLocation(name);
-        _shaderProgram->setMat3(loc, mat);
+    void IMaterial::setUniform(Graphics::UniformId uniform, i32 x, i32 y) {
+        _shaderProgram->setVec2i(uniform, x, y);
     }
 
-    void IMaterial::setUniform(const str& name, const glm::mat4& mat) {
-        const auto loc = getUniformLocation(name);
-        _shaderProgram->setMat4(loc, mat);
+    void IMaterial::setUniform(Graphics::UniformId uniform, i32 x, i32 y, i32 z) {
+        _shaderProgram->setVec3i(uniform, x, y, z);
     }
 
-    void IMaterial::setUniform(const str& name, i32 x, i32 y) {
-        const auto loc = getUniformLocation(name);
-        _shaderProgram->setVec2i(loc, x, y);
+    void IMaterial::setUniform(Graphics::UniformId uniform, i32 x, i32 y, i32 z, i32 w) {
+        _shaderProgram->setVec4i(uniform, x, y, z, w);
     }
 
-    void IMaterial::setUniform(const str& name, i32 x, i32 y, i32 z) {
-        const auto loc = getUniformLocation(name);
-        _shaderProgram->setVec3i(loc, x, y, z);
+    void IMaterial::setUniform(Graphics::UniformId uniform, const f32* values, size_t count) {
+        _shaderProgram->setFloatArray(uniform, values, count);
     }
 
-    void IMaterial::setUniform(const str& name, i32 x, i32 y, i32 z, i32 w) {
-        const auto loc = getUniformLocation(name);
-        _shaderProgram->setVec4i(loc, x, y, z, w);
+    const std::shared_ptr<Graphics::ShaderProgram>& IMaterial::getShaderProgram() const {
+        return _shaderProgram;
     }
 
-    void IMaterial::setUniform(const str& name, const f32* values, size_t count) {
-        const auto loc = getUniformLocation(name);
-        _shaderProgram->setFloatArray(loc, values, count);
+    const std::shared_ptr<Graphics::ShaderProgram>& IMaterial::getInstancedShaderProgram() const {
+        return _instancedShaderProgram;
+    }
+
+    const std::unordered_map<i32, std::weak_ptr<Graphics::Texture>>&
+    IMaterial::getTextures() const {
+        return _textures;
     }
 
     // void IMaterial::apply() const {
@@ -104,12 +106,4 @@ namespace x {
     //         texture.lock()->bind(slot);
     //     }
     // }
-
-    u32 IMaterial::getUniformLocation(const str& name) {
-        if (_uniforms.find(name) == _uniforms.end()) {
-            const u32 location = glGetUniformLocation(_shaderProgram->getId(), name.c_str());
-            _uniforms[name]    = location;
-        }
-        return _uniforms.at(name);
-    }
 }  // namespace x
\ No newline at end of file
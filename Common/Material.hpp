@@ -9,6 +9,7 @@
 #include "Types.hpp"
 #include "Graphics/ShaderProgram.hpp"
 #include "Graphics/Texture.hpp"
+#include "Math/AffineTransform.hpp"
 
 #include <memory>
 #include <unordered_map>
@@ -16,30 +17,51 @@
 namespace x {
     class IMaterial {
     public:
-        explicit IMaterial(const std::shared_ptr<Graphics::ShaderProgram>& shader);
+        /// @param instancedShader Optional variant that reads transforms and material parameters
+        /// from an instance buffer instead of uniforms
+        explicit IMaterial(
+          const std::shared_ptr<Graphics::ShaderProgram>& shader,
+          const std::shared_ptr<Graphics::ShaderProgram>& instancedShader = nullptr);
         virtual ~IMaterial() = default;
 
         virtual void
         setTexture(const str& name, u32 slot, const std::weak_ptr<Graphics::Texture>& texture);
-        virtual void setUniform(const str& name, bool value);
-        virtual void setUniform(const str& name, i32 value);
-        virtual void setUniform(const str& name, f32 value);
-        virtual void setUniform(const str& name, f32 x, f32 y);
-        virtual void setUniform(const str& name, const glm::vec2& value);
-        virtual void setUniform(const str& name, f32 x, f32 y, f32 z);
-        virtual void setUniform(const str& name, const glm::vec3& value);
-        virtual void setUniform(const str& name, f32 x, f32 y, f32 z, f32 w);
-        virtual void setUniform(const str& name, const glm::vec4& value);
-        virtual void setUniform(const str& name, const glm::mat2& mat);
-        virtual void setUniform(const str& name, const glm::mat3& mat);
-        virtual void setUniform(const str& name, const glm::mat4& mat);
-        virtual void setUniform(const str& name, i32 x, i32 y);
-        virtual void setUniform(const str& name, i32 x, i32 y, i32 z);
-        virtual void setUniform(const str& name, i32 x, i32 y, i32 z, i32 w);
-        virtual void setUniform(const str& name, const f32* values, size_t count);
-
-        // Binds shader and updates shader uniforms
-        virtual void apply(const TransformMatrices& matrices) = 0;
+        // Uniforms resolve through the table the program reflects at link time; string literals
+        // are hashed at compile time.
+        virtual void setUniform(Graphics::UniformId uniform, bool value);
+        virtual void setUniform(Graphics::UniformId uniform, i32 value);
+        virtual void setUniform(Graphics::UniformId uniform, f32 value);
+        virtual void setUniform(Graphics::UniformId uniform, f32 x, f32 y);
+        virtual void setUniform(Graphics::UniformId uniform, const glm::vec2& value);
+        virtual void setUniform(Graphics::UniformId uniform, f32 x, f32 y, f32 z);
+        virtual void setUniform(Graphics::UniformId uniform, const glm::vec3& value);
+        virtual void setUniform(Graphics::UniformId uniform, f32 x, f32 y, f32 z, f32 w);
+        virtual void setUniform(Graphics::UniformId uniform, const glm::vec4& value);
+        virtual void setUniform(Graphics::UniformId uniform, const glm::mat2& mat);
+        virtual void setUniform(Graphics::UniformId uniform, const glm::mat3& mat);
+        virtual void setUniform(Graphics::UniformId uniform, const glm::mat4& mat);
+        virtual void setUniform(Graphics::UniformId uniform, i32 x, i32 y);
+        virtual void setUniform(Graphics::UniformId uniform, i32 x, i32 y, i32 z);
+        virtual void setUniform(Graphics::UniformId uniform, i32 x, i32 y, i32 z, i32 w);
+        virtual void setUniform(Graphics::UniformId uniform, const f32* values, size_t count);
+
+        /// @brief Uploads the material parameters. Expects the shader program to already be
+        /// bound. Camera, lighting and transforms come from the uniform blocks in
+        /// Graphics/UniformBlocks.hpp instead.
+        virtual void applyMaterial() = 0;
+        /// @brief Size in bytes of one element of the instanced variant's instance buffer
+        [[nodiscard]] virtual size_t getInstanceDataSize() const {
+            return 0;
+        }
+        /// @brief Writes one element of the instance buffer
+        virtual void writeInstanceData(const Math::AffineTransform& /*transform*/,
+                                       void* /*destination*/) const {}
+
+        [[nodiscard]] const std::shared_ptr<Graphics::ShaderProgram>& getShaderProgram() const;
+        [[nodiscard]] const std::shared_ptr<Graphics::ShaderProgram>&
+        getInstancedShaderProgram() const;
+        [[nodiscard]] const std::unordered_map<i32, std::weak_ptr<Graphics::Texture>>&
+        getTextures() const;
 
         template<typename T>
             requires std::is_base_of_v<IMaterial, T>
@@ -49,9 +71,7 @@ namespace x {
 
     protected:
         std::shared_ptr<Graphics::ShaderProgram> _shaderProgram;
+        std::shared_ptr<Graphics::ShaderProgram> _instancedShaderProgram;
         std::unordered_map<i32, std::weak_ptr<Graphics::Texture>> _textures;
-        std::unordered_map<str, u32> _uniforms;
-
-        u32 getUniformLocation(const str& name);
     };
 }  // namespace x
\ No newline at end of file
@@ -3,20 +3,24 @@
 //
 
 #include "Mesh.hpp"
+#include "Graphics/DebugOpenGL.hpp"
+#include "Graphics/RenderStats.hpp"
+
+#include <algorithm>
 
 namespace x {
-    Mesh::Mesh(const std::vector<Graphics::VertexAttribute>& attributes,
-               const std::vector<Graphics::VertexPosNormTanBiTanTex>& vertices,
-               const std::vector<u32>& indices)
-        : _numVertices(CAST<u32>(vertices.size())), _numIndices(CAST<u32>(indices.size())),
-          _attributes(attributes) {
-        _vertexArray =
-          std::make_unique<Graphics::VertexArray<Graphics::VertexPosNormTanBiTanTex, u32>>(
-            attributes,
-            vertices,
-            indices);
-        _vertexArray->bind();
-        if (!_vertexArray) { Panic("Failed to create vertex array in Mesh instance."); }
+    Mesh::Mesh(std::shared_ptr<Graphics::GeometryPool> pool,
+               const std::vector<Graphics::VertexPacked>& vertices,
+               const std::vector<u32>& indices,
+               const std::vector<Graphics::MeshLod>& lods,
+               const Math::AffineTransform& dequantize,
+               const Math::AABB& bounds,
+               const Math::BoundingSphere& sphere)
+        : _pool(std::move(pool)), _lods(lods), _dequantize(dequantize), _bounds(bounds),
+          _sphere(sphere) {
+        _range = _pool->allocate(vertices, indices);
+        if (!_range.valid()) { Panic("Failed to allocate geometry in Mesh instance."); }
+        if (_lods.empty()) { _lods.push_back({0, _range.indexCount, 0.f}); }
     }
 
     Mesh::~Mesh() {
@@ -34,22 +38,65 @@ namespace x {
         // }
     }
 
-    void Mesh::draw() const {
-        _vertexArray->bind();
-        _vertexArray->bindIndexBuffer();
-        glDrawElements(GL_TRIANGLES, _numIndices, GL_UNSIGNED_INT, 0);
+    void Mesh::draw(u32 lod) const {
+        // The index buffer is part of the vertex array's state
+        _pool->bind();
+        const auto& level      = getLod(lod);
+        const u32 firstIndex   = _range.firstIndex + level.firstIndex;
+        const uintptr_t offset = CAST<uintptr_t>(firstIndex) * sizeof(u32);
+        glDrawElementsBaseVertex(GL_TRIANGLES,
+                                 CAST<GLsizei>(level.indexCount),
+                                 GL_UNSIGNED_INT,
+                                 RCAST<const void*>(offset),
+                                 CAST<GLint>(_range.baseVertex));
         CHECK_GL_ERROR();
+        Graphics::RenderStats::current().recordDraw(level.indexCount);
     }
 
     void Mesh::destroy() {
-        _vertexArray.reset();
+        if (!_pool) { return; }
+        _pool->free(_range);
+        _range = {};
+        _pool.reset();
     }
 
     u32 Mesh::getIndexCount() const {
-        return _numIndices;
+        return _lods.front().indexCount;
     }
 
     u32 Mesh::getVertexCount() const {
-        return _numVertices;
+        return _range.vertexCount;
+    }
+
+    u32 Mesh::getVertexArrayId() const {
+        return _pool->getVertexArrayId();
+    }
+
+    u32 Mesh::getIndexBufferId() const {
+        return _pool->getIndexBufferId();
+    }
+
+    const Graphics::GeometryRange& Mesh::getGeometryRange() const {
+        return _range;
+    }
+
+    u32 Mesh::getLodCount() const {
+        return CAST<u32>(_lods.size());
+    }
+
+    const Graphics::MeshLod& Mesh::getLod(u32 lod) const {
+        return _lods[std::min<size_t>(lod, _lods.size() - 1)];
+    }
+
+    const Math::AABB& Mesh::getBounds() const {
+        return _bounds;
+    }
+
+    const Math::BoundingSphere& Mesh::getBoundingSphere() const {
+        return _sphere;
+    }
+
+    const Math::AffineTransform& Mesh::getDequantization() const {
+        return _dequantize;
     }
 }  // namespace x
\ No newline at end of file
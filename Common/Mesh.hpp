@@ -7,29 +7,53 @@
 #include <glad.h>
 #include "Types.hpp"
 #include "Clock.hpp"
-#include "Graphics/VertexArray.hpp"
+#include "Graphics/GeometryPool.hpp"
+#include "Graphics/MeshSimplifier.hpp"
+#include "Graphics/Vertex.hpp"
+#include "Math/Bounds.hpp"
 
 namespace x {
+    /// @brief A range of a shared Graphics::GeometryPool. The range is returned to the pool when
+    /// the mesh is destroyed; the pool itself lives until its last mesh is gone.
     class Mesh {
     public:
-        Mesh(const std::vector<Graphics::VertexAttribute>& attributes,
-             const std::vector<Graphics::VertexPosNormTanBiTanTex>& vertices,
-             const std::vector<u32>& indices);
+        Mesh(std::shared_ptr<Graphics::GeometryPool> pool,
+             const std::vector<Graphics::VertexPacked>& vertices,
+             const std::vector<u32>& indices,
+             const std::vector<Graphics::MeshLod>& lods,
+             const Math::AffineTransform& dequantize,
+             const Math::AABB& bounds,
+             const Math::BoundingSphere& sphere);
         ~Mesh();
 
         void update(const std::weak_ptr<Clock>& clock) const;
-        void draw() const;
+        void draw(u32 lod = 0) const;
         void destroy();
 
+        /// @brief Indices of the full detail level
         u32 getIndexCount() const;
         u32 getVertexCount() const;
+        /// @brief The pool's vertex array, shared with every other mesh in the pool
+        [[nodiscard]] u32 getVertexArrayId() const;
+        [[nodiscard]] u32 getIndexBufferId() const;
+        /// @brief The mesh's share of the pool, covering the indices of every level of detail
+        [[nodiscard]] const Graphics::GeometryRange& getGeometryRange() const;
+        [[nodiscard]] u32 getLodCount() const;
+        /// @brief Level 0 is the full mesh; lod is clamped to the coarsest level
+        [[nodiscard]] const Graphics::MeshLod& getLod(u32 lod) const;
+        /// @brief Model space bounds, computed when the mesh was imported
+        [[nodiscard]] const Math::AABB& getBounds() const;
+        [[nodiscard]] const Math::BoundingSphere& getBoundingSphere() const;
+        /// @brief Maps the packed vertex positions to model space, apply before the model transform
+        [[nodiscard]] const Math::AffineTransform& getDequantization() const;
 
     private:
-        std::unique_ptr<Graphics::VertexArray<Graphics::VertexPosNormTanBiTanTex, u32>>
-          _vertexArray;
-        const u32 _numVertices;
-        const u32 _numIndices;
-        const std::vector<Graphics::VertexAttribute>& _attributes;
+        std::shared_ptr<Graphics::GeometryPool> _pool;
+        Graphics::GeometryRange _range;
+        std::vector<Graphics::MeshLod> _lods;
+        Math::AffineTransform _dequantize;
+        Math::AABB _bounds;
+        Math::BoundingSphere _sphere;
     };
 
 }  // namespace x
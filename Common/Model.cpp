@@ -3,21 +3,40 @@
 //
 
 #include "Model.hpp"
+#include "ModelManager.hpp"
 #include "PBRMaterial.hpp"
 #include "ShaderManager.hpp"
-#include "Graphics/Vertex.hpp"
+#include "Graphics/VertexPacking.hpp"
+#include "Math/OcclusionBuffer.hpp"
 
+#include <algorithm>
 #include <assimp/Importer.hpp>
 #include <assimp/postprocess.h>
 
 #include "Graphics/Shaders/Include/PBR_FS.h"
+#include "Graphics/Shaders/Include/PBR_Instanced_VS.h"
 #include "Graphics/Shaders/Include/PBR_VS.h"
 
 namespace x {
     ModelHandle ModelHandle::loadFromFile(const str& filename) {
         ModelHandle handle;
         handle._modelData = std::make_shared<ModelData>();
-        if (!handle._modelData->loadFromFile(filename)) { handle._modelData.reset(); }
+        if (!handle._modelData->importFromFile(filename) || !handle._modelData->upload()) {
+            handle._modelData.reset();
+            return handle;
+        }
+        ModelManager::instance().registerModel(handle);
+        return handle;
+    }
+
+    ModelHandle ModelHandle::importFromFile(const str& filename) {
+        ModelHandle handle;
+        handle._modelData = std::make_shared<ModelData>();
+        if (!handle._modelData->importFromFile(filename)) {
+            handle._modelData.reset();
+            return handle;
+        }
+        ModelManager::instance().registerModel(handle);
         return handle;
     }
 
@@ -30,10 +49,36 @@ namespace x {
         return outHandle.valid();
     }
 
-    void ModelHandle::draw(const CameraState& camera,
-                           const LightingState& lighting,
-                           const TransformComponent& transform) const {
-        if (_modelData) _modelData->draw(camera, lighting, transform);
+    void ModelHandle::submit(Graphics::RenderQueue& queue,
+                             const CameraState& camera,
+                             const TransformComponent& transform) const {
+        if (_modelData) _modelData->submit(queue, camera, transform);
+    }
+
+    void ModelHandle::record(Graphics::RenderCommandList& commands,
+                             size_t list,
+                             const CameraState& camera,
+                             const TransformComponent& transform) const {
+        if (!_modelData || _modelData->_drawId == kNoDrawId) { return; }
+
+        // The program is only known once the model is uploaded, so sort by model (each model
+        // owns its material) and mesh. Repeated program binds are elided by GLState.
+        Graphics::RenderCommand command;
+        command.model     = _modelData->_drawId;
+        command.transform = transform.getAffine();
+        const f32 depth   = glm::length(transform.getPosition() - camera.position);
+        for (u32 mesh = 0; mesh < _modelData->_meshCount; mesh++) {
+            const u32 lod = _modelData->selectLod(mesh, camera, transform);
+            command.mesh  = CAST<u16>(mesh);
+            command.lod   = CAST<u16>(lod);
+            // Levels of one mesh are different index ranges, so they must not interleave
+            command.key = Graphics::RenderQueue::makeKey(Graphics::RenderPass::Opaque,
+                                                         0,
+                                                         command.model,
+                                                         mesh * Graphics::kMaxLods + lod,
+                                                         depth);
+            commands.record(list, command);
+        }
     }
 
     void ModelHandle::release() {
@@ -44,27 +89,114 @@ namespace x {
         return _modelData->_material;
     }
 
-    void ModelData::draw(const CameraState& camera,
-                         const LightingState& lighting,
-                         const TransformComponent& transform) {
-        const auto view       = camera.view;
-        const auto projection = camera.projection;
-        const auto model      = transform.getMatrix();
-        const auto matrices   = TransformMatrices(model, view, projection);
+    Math::AABB ModelHandle::getBounds() const {
+        return _modelData ? _modelData->_bounds : Math::AABB {};
+    }
+
+    Math::BoundingSphere ModelHandle::getBoundingSphere() const {
+        return _modelData ? _modelData->_boundingSphere : Math::BoundingSphere {};
+    }
+
+    Graphics::MeshOptimizationStats ModelHandle::getOptimizationStats() const {
+        return _modelData ? _modelData->_optimization : Graphics::MeshOptimizationStats {};
+    }
+
+    void ModelHandle::retainOccluder() const {
+        if (_modelData) { _modelData->retainOccluder(); }
+    }
+
+    std::span<const glm::vec3> ModelHandle::getOccluderVertices() const {
+        if (!_modelData || !_modelData->_occluderReady.load(std::memory_order_acquire)) {
+            return {};
+        }
+        return _modelData->_occluderVertices;
+    }
+
+    std::span<const u32> ModelHandle::getOccluderIndices() const {
+        if (!_modelData || !_modelData->_occluderReady.load(std::memory_order_acquire)) {
+            return {};
+        }
+        return _modelData->_occluderIndices;
+    }
+
+    void ModelData::submit(Graphics::RenderQueue& queue,
+                           const CameraState& camera,
+                           const TransformComponent& transform) {
+        if (!_pendingMeshes.empty() && !upload()) { return; }
 
-        _material->apply(matrices);
-        lighting.sun.updateUniforms(_material);
+        const u32 material = CAST<u32>(RCAST<uintptr_t>(_material.get()) >> 4);
+        const f32 depth    = glm::length(transform.getPosition() - camera.position);
 
-        for (const auto& mesh : _meshes) {
-            mesh->draw();
+        for (u32 i = 0; i < _meshes.size(); i++) {
+            const auto& mesh = _meshes[i];
+            auto packet      = makePacket(*mesh, selectLod(i, camera, transform));
+            packet.transform = transform.getAffine() * mesh->getDequantization();
+            // Every mesh shares the pool's vertex array, so key on where the mesh starts instead.
+            // Scrambled so the key's 16 mesh bits tell nearby offsets apart.
+            const u32 meshKey = (packet.firstIndex * 0x9E3779B1u) >> 16;
+            packet.key        = Graphics::RenderQueue::makeKey(Graphics::RenderPass::Opaque,
+                                                        packet.program,
+                                                        material,
+                                                        meshKey,
+                                                        depth);
+            queue.submit(packet);
         }
     }
 
-    bool ModelData::loadFromFile(const str& filename) {
-        auto program = ShaderManager::instance().getShaderProgram(PBR_VS_Source, PBR_FS_Source);
-        if (!program) { return false; }
-        _material = std::make_shared<PBRMaterial>(program);
+    void ModelData::submit(Graphics::RenderQueue& queue, const Graphics::RenderCommand& command) {
+        if (!_pendingMeshes.empty() && !upload()) { return; }
+        if (command.mesh >= _meshes.size()) { return; }
+
+        const auto& mesh = *_meshes[command.mesh];
+        auto packet      = makePacket(mesh, command.lod);
+        packet.key       = command.key;
+        packet.transform = command.transform * mesh.getDequantization();
+        queue.submit(packet);
+    }
+
+    Graphics::DrawPacket ModelData::makePacket(const Mesh& mesh, u32 lod) const {
+        // Prefer the instanced variant so copies of this model collapse into one multi-draw
+        const auto& instancedProgram = _material->getInstancedShaderProgram();
+
+        Graphics::DrawPacket packet;
+        packet.program     = instancedProgram ? instancedProgram->getId()
+                                              : _material->getShaderProgram()->getId();
+        packet.vertexArray = mesh.getVertexArrayId();
+        packet.indexBuffer = mesh.getIndexBufferId();
+        packet.indexCount  = mesh.getLod(lod).indexCount;
+        packet.firstIndex  = mesh.getGeometryRange().firstIndex + mesh.getLod(lod).firstIndex;
+        packet.baseVertex  = mesh.getGeometryRange().baseVertex;
+        packet.flags       = instancedProgram ? CAST<u32>(Graphics::Instanced) : 0u;
+        packet.material    = _material.get();
+        return packet;
+    }
+
+    u32 ModelData::selectLod(u32 mesh,
+                             const CameraState& camera,
+                             const TransformComponent& transform) const {
+        if (mesh >= _meshLods.size() || _meshLods[mesh].size() < 2) { return 0; }
+
+        // Distance to the nearest point of the bounding sphere, so large models refine as soon
+        // as any part of them comes close
+        const auto& affine = transform.getAffine();
+        f32 scale          = 0.f;
+        for (u32 axis = 0; axis < 3; axis++) {
+            scale = std::max(scale,
+                             glm::length(glm::vec3(affine.rows[0][axis],
+                                                   affine.rows[1][axis],
+                                                   affine.rows[2][axis])));
+        }
+        const glm::vec3 center = affine.transformPoint(_boundingSphere.center);
+        const f32 distance =
+          glm::length(center - camera.position) - _boundingSphere.radius * scale;
+        return Graphics::selectLod(_meshLods[mesh],
+                                   scale,
+                                   distance,
+                                   camera.projection[1][1],
+                                   kLodScreenError);
+    }
 
+    bool ModelData::importFromFile(const str& filename) {
         Assimp::Importer importer;
         const auto* scene = importer.ReadFile(filename.c_str(),
                                               aiProcess_Triangulate | aiProcess_GenNormals |
@@ -74,21 +206,132 @@ namespace x {
         }
         processNode(scene->mRootNode, scene);
 
+        // Triangle weighted, so the model's ACMR is the one its meshes add up to
+        f32 missesBefore = 0.f;
+        f32 missesAfter  = 0.f;
+        for (const auto& mesh : _pendingMeshes) {
+            _bounds.expand(mesh.bounds);
+            const auto triangles = CAST<f32>(mesh.optimization.triangles);
+            _optimization.triangles += mesh.optimization.triangles;
+            _optimization.verticesBefore += mesh.optimization.verticesBefore;
+            _optimization.verticesAfter += mesh.optimization.verticesAfter;
+            missesBefore += mesh.optimization.acmrBefore * triangles;
+            missesAfter += mesh.optimization.acmrAfter * triangles;
+        }
+        if (_optimization.triangles > 0) {
+            _optimization.acmrBefore = missesBefore / CAST<f32>(_optimization.triangles);
+            _optimization.acmrAfter  = missesAfter / CAST<f32>(_optimization.triangles);
+        }
+        if (_bounds.valid()) {
+            // Enclose the mesh spheres, but never exceed the sphere around the box
+            _boundingSphere = Math::BoundingSphere::fromAABB(_bounds);
+            f32 radius      = 0.f;
+            for (const auto& mesh : _pendingMeshes) {
+                radius = std::max(radius,
+                                  glm::length(mesh.sphere.center - _boundingSphere.center) +
+                                    mesh.sphere.radius);
+            }
+            _boundingSphere.radius = std::min(_boundingSphere.radius, radius);
+        }
+
+        for (const auto& mesh : _pendingMeshes) {
+            _meshLods.push_back(mesh.lods);
+        }
+
+        _assetPath = filename;
+        _assetId   = ModelManager::getAssetId(filename);
+        _meshCount = CAST<u32>(_pendingMeshes.size());
+        _imported.store(_meshCount > 0, std::memory_order_release);
+        return true;
+    }
+
+    bool ModelData::upload() {
+        if (!_material) {
+            auto program =
+              ShaderManager::instance().getShaderProgram(PBR_VS_Source, PBR_FS_Source);
+            if (!program) { return false; }
+            auto instancedProgram =
+              ShaderManager::instance().getShaderProgram(PBR_Instanced_VS_Source, PBR_FS_Source);
+            _material = std::make_shared<PBRMaterial>(program, instancedProgram);
+        }
+
+        const auto pool = ModelManager::instance().getGeometryPool();
+        _meshes.reserve(_meshes.size() + _pendingMeshes.size());
+        for (const auto& mesh : _pendingMeshes) {
+            _meshes.push_back(std::make_unique<Mesh>(
+              pool,
+              mesh.vertices,
+              mesh.indices,
+              mesh.lods,
+              mesh.dequantize,
+              mesh.bounds,
+              mesh.sphere));
+        }
+        std::lock_guard lock(_pendingMutex);
+        _pendingMeshes.clear();
+        _pendingMeshes.shrink_to_fit();
         return true;
     }
 
+    void ModelData::retainOccluder() {
+        std::lock_guard lock(_pendingMutex);
+        if (_occluderRequested) { return; }
+        _occluderRequested = true;
+
+        if (!_pendingMeshes.empty()) {
+            buildOccluder(_pendingMeshes);
+            return;
+        }
+        // The packed meshes are dropped on upload, so an uploaded model is imported again. Only
+        // occluders pay for that, once, and on a worker so the caller's tick doesn't wait for it.
+        if (_assetPath.empty()) { return; }
+        _occluderImport = std::async(std::launch::async, [this] {
+            ModelData source;
+            if (source.importFromFile(_assetPath)) { buildOccluder(source._pendingMeshes); }
+        });
+    }
+
+    void ModelData::buildOccluder(const std::vector<MeshData>& meshes) {
+        // Positions only, decoded from the packed vertices. Only the full detail level is exact
+        // enough to occlude.
+        for (const auto& mesh : meshes) {
+            const auto base = CAST<u32>(_occluderVertices.size());
+            for (const auto& vertex : mesh.vertices) {
+                const auto decoded = Graphics::unpackVertex(vertex, mesh.dequantize);
+                _occluderVertices.push_back(decoded.position);
+            }
+            for (u32 i = 0; i < mesh.lods.front().indexCount; i++) {
+                _occluderIndices.push_back(base + mesh.indices[i]);
+            }
+        }
+        Math::OcclusionBuffer::prepareOccluder(_occluderVertices, _occluderIndices);
+        _occluderReady.store(true, std::memory_order_release);
+    }
+
     bool ModelHandle::valid() const {
         return _modelData && _modelData->valid();
     }
 
+    u64 ModelHandle::getAssetId() const {
+        return _modelData ? _modelData->_assetId : 0;
+    }
+
+    str ModelHandle::getAssetPath() const {
+        return _modelData ? _modelData->_assetPath : str {};
+    }
+
+    u32 ModelHandle::getDrawId() const {
+        return _modelData ? _modelData->_drawId : kNoDrawId;
+    }
+
     bool ModelData::valid() const {
-        return !_meshes.empty();
+        return _imported.load(std::memory_order_acquire);
     }
 
     void ModelData::processNode(const aiNode* node, const aiScene* scene) {
         for (u32 i = 0; i < node->mNumMeshes; i++) {
             aiMesh* mesh = scene->mMeshes[node->mMeshes[i]];
-            _meshes.push_back(processMesh(mesh, scene));
+            _pendingMeshes.push_back(processMesh(mesh, scene));
         }
 
         for (u32 i = 0; i < node->mNumChildren; i++) {
@@ -96,9 +339,12 @@ namespace x {
         }
     }
 
-    std::unique_ptr<Mesh> ModelData::processMesh(aiMesh* mesh, const aiScene*) {
+    ModelData::MeshData ModelData::processMesh(aiMesh* mesh, const aiScene*) {
+        MeshData data;
         std::vector<Graphics::VertexPosNormTanBiTanTex> vertices;
-        std::vector<u32> indices;
+        auto& indices = data.indices;
+        vertices.reserve(mesh->mNumVertices);
+        indices.reserve(CAST<size_t>(mesh->mNumFaces) * 3);
 
         for (u32 i = 0; i < mesh->mNumVertices; i++) {
             Graphics::VertexPosNormTanBiTanTex vertex = {};
@@ -106,6 +352,7 @@ namespace x {
             vertex.position.x = mesh->mVertices[i].x;
             vertex.position.y = mesh->mVertices[i].y;
             vertex.position.z = mesh->mVertices[i].z;
+            data.bounds.expand(vertex.position);
 
             vertex.normal.x = mesh->mNormals[i].x;
             vertex.normal.y = mesh->mNormals[i].y;
@@ -130,16 +377,25 @@ namespace x {
             vertices.push_back(vertex);
         }
 
+        // Meshes are drawn as triangle lists; points and lines left by triangulation are dropped
         for (u32 i = 0; i < mesh->mNumFaces; i++) {
-            aiFace face = mesh->mFaces[i];
-            for (u32 j = 0; j < face.mNumIndices; j++) {
-                indices.push_back(face.mIndices[j]);
+            const aiFace& face = mesh->mFaces[i];
+            if (face.mNumIndices != 3) { continue; }
+            indices.insert(indices.end(), face.mIndices, face.mIndices + 3);
+        }
+        data.optimization = Graphics::optimizeMesh(vertices, indices);
+        data.lods         = Graphics::generateLods(vertices, indices);
+
+        // Centered on the box, sized to the farthest vertex; tighter than the box's own sphere
+        if (data.bounds.valid()) {
+            data.sphere.center = data.bounds.getCenter();
+            for (const auto& vertex : vertices) {
+                data.sphere.radius =
+                  std::max(data.sphere.radius, glm::length(vertex.position - data.sphere.center));
             }
         }
+        data.dequantize = Graphics::packVertices(vertices, data.bounds, data.vertices);
 
-        return std::make_unique<Mesh>(
-          Graphics::VertexAttributes::VertexPosition3_Normal3_Tangent3_BiTangent3_Tex2,
-          vertices,
-          indices);
+        return data;
     }
 }  // namespace x
\ No newline at end of file
@@ -12,7 +12,16 @@
 #include "LightingState.hpp"
 #include "Material.hpp"
 #include "TransformComponent.hpp"
+#include "Graphics/MeshOptimizer.hpp"
+#include "Graphics/RenderCommandList.hpp"
+#include "Graphics/RenderQueue.hpp"
+#include "Math/Bounds.hpp"
 
+#include <atomic>
+#include <future>
+#include <limits>
+#include <mutex>
+#include <span>
 #include <vector>
 #include <assimp/mesh.h>
 #include <assimp/scene.h>
@@ -22,20 +31,53 @@ namespace x {
     class ModelHandle;  // Copyable wrapper used by the ECS
 
     class ModelHandle {
+        friend class ModelManager;
+
     public:
+        static constexpr u32 kNoDrawId = std::numeric_limits<u32>::max();
+
         ModelHandle() = default;
 
         static ModelHandle loadFromFile(const str& filename);
+        /// @brief Reads the model into CPU memory without touching the GL context, so it is safe to
+        /// call from worker threads. GPU resources are created on first draw.
+        static ModelHandle importFromFile(const str& filename);
         static ModelHandle loadFromMemory(const std::vector<u8>& data);
         [[nodiscard]] static bool tryLoad(const str& filename, ModelHandle& outHandle);
 
-        void draw(const CameraState& camera,
-                  const LightingState& lighting,
-                  const TransformComponent& transform) const;
+        /// @brief Adds a draw packet per mesh to the queue.
+        void submit(Graphics::RenderQueue& queue,
+                    const CameraState& camera,
+                    const TransformComponent& transform) const;
+        /// @brief Records a command per mesh into the given list of commands. Needs no GL
+        /// context; the model is uploaded when the render thread decodes the commands.
+        void record(Graphics::RenderCommandList& commands,
+                    size_t list,
+                    const CameraState& camera,
+                    const TransformComponent& transform) const;
         void release();
 
         std::shared_ptr<IMaterial> getMaterial() const;
+        /// @brief Model space bounds of all meshes. Invalid (empty) if the handle is.
+        [[nodiscard]] Math::AABB getBounds() const;
+        [[nodiscard]] Math::BoundingSphere getBoundingSphere() const;
+        /// @brief What import-time mesh optimization did to all meshes combined, ACMR weighted
+        /// by triangle count. Zeroed if the handle is invalid.
+        [[nodiscard]] Graphics::MeshOptimizationStats getOptimizationStats() const;
+        /// @brief Keeps model space positions and triangle indices of all meshes on the CPU for
+        /// the software occlusion rasterizer. Only models used as occluders need them, so they
+        /// are built on the first call. A model already uploaded imports its file again on a
+        /// worker thread, and the geometry stays empty until that finishes.
+        void retainOccluder() const;
+        /// @brief The geometry kept by retainOccluder(). Empty until then.
+        [[nodiscard]] std::span<const glm::vec3> getOccluderVertices() const;
+        [[nodiscard]] std::span<const u32> getOccluderIndices() const;
         [[nodiscard]] bool valid() const;
+        /// @brief Hash of the source path, used to reference the model from scene files.
+        [[nodiscard]] u64 getAssetId() const;
+        [[nodiscard]] str getAssetPath() const;
+        /// @brief ID recorded in render commands, see ModelManager::submit. kNoDrawId if invalid.
+        [[nodiscard]] u32 getDrawId() const;
 
     private:
         std::shared_ptr<ModelData> _modelData;
@@ -43,21 +85,64 @@ namespace x {
 
     class ModelData {
         friend class ModelHandle;
+        friend class ModelManager;
 
     public:
         ModelData() = default;
         [[nodiscard]] bool valid() const;
 
     private:
+        static constexpr f32 kLodScreenError = 1.f / 1080.f;  // About a pixel at 1080p
+
+        /// @brief CPU side geometry waiting to be uploaded
+        struct MeshData {
+            std::vector<Graphics::VertexPacked> vertices;
+            std::vector<u32> indices;  // Every level of detail, one after the other
+            std::vector<Graphics::MeshLod> lods;
+            Math::AffineTransform dequantize;
+            Graphics::MeshOptimizationStats optimization;
+            Math::AABB bounds;
+            Math::BoundingSphere sphere;
+        };
+
         std::vector<std::unique_ptr<Mesh>> _meshes;
+        std::vector<MeshData> _pendingMeshes;
         std::shared_ptr<IMaterial> _material;
+        Math::AABB _bounds;  // Known at import, before the meshes are uploaded
+        Math::BoundingSphere _boundingSphere;
+        Graphics::MeshOptimizationStats _optimization;
+        // Built at most once, by retainOccluder(), then only read
+        std::vector<glm::vec3> _occluderVertices;
+        std::vector<u32> _occluderIndices;
+        std::atomic<bool> _occluderReady = false;
+        bool _occluderRequested          = false;  // Guarded by _pendingMutex
+        std::mutex _pendingMutex;  // retainOccluder() reads pending meshes the upload drops
+        str _assetPath;
+        u64 _assetId   = 0;
+        u32 _drawId    = ModelHandle::kNoDrawId;
+        u32 _meshCount = 0;  // Fixed at import, unlike _meshes which fills on upload
+        // Set once import produced geometry. valid() reads only this, because worker threads
+        // query models while the render thread moves meshes from _pendingMeshes to _meshes.
+        std::atomic<bool> _imported = false;
+        std::vector<std::vector<Graphics::MeshLod>> _meshLods;  // Per mesh, also fixed at import
+        // Re-import for retainOccluder(). Declared last, so destroying the model waits for it
+        // before the members it writes go away.
+        std::future<void> _occluderImport;
 
-        void draw(const CameraState& camera,
-                  const LightingState& lighting,
-                  const TransformComponent& transform);
-        bool loadFromFile(const str& filename);
+        void submit(Graphics::RenderQueue& queue,
+                    const CameraState& camera,
+                    const TransformComponent& transform);
+        void submit(Graphics::RenderQueue& queue, const Graphics::RenderCommand& command);
+        [[nodiscard]] Graphics::DrawPacket makePacket(const Mesh& mesh, u32 lod) const;
+        [[nodiscard]] u32 selectLod(u32 mesh,
+                                    const CameraState& camera,
+                                    const TransformComponent& transform) const;
+        bool importFromFile(const str& filename);
+        bool upload();
+        void retainOccluder();
+        void buildOccluder(const std::vector<MeshData>& meshes);
         void processNode(const aiNode* node, const aiScene* scene);
 
-        static std::unique_ptr<Mesh> processMesh(aiMesh* mesh, const aiScene* scene);
+        static MeshData processMesh(aiMesh* mesh, const aiScene* scene);
     };
 }  // namespace x
@@ -0,0 +1,100 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "ModelManager.hpp"
+
+#include <xxhash.h>
+
+namespace x {
+    ModelManager& ModelManager::instance() {
+        static ModelManager instance;
+        return instance;
+    }
+
+    u64 ModelManager::getAssetId(const str& path) {
+        const XXH64_hash_t hash = XXH64(path.c_str(), path.size(), 0);
+        return hash;
+    }
+
+    ModelHandle ModelManager::getModel(const str& path) {
+        return getModel(getAssetId(path), path);
+    }
+
+    ModelHandle ModelManager::getModel(u64 assetId, const str& path) {
+        if (auto model = findModel(assetId); model.valid()) { return model; }
+        return insert(assetId, ModelHandle::loadFromFile(path));
+    }
+
+    ModelHandle ModelManager::importModel(u64 assetId, const str& path) {
+        if (auto model = findModel(assetId); model.valid()) { return model; }
+        return insert(assetId, ModelHandle::importFromFile(path));
+    }
+
+    ModelHandle ModelManager::findModel(u64 assetId) const {
+        std::lock_guard lock(_mutex);
+        const auto it = _cache.find(assetId);
+        if (it != _cache.end()) { return it->second; }
+        return {};
+    }
+
+    std::shared_ptr<Graphics::GeometryPool> ModelManager::getGeometryPool() {
+        std::lock_guard lock(_mutex);
+        if (!_geometryPool) {
+            _geometryPool = std::make_shared<Graphics::GeometryPool>(
+              Graphics::VertexAttributes::VertexPackedPosition4_Normal2_Tangent2_Tex2,
+              CAST<u32>(sizeof(Graphics::VertexPacked)),
+              kInitialPoolVertices,
+              kInitialPoolIndices);
+        }
+        return _geometryPool;
+    }
+
+    u32 ModelManager::registerModel(const ModelHandle& model) {
+        if (!model._modelData) { return ModelHandle::kNoDrawId; }
+
+        std::lock_guard lock(_drawTableMutex);
+        if (model._modelData->_drawId == ModelHandle::kNoDrawId) {
+            model._modelData->_drawId = CAST<u32>(_drawTable.size());
+            _drawTable.push_back(model._modelData);
+        }
+        return model._modelData->_drawId;
+    }
+
+    void ModelManager::submit(std::span<const Graphics::RenderCommand> commands,
+                              Graphics::RenderQueue& queue) const {
+        std::lock_guard lock(_drawTableMutex);
+
+        // Commands are sorted, so the meshes of a model arrive together
+        u32 drawId = ModelHandle::kNoDrawId;
+        std::shared_ptr<ModelData> model;
+        for (const auto& command : commands) {
+            if (command.model != drawId) {
+                drawId = command.model;
+                model  = drawId < _drawTable.size() ? _drawTable[drawId].lock() : nullptr;
+            }
+            if (model) { model->submit(queue, command); }
+        }
+    }
+
+    void ModelManager::clear() {
+        {
+            std::lock_guard lock(_drawTableMutex);
+            // Handles may outlive the cache; their stale IDs must not alias new models
+            for (const auto& entry : _drawTable) {
+                if (const auto model = entry.lock()) { model->_drawId = ModelHandle::kNoDrawId; }
+            }
+            _drawTable.clear();
+        }
+        std::lock_guard lock(_mutex);
+        _cache.clear();
+        _geometryPool.reset();
+    }
+
+    ModelHandle ModelManager::insert(u64 assetId, const ModelHandle& model) {
+        if (!model.valid()) { return model; }
+        // The model is loaded outside the lock, so another thread may have beaten us to it
+        std::lock_guard lock(_mutex);
+        return _cache.try_emplace(assetId, model).first->second;
+    }
+}  // namespace x
@@ -0,0 +1,74 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "Model.hpp"
+#include "Graphics/GeometryPool.hpp"
+#include "Graphics/RenderCommandList.hpp"
+
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace x {
+    /// @brief Loads models once and hands out shared handles keyed by asset ID (a hash of the
+    /// source path). Scene files reference models by this ID rather than by path string.
+    ///
+    /// The cache is safe to use from any thread, but only getModel() may create GPU resources and
+    /// must be called from the thread that owns the GL context. Worker threads use importModel().
+    class ModelManager {
+    public:
+        ModelManager(const ModelManager&)            = delete;
+        ModelManager& operator=(const ModelManager&) = delete;
+        ModelManager(ModelManager&&)                 = delete;
+        ModelManager& operator=(ModelManager&&)      = delete;
+
+        static ModelManager& instance();
+        static u64 getAssetId(const str& path);
+
+        /// @brief Returns the cached model for path, loading it on first use.
+        ModelHandle getModel(const str& path);
+        /// @brief Returns the cached model for assetId, loading it from path on a cache miss.
+        ModelHandle getModel(u64 assetId, const str& path);
+        /// @brief Like getModel(), but a cache miss only imports the model into CPU memory. The
+        /// GPU upload is deferred to the model's first draw.
+        ModelHandle importModel(u64 assetId, const str& path);
+        /// @brief Returns the cached model or an invalid handle. Never touches the disk.
+        [[nodiscard]] ModelHandle findModel(u64 assetId) const;
+
+        /// @brief The pool every model mesh is uploaded to, created on first use. Call from the
+        /// thread that owns the GL context.
+        std::shared_ptr<Graphics::GeometryPool> getGeometryPool();
+
+        /// @brief Gives model a compact ID that render commands refer to it by. Called by
+        /// ModelHandle once the model is imported.
+        u32 registerModel(const ModelHandle& model);
+        /// @brief Decodes sorted render commands into draw packets, in order. Models that were
+        /// only imported are uploaded here, so call from the thread that owns the GL context.
+        void submit(std::span<const Graphics::RenderCommand> commands,
+                    Graphics::RenderQueue& queue) const;
+
+        /// @brief Drops every cached model, the draw IDs and the manager's reference to the
+        /// geometry pool. Call before the GL context is destroyed.
+        void clear();
+
+    private:
+        static constexpr u32 kInitialPoolVertices = 1 << 18;  // Both grow as models load
+        static constexpr u32 kInitialPoolIndices  = 1 << 20;
+
+        ModelManager() = default;
+
+        std::unordered_map<u64, ModelHandle> _cache;
+        std::shared_ptr<Graphics::GeometryPool> _geometryPool;
+        mutable std::mutex _mutex;
+        // Indexed by draw ID. Separate lock, since uploading a model takes _mutex for the pool
+        std::vector<std::weak_ptr<ModelData>> _drawTable;
+        mutable std::mutex _drawTableMutex;
+
+        ModelHandle insert(u64 assetId, const ModelHandle& model);
+    };
+}  // namespace x
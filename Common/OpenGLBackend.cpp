@@ -0,0 +1,145 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "OpenGLBackend.hpp"
+#include "Material.hpp"
+#include "Graphics/DebugOpenGL.hpp"
+#include "Graphics/GLState.hpp"
+#include "Graphics/RenderStats.hpp"
+
+#include <glad.h>
+
+namespace x {
+    OpenGLBackend::~OpenGLBackend() {
+        release();
+    }
+
+    void OpenGLBackend::beginFrame(const CameraState& camera, const LightingState& lighting) {
+        if (!_stream) {
+            _stream =
+              std::make_unique<Graphics::StreamingBuffer>(_streamBackend, kStreamRegionSize);
+        }
+        _stream->beginFrame();
+
+        Graphics::FrameBlock frame;
+        frame.view           = camera.view;
+        frame.projection     = camera.projection;
+        frame.viewProjection = camera.projection * camera.view;
+        frame.cameraPosition = glm::vec4(camera.position, 1.f);
+        Graphics::OpenGLStreamingBackend::bindRange(GL_UNIFORM_BUFFER,
+                                                    Graphics::UniformBinding::Frame,
+                                                    _stream->write(frame));
+
+        Graphics::LightingBlock lights {};
+        lights.sunDirection = lighting.sun.getDirection();
+        lights.sunColor     = lighting.sun.getColor();
+        lights.sunIntensity = lighting.sun.getIntensity();
+        Graphics::OpenGLStreamingBackend::bindRange(GL_UNIFORM_BUFFER,
+                                                    Graphics::UniformBinding::Lighting,
+                                                    _stream->write(lights));
+    }
+
+    void OpenGLBackend::bindProgram(u32 program) {
+        Graphics::GLState::current().useProgram(program);
+    }
+
+    void OpenGLBackend::bindMaterial(const Graphics::DrawPacket& packet) {
+        auto* material = CAST<IMaterial*>(packet.material);
+        // Instanced variants read their material parameters from the instance buffer
+        if (!(packet.flags & Graphics::Instanced)) { material->applyMaterial(); }
+
+        // Units that already hold the texture are skipped by the state tracker
+        for (const auto& [slot, weakTexture] : material->getTextures()) {
+            if (const auto texture = weakTexture.lock()) { texture->bind(slot); }
+        }
+    }
+
+    void OpenGLBackend::bindVertexArray(const Graphics::DrawPacket& packet) {
+        // The index buffer is captured in the vertex array
+        Graphics::GLState::current().bindVertexArray(packet.vertexArray);
+    }
+
+    void OpenGLBackend::draw(const Graphics::DrawPacket& packet) {
+        Graphics::ObjectBlock object;
+        object.model = packet.transform.toMat4();
+        // The columns of the inverse transpose are the rows of the inverse
+        const auto inverse = Math::inverse(packet.transform);
+        for (i32 i = 0; i < 3; i++) {
+            object.normalMatrix[i] = glm::vec4(glm::vec3(inverse.rows[i]), 0.f);
+        }
+        Graphics::OpenGLStreamingBackend::bindRange(GL_UNIFORM_BUFFER,
+                                                    Graphics::UniformBinding::Object,
+                                                    _stream->write(object));
+
+        const uintptr_t indexOffset = CAST<uintptr_t>(packet.firstIndex) * sizeof(u32);
+        glDrawElementsBaseVertex(GL_TRIANGLES,
+                                 CAST<GLsizei>(packet.indexCount),
+                                 GL_UNSIGNED_INT,
+                                 RCAST<const void*>(indexOffset),
+                                 CAST<GLint>(packet.baseVertex));
+        CHECK_GL_ERROR();
+        Graphics::RenderStats::current().recordDraw(packet.indexCount);
+    }
+
+    void OpenGLBackend::drawInstanced(std::span<const Graphics::DrawPacket> packets) {
+        const auto* material = CAST<const IMaterial*>(packets[0].material);
+        const size_t stride  = material->getInstanceDataSize();
+
+        // One command per run of the same mesh. baseInstance points the run at its instance data,
+        // which the shader reads at gl_BaseInstance + gl_InstanceID.
+        size_t commandCount = 1;
+        u64 indexCount      = packets[0].indexCount;
+        for (size_t i = 1; i < packets.size(); i++) {
+            if (!Graphics::isSameMesh(packets[i - 1], packets[i])) { commandCount++; }
+            indexCount += packets[i].indexCount;
+        }
+
+        // Instances and commands share one allocation, so a grow of the ring can't move one of
+        // them away from the other
+        constexpr size_t kCommandAlignment = alignof(Graphics::DrawElementsIndirectCommand);
+        const size_t instanceSize =
+          (stride * packets.size() + kCommandAlignment - 1) / kCommandAlignment * kCommandAlignment;
+        const size_t commandSize = commandCount * sizeof(Graphics::DrawElementsIndirectCommand);
+        auto allocation          = _stream->allocate(instanceSize + commandSize);
+
+        // Written straight into the mapped ring, no staging copy
+        auto* instances = CAST<u8*>(allocation.data);
+        for (size_t i = 0; i < packets.size(); i++) {
+            material->writeInstanceData(packets[i].transform, instances + i * stride);
+        }
+        const size_t commandOffset = allocation.offset + instanceSize;
+        allocation.size            = instanceSize;
+        Graphics::OpenGLStreamingBackend::bindRange(GL_SHADER_STORAGE_BUFFER,
+                                                    kInstanceBufferBinding,
+                                                    allocation);
+
+        // Commands are written whole; reading back from the mapped ring would be slow
+        auto* commands = RCAST<Graphics::DrawElementsIndirectCommand*>(instances + instanceSize);
+        for (size_t begin = 0, command = 0; begin < packets.size(); command++) {
+            size_t end = begin + 1;
+            while (end < packets.size() && Graphics::isSameMesh(packets[begin], packets[end])) {
+                end++;
+            }
+            commands[command] = {packets[begin].indexCount,
+                                 CAST<u32>(end - begin),
+                                 packets[begin].firstIndex,
+                                 CAST<i32>(packets[begin].baseVertex),
+                                 CAST<u32>(begin)};
+            begin             = end;
+        }
+        Graphics::GLState::current().bindBuffer(GL_DRAW_INDIRECT_BUFFER, allocation.buffer);
+
+        glMultiDrawElementsIndirect(GL_TRIANGLES,
+                                    GL_UNSIGNED_INT,
+                                    RCAST<const void*>(CAST<uintptr_t>(commandOffset)),
+                                    CAST<GLsizei>(commandCount),
+                                    0);
+        CHECK_GL_ERROR();
+        Graphics::RenderStats::current().recordMultiDraw(indexCount);
+    }
+
+    void OpenGLBackend::release() {
+        _stream.reset();
+    }
+}  // namespace x
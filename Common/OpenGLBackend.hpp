@@ -0,0 +1,50 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "CameraState.hpp"
+#include "LightingState.hpp"
+#include "Graphics/GeometryPool.hpp"
+#include "Graphics/OpenGLStreamingBackend.hpp"
+#include "Graphics/RenderQueue.hpp"
+#include "Graphics/UniformBlocks.hpp"
+
+#include <memory>
+
+namespace x {
+    /// @brief Submits a flushed RenderQueue to OpenGL. DrawPacket::material must point to an
+    /// IMaterial. Binds go through Graphics::GLState, so a material only rebinds textures that
+    /// changed.
+    ///
+    /// All per frame data lives in a Graphics::StreamingBuffer. Camera and lighting blocks are
+    /// written once in beginFrame(); each draw writes and binds its own object block. Instanced
+    /// batches are written to a range bound at kInstanceBufferBinding, laid out by
+    /// IMaterial::writeInstanceData, and drawn with a single glMultiDrawElementsIndirect whose
+    /// commands are streamed the same way.
+    class OpenGLBackend final : public Graphics::IRenderBackend {
+    public:
+        static constexpr u32 kInstanceBufferBinding = 0;
+
+        ~OpenGLBackend() override;
+
+        /// @brief Call before each flush. Uploads the per frame uniform blocks.
+        void beginFrame(const CameraState& camera, const LightingState& lighting);
+
+        void bindProgram(u32 program) override;
+        void bindMaterial(const Graphics::DrawPacket& packet) override;
+        void bindVertexArray(const Graphics::DrawPacket& packet) override;
+        void draw(const Graphics::DrawPacket& packet) override;
+        void drawInstanced(std::span<const Graphics::DrawPacket> packets) override;
+        /// @brief Frees GPU resources. Must be called while the context is still current.
+        void release();
+
+    private:
+        static constexpr size_t kStreamRegionSize = 1024 * 1024;  // Grows if a frame needs more
+
+        Graphics::OpenGLStreamingBackend _streamBackend;
+        std::unique_ptr<Graphics::StreamingBuffer> _stream;
+    };
+}  // namespace x
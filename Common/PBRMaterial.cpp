@@ -5,22 +5,31 @@
 #include "PBRMaterial.hpp"
 
 namespace x {
-    void PBRMaterial::apply(const TransformMatrices& matrices) {
-        _shaderProgram->use();
-
-        setUniform("M", matrices.model);
-        setUniform("V", matrices.view);
-        setUniform("P", matrices.projection);
-        setUniform("MV", matrices.modelView);
-        setUniform("VP", matrices.viewProjection);
-        setUniform("MVP", matrices.modelViewProjection);
-
+    void PBRMaterial::applyMaterial() {
         setUniform("uMaterial.albedo", _albedo);
         setUniform("uMaterial.metallic", _metallic);
         setUniform("uMaterial.roughness", _roughness);
         setUniform("uMaterial.ao", _ao);
     }
 
+    size_t PBRMaterial::getInstanceDataSize() const {
+        return sizeof(PBRInstanceData);
+    }
+
+    void PBRMaterial::writeInstanceData(const Math::AffineTransform& transform,
+                                        void* destination) const {
+        auto* instance = CAST<PBRInstanceData*>(destination);
+        // The rows of the inverse transpose are the columns of the inverse
+        const auto inverse = Math::inverse(transform);
+        for (i32 i = 0; i < 3; i++) {
+            instance->model[i]  = transform.rows[i];
+            instance->normal[i] =
+              glm::vec4(inverse.rows[0][i], inverse.rows[1][i], inverse.rows[2][i], 0.f);
+        }
+        instance->albedoMetallic = glm::vec4(_albedo, _metallic);
+        instance->roughnessAo    = glm::vec4(_roughness, _ao, 0.f, 0.f);
+    }
+
     void PBRMaterial::setAlbedo(const glm::vec3& albedo) {
         _albedo = albedo;
     }
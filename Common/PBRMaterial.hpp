@@ -7,11 +7,26 @@
 #include "Material.hpp"
 
 namespace x {
+    /// @brief Instance buffer element of PBR_Instanced_VS, laid out for std430
+    struct PBRInstanceData {
+        glm::vec4 model[3];   // Rows of the 3x4 affine model matrix
+        glm::vec4 normal[3];  // Rows of the inverse transpose of the model matrix, xyz only
+        glm::vec4 albedoMetallic;
+        glm::vec4 roughnessAo;
+    };
+
+    static_assert(sizeof(PBRInstanceData) == 128);
+
     class PBRMaterial final : public IMaterial {
     public:
-        explicit PBRMaterial(const std::shared_ptr<Graphics::ShaderProgram>& shader)
-            : IMaterial(shader) {}
-        void apply(const TransformMatrices& matrices) override;
+        explicit PBRMaterial(
+          const std::shared_ptr<Graphics::ShaderProgram>& shader,
+          const std::shared_ptr<Graphics::ShaderProgram>& instancedShader = nullptr)
+            : IMaterial(shader, instancedShader) {}
+        void applyMaterial() override;
+        [[nodiscard]] size_t getInstanceDataSize() const override;
+        void writeInstanceData(const Math::AffineTransform& transform,
+                               void* destination) const override;
 
         void setAlbedo(const glm::vec3& albedo);
         void setMetallic(f32 metallic);
@@ -0,0 +1,57 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "Prefab.hpp"
+#include "Panic.hpp"
+
+#include <algorithm>
+
+namespace x {
+    u32 Prefab::addNode(u32 parent, const Math::AffineTransform& local) {
+        if (parent != kNoParent && parent >= _nodes.size()) {
+            Panic("Prefab parent node %u does not exist", parent);
+        }
+        _nodes.push_back({parent, local});
+        return CAST<u32>(_nodes.size() - 1);
+    }
+
+    void Prefab::addTransform(u32 node) {
+        if (node >= _nodes.size()) { Panic("Prefab node %u does not exist", node); }
+        if (std::find(_transformNodes.begin(), _transformNodes.end(), node) !=
+            _transformNodes.end()) {
+            Panic("Prefab node %u already has a TransformComponent", node);
+        }
+        _transformNodes.push_back(node);
+    }
+
+    RenderComponent& Prefab::addRenderer(u32 node) {
+        if (node >= _nodes.size()) { Panic("Prefab node %u does not exist", node); }
+        if (std::find(_rendererNodes.begin(), _rendererNodes.end(), node) !=
+            _rendererNodes.end()) {
+            Panic("Prefab node %u already has a RenderComponent", node);
+        }
+        _rendererNodes.push_back(node);
+        return _renderers.emplace_back();
+    }
+
+    size_t Prefab::getNodeCount() const {
+        return _nodes.size();
+    }
+
+    std::span<const Prefab::Node> Prefab::getNodes() const {
+        return _nodes;
+    }
+
+    std::span<const u32> Prefab::getTransformNodes() const {
+        return _transformNodes;
+    }
+
+    std::span<const u32> Prefab::getRendererNodes() const {
+        return _rendererNodes;
+    }
+
+    std::span<const RenderComponent> Prefab::getRenderers() const {
+        return _renderers;
+    }
+}  // namespace x
@@ -0,0 +1,59 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "RenderComponent.hpp"
+#include "SceneFormat.hpp"
+#include "Math/AffineTransform.hpp"
+
+#include <span>
+#include <vector>
+
+namespace x {
+    /// @brief Template entity subtree that Scene::instantiate stamps out in bulk.
+    ///
+    /// Nodes are stored flattened with parents before children. Components are stored once per
+    /// pool and copied into each instance, so RenderComponents share their ModelHandle (and with
+    /// it the mesh data and material) across every instance; only the transform is per instance.
+    class Prefab {
+    public:
+        static constexpr u32 kNoParent = SceneFormat::kNoParent;
+
+        struct Node {
+            u32 parent;
+            Math::AffineTransform local;
+        };
+
+        /// @brief Per-instance placement, applied on top of each prefab root's local transform.
+        struct Instance {
+            glm::vec3 position = glm::vec3(0.f);
+            glm::vec3 rotation = glm::vec3(0.f);
+            glm::vec3 scale    = glm::vec3(1.f);
+        };
+
+        /// @brief Adds a node and returns its index. parent must already exist.
+        u32 addNode(u32 parent                         = kNoParent,
+                    const Math::AffineTransform& local = Math::AffineTransform::identity());
+        /// @brief Gives the node a TransformComponent. Like Scene::setWorldTransform, its value is
+        /// the node's world transform once the prefab is instantiated.
+        void addTransform(u32 node);
+        /// @brief The returned reference is valid until the next addRenderer call.
+        RenderComponent& addRenderer(u32 node);
+
+        [[nodiscard]] size_t getNodeCount() const;
+        [[nodiscard]] std::span<const Node> getNodes() const;
+        [[nodiscard]] std::span<const u32> getTransformNodes() const;
+        [[nodiscard]] std::span<const u32> getRendererNodes() const;
+        [[nodiscard]] std::span<const RenderComponent> getRenderers() const;
+
+    private:
+        std::vector<Node> _nodes;
+        std::vector<u32> _transformNodes;
+        // Parallel to _rendererNodes: _renderers[i] belongs to node _rendererNodes[i]
+        std::vector<u32> _rendererNodes;
+        std::vector<RenderComponent> _renderers;
+    };
+}  // namespace x
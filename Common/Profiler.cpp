@@ -0,0 +1,172 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace x {
+    std::atomic<bool> Profiler::_enabled {true};
+
+    Profiler::Scope::Scope(const char* name) : _name(name), _begin(0), _depth(0) {
+        if (!isEnabled()) { return; }
+        auto& buffer = getThreadBuffer();
+        _depth       = buffer.depth++;
+        _begin       = Clock::cpuTimestamp();
+    }
+
+    Profiler::Scope::~Scope() {
+        if (_begin == 0) { return; }
+        const u64 end = Clock::cpuTimestamp();
+        auto& buffer  = getThreadBuffer();
+        buffer.depth--;
+        buffer.push({_name, _begin, end, _depth, ProfileEvent::Type::Scope});
+    }
+
+    Profiler& Profiler::instance() {
+        // Threads may still record during static destruction, so the profiler is never destroyed
+        static auto* instance = new Profiler();
+        return *instance;
+    }
+
+    Profiler::Profiler()
+        : _startTick(Clock::cpuTimestamp()), _startTime(std::chrono::steady_clock::now()) {}
+
+    void Profiler::setEnabled(bool enabled) {
+        _enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool Profiler::isEnabled() {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    void Profiler::setThreadName(const char* name) {
+        auto& buffer = getThreadBuffer();
+        std::lock_guard lock(instance()._mutex);
+        buffer.name = name;
+    }
+
+    void Profiler::counter(const char* name, f64 value) {
+        if (!isEnabled()) { return; }
+        auto& buffer   = getThreadBuffer();
+        const u64 tick = Clock::cpuTimestamp();
+        buffer.push(
+          {name, tick, std::bit_cast<u64>(value), buffer.depth, ProfileEvent::Type::Counter});
+    }
+
+    void Profiler::frame(const char* name) {
+        if (!isEnabled()) { return; }
+        auto& buffer   = getThreadBuffer();
+        const u64 tick = Clock::cpuTimestamp();
+        buffer.push({name, tick, tick, buffer.depth, ProfileEvent::Type::Frame});
+    }
+
+    ProfileCapture Profiler::capture(f64 windowMicroseconds) const {
+        ProfileCapture result;
+        result.lastTick = Clock::cpuTimestamp();
+
+        // Calibrate the time-stamp counter against the steady clock over the profiler's lifetime
+        const auto elapsed = std::chrono::duration<f64, std::micro>(
+                               std::chrono::steady_clock::now() - _startTime)
+                               .count();
+        if (elapsed > 0.0) {
+            result.ticksPerMicrosecond = CAST<f64>(result.lastTick - _startTick) / elapsed;
+        }
+        const u64 windowTicks = CAST<u64>(windowMicroseconds * result.ticksPerMicrosecond);
+        const u64 cutoff      = windowMicroseconds > 0.0 && windowTicks < result.lastTick
+                                  ? result.lastTick - windowTicks
+                                  : 0;
+        result.firstTick      = std::max(cutoff, _startTick);
+
+        std::lock_guard lock(_mutex);
+        result.threads.reserve(_threads.size());
+        for (size_t t = 0; t < _threads.size(); t++) {
+            const auto& buffer = *_threads[t];
+            auto& thread       = result.threads.emplace_back();
+            thread.name = buffer.name.empty() ? "Thread " + std::to_string(t) : buffer.name;
+
+            // Walk back from the newest event until the window or the ring runs out. Once the
+            // owner has lapped the walk, every older slot has been overwritten too.
+            const u64 head  = buffer.head.load(std::memory_order_acquire);
+            const u64 first = head > kEventCapacity ? head - kEventCapacity : 0;
+            ProfileEvent event;
+            for (u64 index = head; index > first && buffer.read(index - 1, event); index--) {
+                if (event.getRecordedTick() < cutoff) { break; }
+                thread.events.push_back(event);
+            }
+            std::reverse(thread.events.begin(), thread.events.end());
+        }
+        return result;
+    }
+
+    str Profiler::exportTrace(const ProfileCapture& capture) {
+        str trace = "{\"traceEvents\": [\n";
+        char buffer[256];
+        bool first = true;
+        auto append = [&](i32 written) {
+            if (written <= 0) { return; }
+            if (!first) { trace += ",\n"; }
+            trace.append(buffer, std::min<size_t>(CAST<size_t>(written), sizeof(buffer) - 1));
+            first = false;
+        };
+
+        for (size_t tid = 0; tid < capture.threads.size(); tid++) {
+            const auto& thread = capture.threads[tid];
+            append(std::snprintf(buffer,
+                                 sizeof(buffer),
+                                 R"({"name": "thread_name", "ph": "M", "pid": 0, "tid": %zu, )"
+                                 R"("args": {"name": "%s"}})",
+                                 tid,
+                                 thread.name.c_str()));
+
+            for (const auto& event : thread.events) {
+                const f64 begin = capture.toMicroseconds(event.begin);
+                switch (event.type) {
+                    case ProfileEvent::Type::Scope:
+                        append(std::snprintf(buffer,
+                                             sizeof(buffer),
+                                             R"({"name": "%s", "ph": "X", "pid": 0, "tid": %zu, )"
+                                             R"("ts": %.3f, "dur": %.3f})",
+                                             event.name,
+                                             tid,
+                                             begin,
+                                             capture.toMicroseconds(event.end) - begin));
+                        break;
+                    case ProfileEvent::Type::Counter:
+                        append(std::snprintf(buffer,
+                                             sizeof(buffer),
+                                             R"({"name": "%s", "ph": "C", "pid": 0, "tid": %zu, )"
+                                             R"("ts": %.3f, "args": {"value": %g}})",
+                                             event.name,
+                                             tid,
+                                             begin,
+                                             event.getValue()));
+                        break;
+                    case ProfileEvent::Type::Frame:
+                        append(std::snprintf(buffer,
+                                             sizeof(buffer),
+                                             R"({"name": "%s", "ph": "i", "s": "t", "pid": 0, )"
+                                             R"("tid": %zu, "ts": %.3f})",
+                                             event.name,
+                                             tid,
+                                             begin));
+                        break;
+                }
+            }
+        }
+        trace += "\n]}\n";
+        return trace;
+    }
+
+    Profiler::ThreadBuffer& Profiler::getThreadBuffer() {
+        thread_local ThreadBuffer* buffer = &instance().registerThread();
+        return *buffer;
+    }
+
+    Profiler::ThreadBuffer& Profiler::registerThread() {
+        std::lock_guard lock(_mutex);
+        return *_threads.emplace_back(std::make_unique<ThreadBuffer>());
+    }
+}  // namespace x
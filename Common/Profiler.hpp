@@ -0,0 +1,176 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "Clock.hpp"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace x {
+    struct ProfileEvent {
+        enum class Type : u8 { Scope, Counter, Frame };
+
+        const char* name;  // Not copied, pass string literals
+        u64 begin;         // Clock::cpuTimestamp() ticks
+        u64 end;           // Scopes only; counters keep their value here, see getValue()
+        u32 depth;         // Scopes open on the thread when this one began
+        Type type;
+
+        [[nodiscard]] f64 getValue() const {
+            return std::bit_cast<f64>(end);
+        }
+
+        /// @brief When the event was written to its ring
+        [[nodiscard]] u64 getRecordedTick() const {
+            return type == Type::Scope ? end : begin;
+        }
+    };
+
+    static_assert(sizeof(ProfileEvent) == 32);
+
+    /// @brief Events recorded by the profiler, ordered by thread then by when they finished.
+    struct ProfileCapture {
+        struct Thread {
+            str name;
+            std::vector<ProfileEvent> events;
+        };
+
+        std::vector<Thread> threads;
+        u64 firstTick           = 0;  // Ticks are converted relative to this
+        u64 lastTick            = 0;
+        f64 ticksPerMicrosecond = 1.0;
+
+        /// @brief Negative for scopes that began before the capture window
+        [[nodiscard]] f64 toMicroseconds(u64 tick) const {
+            return CAST<f64>(CAST<i64>(tick - firstTick)) / ticksPerMicrosecond;
+        }
+    };
+
+    /// @brief Low overhead CPU instrumentation, used through the X_PROFILE_* macros below.
+    ///
+    /// Every thread that records gets its own ring of kEventCapacity events, registered on its
+    /// first event. Only the owning thread writes to a ring, so recording takes no lock: a scope
+    /// costs two time-stamp counter reads and a few plain stores. Old events are overwritten once
+    /// a ring is full. capture() copies the rings from any thread. Each slot carries a sequence
+    /// number, seqlock style, so events overwritten while they were copied are detected and
+    /// dropped.
+    class Profiler {
+    public:
+        static constexpr u32 kEventCapacity = 1 << 16;  // Per thread, must be a power of two
+
+        class Scope {
+        public:
+            explicit Scope(const char* name);
+            ~Scope();
+
+            Scope(const Scope&)            = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            const char* _name;
+            u64 _begin;
+            u32 _depth;
+        };
+
+        static Profiler& instance();
+
+        static void setEnabled(bool enabled);
+        [[nodiscard]] static bool isEnabled();
+        /// @brief Names the calling thread in captures. Unnamed threads are numbered.
+        static void setThreadName(const char* name);
+        static void counter(const char* name, f64 value);
+        /// @brief Marks the start of a frame of the calling thread's loop
+        static void frame(const char* name);
+
+        /// @brief Copies every thread's events. With a window, only events that finished within
+        /// the last window microseconds are copied.
+        [[nodiscard]] ProfileCapture capture(f64 windowMicroseconds = 0.0) const;
+        /// @brief Formats a capture as Chrome trace events (chrome://tracing, Perfetto)
+        [[nodiscard]] static str exportTrace(const ProfileCapture& capture);
+
+    private:
+        /// @brief One ring entry. The fields are atomics so capture() can read them while the
+        /// owner overwrites them; plain loads and stores on the usual targets.
+        struct Slot {
+            // 2 * index + 1 while event index is being written, 2 * index + 2 once it is complete
+            std::atomic<u64> sequence {0};
+            std::atomic<uintptr_t> name {0};
+            std::atomic<u64> begin {0};
+            std::atomic<u64> end {0};
+            std::atomic<u64> depthAndType {0};
+        };
+
+        struct ThreadBuffer {
+            str name;
+            u32 depth = 0;  // Owner thread only
+            std::atomic<u64> head {0};
+            std::array<Slot, kEventCapacity> slots;
+
+            void push(const ProfileEvent& event) {
+                const u64 index = head.load(std::memory_order_relaxed);
+                auto& slot      = slots[index & (kEventCapacity - 1)];
+                slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                slot.name.store(RCAST<uintptr_t>(event.name), std::memory_order_relaxed);
+                slot.begin.store(event.begin, std::memory_order_relaxed);
+                slot.end.store(event.end, std::memory_order_relaxed);
+                slot.depthAndType.store(CAST<u64>(event.type) << 32 | event.depth,
+                                        std::memory_order_relaxed);
+                slot.sequence.store(2 * index + 2, std::memory_order_release);
+                head.store(index + 1, std::memory_order_release);
+            }
+
+            /// @brief Copies event index out of the ring. False if it was overwritten, or is
+            /// being overwritten, by a later event.
+            bool read(u64 index, ProfileEvent& event) const {
+                const auto& slot  = slots[index & (kEventCapacity - 1)];
+                const u64 written = 2 * index + 2;
+                if (slot.sequence.load(std::memory_order_acquire) != written) { return false; }
+                event.name  = RCAST<const char*>(slot.name.load(std::memory_order_relaxed));
+                event.begin = slot.begin.load(std::memory_order_relaxed);
+                event.end   = slot.end.load(std::memory_order_relaxed);
+                const u64 depthAndType = slot.depthAndType.load(std::memory_order_relaxed);
+                event.depth            = CAST<u32>(depthAndType);
+                event.type             = CAST<ProfileEvent::Type>(depthAndType >> 32);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                return slot.sequence.load(std::memory_order_relaxed) == written;
+            }
+        };
+
+        static std::atomic<bool> _enabled;
+
+        std::vector<std::unique_ptr<ThreadBuffer>> _threads;  // Never shrinks
+        mutable std::mutex _mutex;                            // Guards _threads
+        u64 _startTick;
+        std::chrono::steady_clock::time_point _startTime;
+
+        Profiler();
+
+        static ThreadBuffer& getThreadBuffer();
+        ThreadBuffer& registerThread();
+    };
+}  // namespace x
+
+#if !defined(NDEBUG) || defined(X_ENABLE_PROFILER)
+    #define X_PROFILE_CONCAT_IMPL(a, b) a##b
+    #define X_PROFILE_CONCAT(a, b) X_PROFILE_CONCAT_IMPL(a, b)
+    #define X_PROFILE_SCOPE(name)                                                                  \
+        const x::Profiler::Scope X_PROFILE_CONCAT(xProfileScope, __LINE__)(name)
+    #define X_PROFILE_COUNTER(name, value) x::Profiler::counter(name, CAST<f64>(value))
+    #define X_PROFILE_FRAME(name) x::Profiler::frame(name)
+    #define X_PROFILE_THREAD(name) x::Profiler::setThreadName(name)
+#else
+    #define X_PROFILE_SCOPE(name) ((void)0)
+    #define X_PROFILE_COUNTER(name, value) ((void)0)
+    #define X_PROFILE_FRAME(name) ((void)0)
+    #define X_PROFILE_THREAD(name) ((void)0)
+#endif
@@ -5,14 +5,22 @@
 #include "RenderComponent.hpp"
 
 namespace x {
-    void RenderComponent::draw(const CameraState& camera,
-                               const LightingState& lights,
-                               const x::TransformComponent& transform) const {
-        _model.draw(camera, lights, transform);
+    void RenderComponent::submit(Graphics::RenderQueue& queue,
+                                 const CameraState& camera,
+                                 const x::TransformComponent& transform) const {
+        if (_visible) { _model.submit(queue, camera, transform); }
+    }
+
+    void RenderComponent::record(Graphics::RenderCommandList& commands,
+                                 size_t list,
+                                 const CameraState& camera,
+                                 const x::TransformComponent& transform) const {
+        if (_visible) { _model.record(commands, list, camera, transform); }
     }
 
     void RenderComponent::setModel(ModelHandle model) {
         _model = model;
+        if (_occluder) { _model.retainOccluder(); }
     }
 
     void RenderComponent::setVisible(bool visible) {
@@ -23,6 +31,11 @@ namespace x {
         _castsShadows = castsShadows;
     }
 
+    void RenderComponent::setOccluder(bool occluder) {
+        _occluder = occluder;
+        if (_occluder) { _model.retainOccluder(); }
+    }
+
     void RenderComponent::release() {
         if (_model.valid()) { _model.release(); }
     }
@@ -30,4 +43,20 @@ namespace x {
     std::shared_ptr<IMaterial> RenderComponent::getMaterial() const {
         return _model.getMaterial();
     }
+
+    const ModelHandle& RenderComponent::getModel() const {
+        return _model;
+    }
+
+    bool RenderComponent::getVisible() const {
+        return _visible;
+    }
+
+    bool RenderComponent::getCastsShadows() const {
+        return _castsShadows;
+    }
+
+    bool RenderComponent::getOccluder() const {
+        return _occluder;
+    }
 }  // namespace x
\ No newline at end of file
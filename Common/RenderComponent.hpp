@@ -21,18 +21,33 @@ namespace x {
         RenderComponent(RenderComponent&&)                 = default;
         RenderComponent& operator=(RenderComponent&&)      = default;
 
-        void draw(const CameraState& camera,
-                  const LightingState& lights,
-                  const x::TransformComponent& transform) const;
+        /// @brief Queues the model's draws, skipping hidden components.
+        void submit(Graphics::RenderQueue& queue,
+                    const CameraState& camera,
+                    const x::TransformComponent& transform) const;
+        /// @brief Records the model's draws into list of commands, skipping hidden components.
+        void record(Graphics::RenderCommandList& commands,
+                    size_t list,
+                    const CameraState& camera,
+                    const x::TransformComponent& transform) const;
         void setModel(ModelHandle model);
         void setVisible(bool visible);
         void setCastsShadows(bool castsShadows);
+        /// @brief Occluders are rasterized into the software depth buffer that hides the
+        /// renderables behind them. Best kept to a few large, simple models such as walls; their
+        /// models keep a CPU copy of their geometry, see ModelHandle::retainOccluder().
+        void setOccluder(bool occluder);
         void release() override;
         std::shared_ptr<IMaterial> getMaterial() const;
+        [[nodiscard]] const ModelHandle& getModel() const;
+        [[nodiscard]] bool getVisible() const;
+        [[nodiscard]] bool getCastsShadows() const;
+        [[nodiscard]] bool getOccluder() const;
 
     private:
         x::ModelHandle _model;
         bool _castsShadows = true;
         bool _visible      = true;
+        bool _occluder     = false;
     };
 }  // namespace x
@@ -0,0 +1,161 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "RenderCuller.hpp"
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <future>
+
+namespace x {
+    RenderCuller::RenderCuller(Thread::ThreadPool* pool, size_t chunkSize)
+        : _pool(pool), _chunkSize(std::max<size_t>(chunkSize, 4)) {}
+
+    void RenderCuller::cull(const GameState& state,
+                            const glm::mat4& viewProjection,
+                            Math::OcclusionBuffer* occlusion) {
+        X_PROFILE_SCOPE("Cull");
+        const auto frustum = Math::Frustum::fromMatrix(viewProjection);
+        const size_t count = state.getComponents<RenderComponent>().getRawComponents().size();
+
+        _culler.resize(count);
+        _transforms.resize(count);
+        _worldBounds.resize(count);
+        _visibility.resize(count);
+        _visible.clear();
+        _occluded = 0;
+        if (count == 0) { return; }
+
+        dispatch(count, _chunkSize, [this, &state, &frustum](size_t begin, size_t end) {
+            cullChunk(state, frustum, begin, end);
+        });
+
+        if (occlusion && rasterizeOccluders(state, viewProjection, *occlusion)) {
+            _occluded = CAST<size_t>(std::count(_visibility.begin(), _visibility.end(), 1));
+            dispatch(count, _chunkSize, [this, occlusion](size_t begin, size_t end) {
+                occludeChunk(*occlusion, begin, end);
+            });
+        }
+
+        const auto& renderables = state.getComponents<RenderComponent>().getRawComponents();
+        for (size_t i = 0; i < count; i++) {
+            if (_visibility[i]) { _visible.push_back({&renderables[i], _transforms[i]}); }
+        }
+        if (_occluded > 0) { _occluded -= _visible.size(); }
+    }
+
+    void RenderCuller::record(const CameraState& camera, Graphics::RenderCommandList& commands) {
+        X_PROFILE_SCOPE("RecordCommands");
+        const size_t count = _visible.size();
+        // One list per chunk, so no two threads ever record into the same list
+        const size_t lists =
+          _pool && count > _chunkSize ? (count + _chunkSize - 1) / _chunkSize : 1;
+
+        commands.begin(lists);
+        dispatch(count, _chunkSize, [this, &camera, &commands](size_t begin, size_t end) {
+            X_PROFILE_SCOPE("RecordChunk");
+            const size_t list = begin / _chunkSize;
+            for (size_t i = begin; i < end; i++) {
+                _visible[i].renderable->record(commands, list, camera, *_visible[i].transform);
+            }
+        });
+        {
+            X_PROFILE_SCOPE("SortCommands");
+            commands.finish();
+        }
+    }
+
+    std::span<const RenderCuller::Visible> RenderCuller::getVisible() const {
+        return _visible;
+    }
+
+    size_t RenderCuller::getTestedCount() const {
+        return _visibility.size();
+    }
+
+    size_t RenderCuller::getOccludedCount() const {
+        return _occluded;
+    }
+
+    template<typename Fn>
+    void RenderCuller::dispatch(size_t count, size_t chunkSize, const Fn& fn) {
+        if (!_pool || count <= chunkSize) {
+            fn(0, count);
+            return;
+        }
+
+        // The calling thread takes the first chunk instead of waiting idle
+        std::vector<std::future<void>> pending;
+        pending.reserve(count / chunkSize);
+        for (size_t begin = chunkSize; begin < count; begin += chunkSize) {
+            const size_t end = std::min(begin + chunkSize, count);
+            pending.push_back(_pool->submit([&fn, begin, end] { fn(begin, end); }));
+        }
+        fn(0, chunkSize);
+        for (auto& chunk : pending) {
+            chunk.get();
+        }
+    }
+
+    void RenderCuller::cullChunk(const GameState& state,
+                                 const Math::Frustum& frustum,
+                                 size_t begin,
+                                 size_t end) {
+        X_PROFILE_SCOPE("CullChunk");
+        const auto& manager     = state.getComponents<RenderComponent>();
+        const auto& renderables = manager.getRawComponents();
+        const auto& entities    = manager.getEntities();
+
+        for (size_t i = begin; i < end; i++) {
+            const auto* transform = state.getComponent<TransformComponent>(entities[i]);
+            const auto bounds     = renderables[i].getModel().getBounds();
+            _transforms[i]        = transform;
+            if (!transform || !renderables[i].getVisible() || !bounds.valid()) {
+                _culler.setEmpty(i);
+                continue;
+            }
+            _worldBounds[i] = Math::transformAABB(bounds, transform->getAffine());
+            _culler.set(i, _worldBounds[i]);
+        }
+        _culler.cull(frustum, begin, end, &_visibility[begin]);
+    }
+
+    bool RenderCuller::rasterizeOccluders(const GameState& state,
+                                          const glm::mat4& viewProjection,
+                                          Math::OcclusionBuffer& occlusion) {
+        X_PROFILE_SCOPE("RasterizeOccluders");
+        const auto& renderables = state.getComponents<RenderComponent>().getRawComponents();
+
+        occlusion.begin(viewProjection);
+        bool any = false;
+        for (size_t i = 0; i < renderables.size(); i++) {
+            if (!_visibility[i] || !renderables[i].getOccluder()) { continue; }
+            const auto& model = renderables[i].getModel();
+            occlusion.addOccluder(model.getOccluderVertices(),
+                                  model.getOccluderIndices(),
+                                  _transforms[i]->getAffine());
+            any = true;
+        }
+        if (!any) { return false; }
+
+        // Each tile owns its part of the depth buffer, so tiles rasterize independently
+        dispatch(Math::OcclusionBuffer::kTileCount, 1, [&occlusion](size_t begin, size_t end) {
+            X_PROFILE_SCOPE("RasterizeTile");
+            for (size_t tile = begin; tile < end; tile++) {
+                occlusion.rasterizeTile(CAST<u32>(tile));
+            }
+        });
+        return true;
+    }
+
+    void RenderCuller::occludeChunk(const Math::OcclusionBuffer& occlusion,
+                                    size_t begin,
+                                    size_t end) {
+        X_PROFILE_SCOPE("OccludeChunk");
+        for (size_t i = begin; i < end; i++) {
+            // Occluders are tested too; their own depth never hides them, only a nearer occluder
+            if (_visibility[i] && !occlusion.isVisible(_worldBounds[i])) { _visibility[i] = 0; }
+        }
+    }
+}  // namespace x
@@ -0,0 +1,78 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "GameState.hpp"
+#include "Graphics/RenderCommandList.hpp"
+#include "Math/FrustumCuller.hpp"
+#include "Math/OcclusionBuffer.hpp"
+#include "Thread/ThreadPool.hpp"
+
+#include <span>
+#include <vector>
+
+namespace x {
+    /// @brief Finds the renderables whose world bounds intersect the camera frustum, so only
+    /// those are submitted to the render queue.
+    ///
+    /// Renderables are split into chunks. Each chunk transforms its models' bounds to world space
+    /// and culls them with Math::FrustumCuller; chunks run in parallel on the thread pool when one
+    /// is given. Hidden renderables, renderables without a transform and models without bounds
+    /// are never visible.
+    ///
+    /// Given an occlusion buffer, the visible occluders are then rasterized into it, one tile per
+    /// task, and every survivor whose world bounds are fully behind them is dropped too,
+    /// occluders included.
+    ///
+    /// record() turns the survivors into render commands, one list per chunk, so the render
+    /// thread never has to walk the ECS.
+    class RenderCuller {
+    public:
+        struct Visible {
+            const RenderComponent* renderable;
+            const TransformComponent* transform;
+        };
+
+        explicit RenderCuller(Thread::ThreadPool* pool = nullptr, size_t chunkSize = 1024);
+
+        void cull(const GameState& state,
+                  const glm::mat4& viewProjection,
+                  Math::OcclusionBuffer* occlusion = nullptr);
+        /// @brief Records the visible renderables of the last cull() into commands and sorts them
+        void record(const CameraState& camera, Graphics::RenderCommandList& commands);
+
+        /// @brief Visible renderables of the last cull(), in component order
+        [[nodiscard]] std::span<const Visible> getVisible() const;
+        /// @brief Number of renderables tested by the last cull()
+        [[nodiscard]] size_t getTestedCount() const;
+        /// @brief Number of renderables inside the frustum that the last cull() found occluded
+        [[nodiscard]] size_t getOccludedCount() const;
+
+    private:
+        Thread::ThreadPool* _pool;
+        size_t _chunkSize;
+        Math::FrustumCuller _culler;
+        std::vector<const TransformComponent*> _transforms;
+        std::vector<Math::AABB> _worldBounds;
+        std::vector<u8> _visibility;
+        std::vector<Visible> _visible;
+        size_t _occluded = 0;
+
+        /// @brief Calls fn(begin, end) for each chunk of [0, count), on the pool if there is one
+        template<typename Fn>
+        void dispatch(size_t count, size_t chunkSize, const Fn& fn);
+
+        void cullChunk(const GameState& state,
+                       const Math::Frustum& frustum,
+                       size_t begin,
+                       size_t end);
+        /// @brief Returns false if no visible renderable is an occluder
+        bool rasterizeOccluders(const GameState& state,
+                                const glm::mat4& viewProjection,
+                                Math::OcclusionBuffer& occlusion);
+        void occludeChunk(const Math::OcclusionBuffer& occlusion, size_t begin, size_t end);
+    };
+}  // namespace x
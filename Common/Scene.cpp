@@ -3,31 +3,92 @@
 //
 
 #include "Scene.hpp"
+#include "SceneFormat.hpp"
+#include "ModelManager.hpp"
+#include "Filesystem/Filesystem.hpp"
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
 #include <functional>
+#include <span>
 #include <pugixml.hpp>
 
 namespace x {
+    namespace {
+        /// @brief Collects chunk payloads and lays them out behind the header and chunk table.
+        class ChunkWriter {
+        public:
+            template<typename T>
+            void addChunk(u32 id, const std::vector<T>& records) {
+                static_assert(std::is_trivially_copyable_v<T>);
+                const auto* bytes = RCAST<const u8*>(records.data());
+                _chunks.push_back({id, CAST<u32>(records.size()), 0, records.size() * sizeof(T)});
+                _payloads.emplace_back(bytes, bytes + records.size() * sizeof(T));
+            }
+
+            [[nodiscard]] std::vector<u8> finish(u32 entityCount) {
+                const auto align = [](size_t offset) {
+                    return (offset + SceneFormat::kChunkAlignment - 1) &
+                           ~(SceneFormat::kChunkAlignment - 1);
+                };
+
+                size_t offset = align(sizeof(SceneFormat::Header) +
+                                      _chunks.size() * sizeof(SceneFormat::ChunkEntry));
+                for (auto& chunk : _chunks) {
+                    chunk.offset = offset;
+                    offset       = align(offset + chunk.size);
+                }
+
+                std::vector<u8> data(offset, 0);
+                const SceneFormat::Header header {SceneFormat::kMagic,
+                                                  SceneFormat::kVersion,
+                                                  CAST<u32>(_chunks.size()),
+                                                  entityCount};
+                std::memcpy(data.data(), &header, sizeof(header));
+                std::memcpy(data.data() + sizeof(header),
+                            _chunks.data(),
+                            _chunks.size() * sizeof(SceneFormat::ChunkEntry));
+                for (size_t i = 0; i < _chunks.size(); i++) {
+                    if (_payloads[i].empty()) { continue; }
+                    std::memcpy(data.data() + _chunks[i].offset,
+                                _payloads[i].data(),
+                                _payloads[i].size());
+                }
+                return data;
+            }
+
+        private:
+            std::vector<SceneFormat::ChunkEntry> _chunks;
+            std::vector<std::vector<u8>> _payloads;
+        };
+
+        glm::vec3 parseVec3(const pugi::xml_attribute& attribute, const glm::vec3& fallback) {
+            glm::vec3 value = fallback;
+            if (attribute) {
+                std::sscanf(attribute.as_string(), "%f %f %f", &value.x, &value.y, &value.z);
+            }
+            return value;
+        }
+
+        str formatVec3(const glm::vec3& value) {
+            char buffer[64];
+            std::snprintf(buffer, sizeof(buffer), "%g %g %g", value.x, value.y, value.z);
+            return buffer;
+        }
+    }  // namespace
+
     EntityId Scene::createEntity(const std::optional<x::EntityId>& parent) {
-        EntityId entity      = _state.createEntity();
+        EntityId entity      = _state->createEntity();
         auto node            = std::make_shared<SceneNode>();
         node->entity         = entity;
-        node->localTransform = glm::mat4(1.0f);
-        node->worldTransform = glm::mat4(1.0f);
+        node->localTransform = Math::AffineTransform::identity();
+        node->worldTransform = Math::AffineTransform::identity();
 
         if ((!parent.has_value()) || !parent->valid()) {
-            if (!_root) {
-                _root = node;
-            } else {
-                // add as child of root
-                node->parent = _root;
-                _root->children.push_back(node);
-            }
+            linkNode(node, nullptr);
         } else {
-            // add as child of specified parent
-            auto parentNode = _nodes[*parent];
-            node->parent    = parentNode;
-            parentNode->children.push_back(node);
+            linkNode(node, _nodes[*parent]);
         }
 
         _nodes[entity] = node;
@@ -39,7 +100,9 @@ namespace x {
         if (nodeIt == _nodes.end()) { return; }
 
         auto node = nodeIt->second;
-        for (auto& child : node->children) {
+        // Removing a child erases it from node->children, so iterate over a copy
+        const auto children = node->children;
+        for (const auto& child : children) {
             removeEntity(child->entity);
         }
 
@@ -52,7 +115,7 @@ namespace x {
         }
 
         _nodes.erase(entity);
-        _state.destroyEntity(entity);
+        _state->destroyEntity(entity);
         if (_root && _root->entity == entity) { _root.reset(); }
     }
 
@@ -68,7 +131,7 @@ namespace x {
 
         // Store the child's current world transform before we modify its hierarchy.
         // This lets us maintain its world position after reparenting.
-        glm::mat4 childWorldTransform = childNode->worldTransform;
+        const auto childWorldTransform = childNode->worldTransform;
 
         // if child is already attached to a different parent, remove it from that parent first.
         if (auto oldParent = childNode->parent.lock()) {
@@ -87,7 +150,7 @@ namespace x {
         // Calculate the new local transform that will maintain the child's world position
         // worldTransform = parentWorldTransform * localTransform
         // Therefore: localTransform = inverse(parentWorldTransform) * worldTransform
-        childNode->localTransform = glm::inverse(parentNode->worldTransform) * childWorldTransform;
+        childNode->localTransform = Math::inverse(parentNode->worldTransform) * childWorldTransform;
 
         // update the transforms for this node an all its children
         updateWorldTransforms(childNode, parentNode->worldTransform);
@@ -101,8 +164,8 @@ namespace x {
         auto parentNode = childNode->parent.lock();
         if (!parentNode) { return; }
 
-        glm::mat4 worldTransform = childNode->worldTransform;
-        auto& parentChildren     = parentNode->children;
+        const auto worldTransform = childNode->worldTransform;
+        auto& parentChildren      = parentNode->children;
         parentChildren.erase(
           std::remove_if(parentChildren.begin(),
                          parentChildren.end(),
@@ -115,20 +178,216 @@ namespace x {
         if (_root && childNode != _root) {
             childNode->parent = _root;
             _root->children.push_back(childNode);
-            childNode->localTransform = glm::inverse(_root->worldTransform) * worldTransform;
+            childNode->localTransform = Math::inverse(_root->worldTransform) * worldTransform;
             updateWorldTransforms(childNode, _root->worldTransform);
         } else {
             childNode->worldTransform = worldTransform;
-            updateWorldTransforms(childNode, glm::mat4(1.0f));
+            updateWorldTransforms(childNode, Math::AffineTransform::identity());
         }
     }
 
     bool Scene::loadFromFile(const str& filename) {
-        return false;
+        SceneFormat::SceneFile file;
+        if (!file.open(filename)) { return false; }
+
+        unload();
+
+        std::vector<ModelHandle> models;
+        models.reserve(file.getAssets().size());
+        for (size_t i = 0; i < file.getAssets().size(); i++) {
+            models.push_back(
+              ModelManager::instance().getModel(file.getAssets()[i].assetId, file.getAssetPath(i)));
+        }
+
+        // Entity IDs are allocated as one contiguous block
+        const size_t count   = file.getEntityCount();
+        const EntityId first = _state->createEntities(count);
+        instantiate(file, models, first, 0, count);
+        return true;
+    }
+
+    bool Scene::saveToFile(const str& filename) const {
+        if (!_root) { return saveToFile(filename, {}); }
+        const EntityId root = _root->entity;
+        return saveToFile(filename, std::span(&root, 1));
+    }
+
+    bool Scene::saveToFile(const str& filename, std::span<const EntityId> roots) const {
+        using namespace SceneFormat;
+
+        std::vector<std::shared_ptr<SceneNode>> rootNodes;
+        rootNodes.reserve(roots.size());
+        for (const auto& root : roots) {
+            const auto it = _nodes.find(root);
+            if (it != _nodes.end()) { rootNodes.push_back(it->second); }
+        }
+
+        const auto nodes = flattenHierarchy(rootNodes);
+        std::unordered_map<EntityId, u32> indices;
+        indices.reserve(nodes.size());
+
+        std::vector<EntityRecord> entities;
+        std::vector<HierarchyRecord> hierarchy;
+        std::vector<AssetRecord> assets;
+        std::vector<char> strings;
+        std::vector<TransformRecord> transforms;
+        std::vector<RenderRecord> renderables;
+        std::unordered_map<u64, u32> assetIndices;
+        entities.reserve(nodes.size());
+        hierarchy.reserve(nodes.size());
+
+        for (u32 i = 0; i < CAST<u32>(nodes.size()); i++) {
+            const auto& node = nodes[i];
+            indices.emplace(node->entity, i);
+            entities.push_back({node->entity.value()});
+
+            // Nodes whose parent isn't being saved become roots and keep their world placement
+            const auto parent   = node->parent.lock();
+            const auto parentIt = parent ? indices.find(parent->entity) : indices.end();
+            if (parentIt != indices.end()) {
+                hierarchy.push_back({parentIt->second, node->localTransform});
+            } else {
+                hierarchy.push_back({kNoParent, node->worldTransform});
+            }
+
+            if (const auto* transform = _state->getComponent<TransformComponent>(node->entity)) {
+                transforms.push_back(
+                  {i, transform->getPosition(), transform->getRotation(), transform->getScale()});
+            }
+
+            if (const auto* renderer = _state->getComponent<RenderComponent>(node->entity)) {
+                u32 asset         = kNoAsset;
+                const auto& model = renderer->getModel();
+                if (model.valid()) {
+                    const auto [it, inserted] =
+                      assetIndices.try_emplace(model.getAssetId(), CAST<u32>(assets.size()));
+                    if (inserted) {
+                        const auto path = model.getAssetPath();
+                        assets.push_back({model.getAssetId(),
+                                          CAST<u32>(strings.size()),
+                                          CAST<u32>(path.size())});
+                        strings.insert(strings.end(), path.begin(), path.end());
+                    }
+                    asset = it->second;
+                }
+
+                u32 flags = 0;
+                if (renderer->getVisible()) { flags |= Visible; }
+                if (renderer->getCastsShadows()) { flags |= CastsShadows; }
+                if (renderer->getOccluder()) { flags |= Occluder; }
+                renderables.push_back({i, asset, flags});
+            }
+        }
+
+        ChunkWriter writer;
+        writer.addChunk(ChunkId::Entities, entities);
+        writer.addChunk(ChunkId::Hierarchy, hierarchy);
+        writer.addChunk(ChunkId::Assets, assets);
+        writer.addChunk(ChunkId::Strings, strings);
+        writer.addChunk(ChunkId::Transforms, transforms);
+        writer.addChunk(ChunkId::Renderables, renderables);
+        return Filesystem::FileWriter::writeAllBytes(filename,
+                                                     writer.finish(CAST<u32>(nodes.size())));
     }
 
-    bool Scene::saveToFile(const str& filename) {
-        return false;
+    bool Scene::loadFromXml(const str& filename) {
+        pugi::xml_document document;
+        if (!document.load_file(filename.c_str())) { return false; }
+        const auto sceneElement = document.child("Scene");
+        if (!sceneElement) { return false; }
+
+        unload();
+        if (const auto name = sceneElement.attribute("name")) { _name = name.as_string(); }
+
+        std::function<void(const pugi::xml_node&, const std::optional<EntityId>&)> loadEntities;
+        loadEntities = [&](const pugi::xml_node& parentElement,
+                           const std::optional<EntityId>& parent) {
+            for (const auto& entityElement : parentElement.children("Entity")) {
+                const auto entity = createEntity(parent);
+
+                if (const auto local = entityElement.child("Local")) {
+                    const auto position = parseVec3(local.attribute("position"), {});
+                    const auto rotation = parseVec3(local.attribute("rotation"), {});
+                    const auto scale    = parseVec3(local.attribute("scale"), {1, 1, 1});
+
+                    auto& node = _nodes.at(entity);
+                    node->localTransform =
+                      Math::AffineTransform::fromTRS(position, rotation, scale);
+                    const auto parentNode = node->parent.lock();
+                    node->worldTransform  = parentNode
+                                              ? parentNode->worldTransform * node->localTransform
+                                              : node->localTransform;
+                }
+
+                if (const auto element = entityElement.child("Transform")) {
+                    auto& transform = _state->addComponent<TransformComponent>(entity);
+                    transform.setPosition(parseVec3(element.attribute("position"), {}));
+                    transform.setRotation(parseVec3(element.attribute("rotation"), {}));
+                    transform.setScale(parseVec3(element.attribute("scale"), {1, 1, 1}));
+                    transform.update();
+                }
+
+                if (const auto element = entityElement.child("Render")) {
+                    auto& renderer  = _state->addComponent<RenderComponent>(entity);
+                    const str model = element.attribute("model").as_string();
+                    if (!model.empty()) {
+                        renderer.setModel(ModelManager::instance().getModel(model));
+                    }
+                    renderer.setVisible(element.attribute("visible").as_bool(true));
+                    renderer.setCastsShadows(element.attribute("castsShadows").as_bool(true));
+                    renderer.setOccluder(element.attribute("occluder").as_bool(false));
+                }
+
+                loadEntities(entityElement, entity);
+            }
+        };
+        loadEntities(sceneElement, std::nullopt);
+
+        return true;
+    }
+
+    bool Scene::saveToXml(const str& filename) {
+        pugi::xml_document document;
+        auto sceneElement = document.append_child("Scene");
+        sceneElement.append_attribute("name").set_value(_name.c_str());
+
+        std::function<void(pugi::xml_node&, const std::shared_ptr<SceneNode>&)> saveEntity;
+        saveEntity = [&](pugi::xml_node& parent, const std::shared_ptr<SceneNode>& node) {
+            auto entityElement = parent.append_child("Entity");
+
+            glm::vec3 position, rotation, scale;
+            Math::decompose(node->localTransform, position, rotation, scale);
+            auto local = entityElement.append_child("Local");
+            local.append_attribute("position").set_value(formatVec3(position).c_str());
+            local.append_attribute("rotation").set_value(formatVec3(rotation).c_str());
+            local.append_attribute("scale").set_value(formatVec3(scale).c_str());
+
+            if (const auto* transform = _state->getComponent<TransformComponent>(node->entity)) {
+                auto element = entityElement.append_child("Transform");
+                element.append_attribute("position")
+                  .set_value(formatVec3(transform->getPosition()).c_str());
+                element.append_attribute("rotation")
+                  .set_value(formatVec3(transform->getRotation()).c_str());
+                element.append_attribute("scale")
+                  .set_value(formatVec3(transform->getScale()).c_str());
+            }
+
+            if (const auto* renderer = _state->getComponent<RenderComponent>(node->entity)) {
+                auto element = entityElement.append_child("Render");
+                element.append_attribute("model").set_value(
+                  renderer->getModel().getAssetPath().c_str());
+                element.append_attribute("visible").set_value(renderer->getVisible());
+                element.append_attribute("castsShadows").set_value(renderer->getCastsShadows());
+                element.append_attribute("occluder").set_value(renderer->getOccluder());
+            }
+
+            for (const auto& child : node->children) {
+                saveEntity(entityElement, child);
+            }
+        };
+        if (_root) { saveEntity(sceneElement, _root); }
+
+        return document.save_file(filename.c_str(), "    ");
     }
 
     void Scene::unload() {
@@ -137,7 +396,7 @@ namespace x {
             for (auto& child : node->children) {
                 destroyNode(child);
             }
-            _state.destroyEntity(node->entity);
+            _state->destroyEntity(node->entity);
         };
 
         if (_root) { destroyNode(_root); }
@@ -150,54 +409,285 @@ namespace x {
         auto nodeIt = _nodes.find(entity);
         if (nodeIt == _nodes.end()) { return; }
 
-        auto node   = nodeIt->second;
-        auto parent = node->parent.lock();
+        auto node        = nodeIt->second;
+        auto parent      = node->parent.lock();
+        const auto world = Math::AffineTransform::fromMat4(worldTransform);
         if (parent) {
-            node->localTransform = glm::inverse(parent->worldTransform) * worldTransform;
+            node->localTransform = Math::inverse(parent->worldTransform) * world;
         } else {
-            node->localTransform = worldTransform;
+            node->localTransform = world;
         }
 
-        updateWorldTransforms(node, parent ? parent->worldTransform : glm::mat4(1.0f));
+        updateWorldTransforms(node,
+                              parent ? parent->worldTransform
+                                     : Math::AffineTransform::identity());
     }
 
     glm::mat4 Scene::getWorldTransform(EntityId entity) const {
         auto nodeIt = _nodes.find(entity);
         if (nodeIt == _nodes.end()) { return glm::mat4(1.0f); }
-        return nodeIt->second->worldTransform;
+        return nodeIt->second->worldTransform.toMat4();
     }
 
-    void Scene::updateWorldTransforms(std::shared_ptr<SceneNode> node,
-                                      const glm::mat4& parentTransform) {
-        node->worldTransform = parentTransform * node->localTransform;
-        if (auto* transform = _state.getComponentMutable<TransformComponent>(node->entity)) {
-            // Extract position from four column of matrix
-            glm::vec3 position = glm::vec3(node->worldTransform[3]);
-
-            // extract scale via measuring length of each basis vector
-            glm::vec3 scale(glm::length(glm::vec3(node->worldTransform[0])),
-                            glm::length(glm::vec3(node->worldTransform[1])),
-                            glm::length(glm::vec3(node->worldTransform[2])));
-
-            // create pure rotation matrix by removing scale
-            glm::mat3 rotationMatrix(glm::vec3(node->worldTransform[0]) / scale.x,
-                                     glm::vec3(node->worldTransform[1]) / scale.y,
-                                     glm::vec3(node->worldTransform[2]) / scale.z);
-
-            // extract rotation euler angles in X->Y->Z order
-            glm::vec3 eulerAngles;
-            eulerAngles.y = glm::degrees(atan2(rotationMatrix[2][0], rotationMatrix[0][0]));
-            f32 cosY      = cos(glm::radians(eulerAngles.y));
-            if (abs(cosY) > 0.0001f) {
-                // Normal case, no gimbal lock
-                eulerAngles.x = glm::degrees(atan2(-rotationMatrix[1][2], rotationMatrix[1][1]));
-                eulerAngles.z = glm::degrees(atan2(-rotationMatrix[2][1], rotationMatrix[0][1]));
+    void Scene::instantiate(const SceneFormat::SceneFile& file,
+                            std::span<const ModelHandle> models,
+                            EntityId firstId,
+                            size_t begin,
+                            size_t end,
+                            const std::optional<EntityId>& parent) {
+        using namespace SceneFormat;
+
+        const auto hierarchy = file.getHierarchy();
+        end                  = std::min(end, hierarchy.size());
+        if (begin >= end) { return; }
+
+        std::shared_ptr<SceneNode> parentNode;
+        if (parent.has_value() && parent->valid()) { parentNode = _nodes.at(*parent); }
+        if (!parentNode && !_root) {
+            // Otherwise the first top-level entity would become the scene root and the others
+            // would nest under it. A file holding a single tree, like saveToFile(filename)
+            // writes, keeps its root as the scene root.
+            const auto isTopLevel = [](const HierarchyRecord& record) {
+                return record.parent == kNoParent;
+            };
+            if (std::count_if(hierarchy.begin(), hierarchy.end(), isTopLevel) > 1) {
+                createEntity();
+            }
+        }
+
+        _nodes.reserve(_nodes.size() + (end - begin));
+        for (size_t i = begin; i < end; i++) {
+            auto node            = std::make_shared<SceneNode>();
+            node->entity         = EntityId(firstId.value() + i);
+            node->localTransform = hierarchy[i].local;
+
+            if (hierarchy[i].parent == kNoParent) {
+                linkNode(node, parentNode);
+            } else {
+                linkNode(node, _nodes.at(EntityId(firstId.value() + hierarchy[i].parent)));
+            }
+
+            // Parents precede children, so the parent's world transform is already final
+            const auto nodeParent = node->parent.lock();
+            node->worldTransform  = nodeParent ? nodeParent->worldTransform * node->localTransform
+                                               : node->localTransform;
+            const auto entity = node->entity;
+            _nodes.emplace(entity, std::move(node));
+        }
+
+        // Component records are sorted by entity, so each range is a contiguous slice
+        const auto byEntity = [](const auto& record, size_t index) {
+            return record.entity < index;
+        };
+
+        const auto transforms = file.getTransforms();
+        const auto firstTransform =
+          std::lower_bound(transforms.begin(), transforms.end(), begin, byEntity);
+        const auto lastTransform =
+          std::lower_bound(firstTransform, transforms.end(), end, byEntity);
+        auto& transformPool = _state->getComponents<TransformComponent>();
+        transformPool.reserve(CAST<size_t>(lastTransform - firstTransform));
+        for (auto it = firstTransform; it != lastTransform; ++it) {
+            auto& transform = transformPool.addComponent(EntityId(firstId.value() + it->entity))
+                                .component;
+            transform.setPosition(it->position);
+            transform.setRotation(it->rotation);
+            transform.setScale(it->scale);
+            transform.update();
+        }
+
+        const auto renderables = file.getRenderables();
+        const auto firstRenderable =
+          std::lower_bound(renderables.begin(), renderables.end(), begin, byEntity);
+        const auto lastRenderable =
+          std::lower_bound(firstRenderable, renderables.end(), end, byEntity);
+        auto& renderPool = _state->getComponents<RenderComponent>();
+        renderPool.reserve(CAST<size_t>(lastRenderable - firstRenderable));
+        for (auto it = firstRenderable; it != lastRenderable; ++it) {
+            auto& renderer =
+              renderPool.addComponent(EntityId(firstId.value() + it->entity)).component;
+            if (it->asset != kNoAsset && it->asset < models.size()) {
+                renderer.setModel(models[it->asset]);
+            }
+            renderer.setVisible((it->flags & Visible) != 0);
+            renderer.setCastsShadows((it->flags & CastsShadows) != 0);
+            renderer.setOccluder((it->flags & Occluder) != 0);
+        }
+    }
+
+    EntityId Scene::instantiate(const Prefab& prefab,
+                                std::span<const Prefab::Instance> instances,
+                                const std::optional<EntityId>& parent) {
+        const auto nodes       = prefab.getNodes();
+        const size_t nodeCount = nodes.size();
+        if (nodeCount == 0 || instances.empty()) { return EntityId::Invalid(); }
+
+        const size_t total   = nodeCount * instances.size();
+        const EntityId first = _state->createEntities(total);
+        const auto entityAt  = [&](size_t instance, u32 node) {
+            return EntityId(first.value() + instance * nodeCount + node);
+        };
+
+        std::shared_ptr<SceneNode> parentNode;
+        if (parent.has_value() && parent->valid()) { parentNode = _nodes.at(*parent); }
+        if (!parentNode && !_root) {
+            // Otherwise the first instance root would become the scene root
+            createEntity();
+        }
+        const auto parentWorld = parentNode ? parentNode->worldTransform : _root->worldTransform;
+
+        // Nodes of the current instance, indexed by prefab node
+        std::vector<std::shared_ptr<SceneNode>> instanceNodes(nodeCount);
+        // World transform of every new entity, in entity order
+        std::vector<Math::AffineTransform> worldTransforms(total);
+        _nodes.reserve(_nodes.size() + total);
+        for (size_t k = 0; k < instances.size(); k++) {
+            const auto placement = Math::AffineTransform::fromTRS(instances[k].position,
+                                                                  instances[k].rotation,
+                                                                  instances[k].scale);
+            for (u32 n = 0; n < nodeCount; n++) {
+                auto node    = std::make_shared<SceneNode>();
+                node->entity = entityAt(k, n);
+
+                if (nodes[n].parent == Prefab::kNoParent) {
+                    node->localTransform = placement * nodes[n].local;
+                    linkNode(node, parentNode);
+                    node->worldTransform = parentWorld * node->localTransform;
+                } else {
+                    // Parents precede children, so the parent's world transform is already final
+                    const auto& nodeParent = instanceNodes[nodes[n].parent];
+                    node->localTransform   = nodes[n].local;
+                    linkNode(node, nodeParent);
+                    node->worldTransform = nodeParent->worldTransform * node->localTransform;
+                }
+
+                worldTransforms[k * nodeCount + n] = node->worldTransform;
+                _nodes.emplace(node->entity, node);
+                instanceNodes[n] = std::move(node);
+            }
+        }
+
+        // Components are appended pool by pool: one copy per instance of every prototype, then
+        // only the per-instance state is patched in place
+        std::vector<EntityId> entities;
+
+        const auto transformNodes = prefab.getTransformNodes();
+        entities.reserve(transformNodes.size() * instances.size());
+        for (size_t k = 0; k < instances.size(); k++) {
+            for (const auto node : transformNodes) {
+                entities.push_back(entityAt(k, node));
+            }
+        }
+        const TransformComponent transformPrototype;
+        auto* transforms = _state->getComponents<TransformComponent>().addComponents(
+          entities, std::span(&transformPrototype, 1));
+        for (size_t i = 0; i < entities.size(); i++) {
+            glm::vec3 position, rotation, scale;
+            Math::decompose(worldTransforms[entities[i].value() - first.value()],
+                            position,
+                            rotation,
+                            scale);
+            transforms[i].setPosition(position);
+            transforms[i].setRotation(rotation);
+            transforms[i].setScale(scale);
+            transforms[i].update();
+        }
+
+        const auto rendererNodes = prefab.getRendererNodes();
+        entities.clear();
+        entities.reserve(rendererNodes.size() * instances.size());
+        for (size_t k = 0; k < instances.size(); k++) {
+            for (const auto node : rendererNodes) {
+                entities.push_back(entityAt(k, node));
+            }
+        }
+        _state->getComponents<RenderComponent>().addComponents(entities, prefab.getRenderers());
+
+        return first;
+    }
+
+    Prefab Scene::createPrefab(EntityId root) const {
+        Prefab prefab;
+        const auto it = _nodes.find(root);
+        if (it == _nodes.end()) { return prefab; }
+
+        const std::shared_ptr<SceneNode> roots[] = {it->second};
+        std::unordered_map<EntityId, u32> indices;
+        for (const auto& node : flattenHierarchy(roots)) {
+            u32 index;
+            if (node->entity == root) {
+                index = prefab.addNode();
             } else {
-                // gimbal lock :(
-                eulerAngles.x = glm::degrees(atan2(rotationMatrix[1][0], rotationMatrix[1][1]));
-                eulerAngles.z = 0.0f;
+                const auto parent = indices.at(node->parent.lock()->entity);
+                index             = prefab.addNode(parent, node->localTransform);
+            }
+            indices.emplace(node->entity, index);
+
+            if (_state->getComponent<TransformComponent>(node->entity)) {
+                prefab.addTransform(index);
             }
+            if (const auto* renderer = _state->getComponent<RenderComponent>(node->entity)) {
+                prefab.addRenderer(index) = *renderer;
+            }
+        }
+        return prefab;
+    }
+
+    void Scene::setState(GameState& state) {
+        _state = &state;
+    }
+
+    EntityId Scene::getRoot() const {
+        return _root ? _root->entity : EntityId::Invalid();
+    }
+
+    std::vector<EntityId> Scene::getChildren(EntityId entity) const {
+        std::vector<EntityId> children;
+        const auto it = _nodes.find(entity);
+        if (it == _nodes.end()) { return children; }
+
+        children.reserve(it->second->children.size());
+        for (const auto& child : it->second->children) {
+            children.push_back(child->entity);
+        }
+        return children;
+    }
 
+    std::vector<std::shared_ptr<Scene::SceneNode>>
+    Scene::flattenHierarchy(std::span<const std::shared_ptr<SceneNode>> roots) const {
+        std::vector<std::shared_ptr<SceneNode>> nodes;
+        std::vector<std::shared_ptr<SceneNode>> stack(roots.rbegin(), roots.rend());
+        while (!stack.empty()) {
+            auto node = std::move(stack.back());
+            stack.pop_back();
+            // Push in reverse so children come out in their original order
+            stack.insert(stack.end(), node->children.rbegin(), node->children.rend());
+            nodes.push_back(std::move(node));
+        }
+        return nodes;
+    }
+
+    void Scene::linkNode(const std::shared_ptr<SceneNode>& node,
+                         const std::shared_ptr<SceneNode>& parent) {
+        if (parent) {
+            // add as child of specified parent
+            node->parent = parent;
+            parent->children.push_back(node);
+        } else if (!_root) {
+            _root = node;
+        } else {
+            // add as child of root
+            node->parent = _root;
+            _root->children.push_back(node);
+        }
+    }
+
+    void Scene::updateWorldTransforms(std::shared_ptr<SceneNode> node,
+                                      const Math::AffineTransform& parentTransform) {
+        node->worldTransform = parentTransform * node->localTransform;
+        if (auto* transform = _state->getComponentMutable<TransformComponent>(node->entity)) {
+            glm::vec3 position, eulerAngles, scale;
+            Math::decompose(node->worldTransform, position, eulerAngles, scale);
             transform->setPosition(position);
             transform->setRotation(eulerAngles);
             transform->setScale(scale);
@@ -6,20 +6,23 @@
 
 #include "Types.hpp"
 #include "GameState.hpp"
+#include "Prefab.hpp"
+#include "SceneFormat.hpp"
 
 #include <optional>
+#include <span>
 
 namespace x {
     class Scene {
     public:
-        Scene(const str& name, const GameState& state) : _name(name), _state(state) {}
+        Scene(const str& name, GameState& state) : _name(name), _state(&state) {}
 
         struct SceneNode {
             EntityId entity;
             std::vector<std::shared_ptr<SceneNode>> children;
-            std::weak_ptr<SceneNode> parent;  // avoid circular deps by using weak ptr
-            glm::mat4 localTransform;         // relative to parent
-            glm::mat4 worldTransform;         // cached world transform
+            std::weak_ptr<SceneNode> parent;       // avoid circular deps by using weak ptr
+            Math::AffineTransform localTransform;  // relative to parent
+            Math::AffineTransform worldTransform;  // cached world transform
         };
 
         EntityId createEntity(const std::optional<x::EntityId>& parent = std::nullopt);
@@ -28,20 +31,63 @@ namespace x {
         void attachEntity(EntityId child, EntityId parent);
         void detachEntity(EntityId child);
 
+        /// @brief Replaces the scene with the contents of a binary scene file (see
+        /// SceneFormat.hpp). The file is memory mapped and entities and components are
+        /// constructed in bulk.
         bool loadFromFile(const str& filename);
-        bool saveToFile(const str& filename);
+        bool saveToFile(const str& filename) const;
+        /// @brief Saves only the given subtrees. Roots are written with their world transform.
+        bool saveToFile(const str& filename, std::span<const EntityId> roots) const;
+        /// @brief XML form of the scene, meant for authoring and diffing. Runtime loads should go
+        /// through the binary format; convert with loadFromXml() followed by saveToFile().
+        bool loadFromXml(const str& filename);
+        bool saveToXml(const str& filename);
         void unload();
 
+        /// @brief Creates the nodes and components for entities [begin, end) of a scene file.
+        /// Entity i of the file becomes EntityId(firstId + i), so reserve IDs for the whole file
+        /// with GameState::createEntities first. Ranges must be instantiated in order; top-level
+        /// entities are attached to parent, or to the scene root if none is given.
+        /// @param models Resolved model for each entry of the file's asset table
+        void instantiate(const SceneFormat::SceneFile& file,
+                         std::span<const ModelHandle> models,
+                         EntityId firstId,
+                         size_t begin,
+                         size_t end,
+                         const std::optional<EntityId>& parent = std::nullopt);
+
+        /// @brief Stamps out one copy of the prefab per instance. Node n of instance k becomes
+        /// EntityId(first + k * prefab.getNodeCount() + n), where first is returned. Components
+        /// are copied pool by pool from the prefab, so RenderComponents share its model handles.
+        EntityId instantiate(const Prefab& prefab,
+                             std::span<const Prefab::Instance> instances,
+                             const std::optional<EntityId>& parent = std::nullopt);
+        /// @brief Captures the subtree below root as a prefab. The root's own placement is
+        /// dropped; it comes from the instance transform instead.
+        [[nodiscard]] Prefab createPrefab(EntityId root) const;
+
+        /// @brief Points the scene at the GameState being written this frame. Each state buffer is
+        /// a separate GameState, so systems editing the scene from update() rebind it first.
+        void setState(GameState& state);
+        [[nodiscard]] EntityId getRoot() const;
+        [[nodiscard]] std::vector<EntityId> getChildren(EntityId entity) const;
+
         void setWorldTransform(EntityId entity, const glm::mat4& worldTransform);
         glm::mat4 getWorldTransform(EntityId entity) const;
 
     private:
         str _name;
-        GameState _state;
+        GameState* _state;
         std::unordered_map<EntityId, std::shared_ptr<SceneNode>> _nodes;
         std::shared_ptr<SceneNode> _root;
 
         void updateWorldTransforms(std::shared_ptr<SceneNode> node,
-                                   const glm::mat4& parentTransform);
+                                   const Math::AffineTransform& parentTransform);
+        /// @brief Returns every node below roots in depth-first order, so parents precede their
+        /// children.
+        std::vector<std::shared_ptr<SceneNode>>
+        flattenHierarchy(std::span<const std::shared_ptr<SceneNode>> roots) const;
+        void linkNode(const std::shared_ptr<SceneNode>& node,
+                      const std::shared_ptr<SceneNode>& parent);
     };
 }  // namespace x
@@ -0,0 +1,128 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "SceneFormat.hpp"
+
+#include <algorithm>
+
+namespace x::SceneFormat {
+    /// @brief Points records at a chunk's payload inside the mapped file. Missing chunks yield an
+    /// empty span; returns false only if the chunk is present but malformed.
+    template<typename T>
+    static bool readChunk(const Filesystem::MappedFile& file,
+                          std::span<const ChunkEntry> chunks,
+                          u32 id,
+                          std::span<const T>& records) {
+        records = {};
+        for (const auto& chunk : chunks) {
+            if (chunk.id != id) { continue; }
+            if (chunk.offset > file.getSize() || chunk.size > file.getSize() - chunk.offset ||
+                chunk.size != CAST<u64>(chunk.count) * sizeof(T) ||
+                chunk.offset % alignof(T) != 0) {
+                return false;
+            }
+            records = {RCAST<const T*>(file.getData() + chunk.offset), chunk.count};
+            return true;
+        }
+        return true;
+    }
+
+    bool SceneFile::open(const str& filename) {
+        close();
+        if (!_file.open(filename) || _file.getSize() < sizeof(Header)) {
+            close();
+            return false;
+        }
+
+        const auto* header = RCAST<const Header*>(_file.getData());
+        if (header->magic != kMagic || header->version != kVersion ||
+            header->chunkCount > (_file.getSize() - sizeof(Header)) / sizeof(ChunkEntry)) {
+            close();
+            return false;
+        }
+        const std::span chunks(RCAST<const ChunkEntry*>(_file.getData() + sizeof(Header)),
+                               header->chunkCount);
+
+        if (!readChunk(_file, chunks, ChunkId::Entities, _entities) ||
+            !readChunk(_file, chunks, ChunkId::Hierarchy, _hierarchy) ||
+            !readChunk(_file, chunks, ChunkId::Assets, _assets) ||
+            !readChunk(_file, chunks, ChunkId::Strings, _strings) ||
+            !readChunk(_file, chunks, ChunkId::Transforms, _transforms) ||
+            !readChunk(_file, chunks, ChunkId::Renderables, _renderables) ||
+            !validate(header->entityCount)) {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void SceneFile::close() {
+        _file.close();
+        _entities    = {};
+        _hierarchy   = {};
+        _assets      = {};
+        _strings     = {};
+        _transforms  = {};
+        _renderables = {};
+    }
+
+    bool SceneFile::valid() const {
+        return _file.valid();
+    }
+
+    size_t SceneFile::getEntityCount() const {
+        return _entities.size();
+    }
+
+    str SceneFile::getAssetPath(size_t asset) const {
+        const auto& record = _assets[asset];
+        return {_strings.data() + record.pathOffset, record.pathLength};
+    }
+
+    std::span<const EntityRecord> SceneFile::getEntities() const {
+        return _entities;
+    }
+
+    std::span<const HierarchyRecord> SceneFile::getHierarchy() const {
+        return _hierarchy;
+    }
+
+    std::span<const AssetRecord> SceneFile::getAssets() const {
+        return _assets;
+    }
+
+    std::span<const TransformRecord> SceneFile::getTransforms() const {
+        return _transforms;
+    }
+
+    std::span<const RenderRecord> SceneFile::getRenderables() const {
+        return _renderables;
+    }
+
+    bool SceneFile::validate(u32 entityCount) const {
+        const size_t count = _entities.size();
+        if (count != entityCount || _hierarchy.size() != count) { return false; }
+
+        for (size_t i = 0; i < count; i++) {
+            if (_hierarchy[i].parent != kNoParent && _hierarchy[i].parent >= i) { return false; }
+        }
+        for (const auto& asset : _assets) {
+            if (CAST<u64>(asset.pathOffset) + asset.pathLength > _strings.size()) { return false; }
+        }
+
+        const auto byEntity = [](const auto& a, const auto& b) { return a.entity < b.entity; };
+        if (!std::is_sorted(_transforms.begin(), _transforms.end(), byEntity) ||
+            !std::is_sorted(_renderables.begin(), _renderables.end(), byEntity)) {
+            return false;
+        }
+        for (const auto& record : _transforms) {
+            if (record.entity >= count) { return false; }
+        }
+        for (const auto& record : _renderables) {
+            if (record.entity >= count) { return false; }
+            if (record.asset != kNoAsset && record.asset >= _assets.size()) { return false; }
+        }
+        return true;
+    }
+}  // namespace x::SceneFormat
@@ -0,0 +1,127 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "Filesystem/Filesystem.hpp"
+#include "Math/AffineTransform.hpp"
+
+#include <glm/glm.hpp>
+#include <span>
+#include <type_traits>
+
+/// On-disk layout of binary scene files (.xscene).
+///
+/// A file is a Header, followed by a table of ChunkEntry descriptors, followed by the chunk
+/// payloads. Every payload starts on a kChunkAlignment boundary and is a tightly packed array
+/// of one record type, so the loader can read it straight out of the mapped file.
+///
+/// Entities are referred to by their index in the entity table. The hierarchy chunk is stored
+/// in depth-first order, so a parent always appears before its children.
+namespace x::SceneFormat {
+    constexpr u32 makeFourCC(char a, char b, char c, char d) {
+        return CAST<u32>(a) | CAST<u32>(b) << 8 | CAST<u32>(c) << 16 | CAST<u32>(d) << 24;
+    }
+
+    constexpr u32 kMagic             = makeFourCC('X', 'S', 'C', 'N');
+    constexpr u32 kVersion           = 1;
+    constexpr u32 kNoParent          = 0xFFFFFFFF;
+    constexpr u32 kNoAsset           = 0xFFFFFFFF;
+    constexpr size_t kChunkAlignment = 16;
+
+    namespace ChunkId {
+        constexpr u32 Entities    = makeFourCC('E', 'N', 'T', 'S');  // EntityRecord[]
+        constexpr u32 Hierarchy   = makeFourCC('H', 'I', 'E', 'R');  // HierarchyRecord[]
+        constexpr u32 Assets      = makeFourCC('A', 'S', 'S', 'T');  // AssetRecord[]
+        constexpr u32 Strings     = makeFourCC('S', 'T', 'R', 'S');  // char[]
+        constexpr u32 Transforms  = makeFourCC('X', 'F', 'R', 'M');  // TransformRecord[]
+        constexpr u32 Renderables = makeFourCC('R', 'N', 'D', 'R');  // RenderRecord[]
+    }  // namespace ChunkId
+
+    struct Header {
+        u32 magic;
+        u32 version;
+        u32 chunkCount;
+        u32 entityCount;
+    };
+
+    struct ChunkEntry {
+        u32 id;
+        u32 count;   // Number of records
+        u64 offset;  // From the start of the file
+        u64 size;    // In bytes
+    };
+
+    struct EntityRecord {
+        u64 sourceId;  // EntityId at save time, kept for debugging and tooling
+    };
+
+    struct HierarchyRecord {
+        u32 parent;  // Entity index or kNoParent
+        Math::AffineTransform local;
+    };
+
+    struct AssetRecord {
+        u64 assetId;     // ModelManager::getAssetId(path)
+        u32 pathOffset;  // Into the string chunk, used to load the asset on a cache miss
+        u32 pathLength;
+    };
+
+    struct TransformRecord {
+        u32 entity;
+        glm::vec3 position;
+        glm::vec3 rotation;
+        glm::vec3 scale;
+    };
+
+    enum RenderFlags : u32 {
+        Visible      = 1 << 0,
+        CastsShadows = 1 << 1,
+        Occluder     = 1 << 2,
+    };
+
+    struct RenderRecord {
+        u32 entity;
+        u32 asset;  // Asset table index or kNoAsset
+        u32 flags;
+    };
+
+    static_assert(sizeof(Header) == 16);
+    static_assert(sizeof(ChunkEntry) == 24);
+    static_assert(sizeof(HierarchyRecord) == 52);
+    static_assert(sizeof(TransformRecord) == 40);
+    static_assert(std::is_trivially_copyable_v<HierarchyRecord> &&
+                  std::is_trivially_copyable_v<TransformRecord>);
+
+    /// @brief Read-only view of a scene file. open() maps the file and validates every chunk and
+    /// cross reference, so callers can index the record spans without further checks. Component
+    /// records are sorted by entity index, which lets entity ranges be instantiated piecemeal.
+    class SceneFile {
+    public:
+        bool open(const str& filename);
+        void close();
+
+        [[nodiscard]] bool valid() const;
+        [[nodiscard]] size_t getEntityCount() const;
+        [[nodiscard]] str getAssetPath(size_t asset) const;
+
+        [[nodiscard]] std::span<const EntityRecord> getEntities() const;
+        [[nodiscard]] std::span<const HierarchyRecord> getHierarchy() const;
+        [[nodiscard]] std::span<const AssetRecord> getAssets() const;
+        [[nodiscard]] std::span<const TransformRecord> getTransforms() const;
+        [[nodiscard]] std::span<const RenderRecord> getRenderables() const;
+
+    private:
+        Filesystem::MappedFile _file;
+        std::span<const EntityRecord> _entities;
+        std::span<const HierarchyRecord> _hierarchy;
+        std::span<const AssetRecord> _assets;
+        std::span<const char> _strings;
+        std::span<const TransformRecord> _transforms;
+        std::span<const RenderRecord> _renderables;
+
+        bool validate(u32 entityCount) const;
+    };
+}  // namespace x::SceneFormat
@@ -3,7 +3,12 @@
 //
 
 #include "ShaderManager.hpp"
+#include "Filesystem/Filesystem.hpp"
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <GLFW/glfw3.h>
 #include <xxhash.h>
 
 namespace x {
@@ -15,45 +20,223 @@ namespace x {
     std::shared_ptr<Graphics::ShaderProgram>
     ShaderManager::getShaderProgram(const str& vertexSource, const str& fragmentSource) {
         const auto hash = getHash(vertexSource + fragmentSource);
-        if (_cache.find(hash) == _cache.end()) {
-            // Create program
-            auto program = createProgram(vertexSource, fragmentSource);
-            _cache.insert({hash, program});
-        }
+        if (const auto it = _cache.find(hash); it != _cache.end()) { return it->second; }
+        submit(hash,
+               {{Graphics::ShaderType::Vertex, &vertexSource},
+                {Graphics::ShaderType::Fragment, &fragmentSource}});
+        complete(hash);
         return _cache.at(hash);
     }
 
     std::shared_ptr<Graphics::ShaderProgram>
     ShaderManager::getShaderProgram(const str& computeSource) {
         const auto hash = getHash(computeSource);
-        if (_cache.find(hash) == _cache.end()) {
-            // Create program
-            auto program = createProgram(computeSource);
+        if (const auto it = _cache.find(hash); it != _cache.end()) { return it->second; }
+        submit(hash, {{Graphics::ShaderType::Compute, &computeSource}});
+        complete(hash);
+        return _cache.at(hash);
+    }
+
+    ShaderManager::ProgramFuture ShaderManager::compileAsync(const str& vertexSource,
+                                                             const str& fragmentSource) {
+        return submit(getHash(vertexSource + fragmentSource),
+                      {{Graphics::ShaderType::Vertex, &vertexSource},
+                       {Graphics::ShaderType::Fragment, &fragmentSource}});
+    }
+
+    ShaderManager::ProgramFuture ShaderManager::compileAsync(const str& computeSource) {
+        return submit(getHash(computeSource), {{Graphics::ShaderType::Compute, &computeSource}});
+    }
+
+    size_t ShaderManager::poll() {
+        std::erase_if(_pending, [this](PendingProgram& pending) {
+            if (_parallelCompile) {
+                GLint done = GL_FALSE;
+                glGetProgramiv(pending.program->getId(), kCompletionStatus, &done);
+                if (!done) { return false; }
+            }
+            complete(pending);
+            return true;
+        });
+        return _pending.size();
+    }
+
+    void ShaderManager::finish() {
+        for (auto& pending : _pending) {
+            complete(pending);
+        }
+        _pending.clear();
+    }
+
+    ShaderManager::ProgramFuture
+    ShaderManager::submit(u64 hash, std::initializer_list<Stage> stages) {
+        if (const auto it = _cache.find(hash); it != _cache.end()) {
+            return makeReadyFuture(it->second);
+        }
+        for (const auto& pending : _pending) {
+            if (pending.hash == hash) { return pending.future; }
+        }
+
+        const bool compute = stages.begin()->type == Graphics::ShaderType::Compute;
+        if (auto program = loadCachedProgram(hash, compute)) {
             _cache.insert({hash, program});
+            return makeReadyFuture(program);
         }
-        return _cache.at(hash);
+
+        if (!_parallelCompileQueried) { enableParallelCompile(); }
+
+        // Nothing here queries a status, so the driver can compile while the caller moves on
+        auto& pending   = _pending.emplace_back();
+        pending.hash    = hash;
+        pending.compute = compute;
+        pending.program = std::make_shared<Graphics::ShaderProgram>();
+        pending.future  = pending.promise.get_future().share();
+        for (const auto& stage : stages) {
+            pending.shaders.push_back(
+              std::make_unique<Graphics::Shader>(stage.type, *stage.source, true));
+            pending.program->attachShader(*pending.shaders.back());
+        }
+        pending.program->beginLink();
+        return pending.future;
     }
 
-    std::shared_ptr<Graphics::ShaderProgram>
-    ShaderManager::createProgram(const str& vertexSource, const str& fragmentSource) const {
-        const Graphics::Shader vertexShader(Graphics::ShaderType::Vertex, vertexSource);
-        const Graphics::Shader fragmentShader(Graphics::ShaderType::Fragment, fragmentSource);
-        auto program = std::make_shared<Graphics::ShaderProgram>();
-        program->attachShader(vertexShader);
-        program->attachShader(fragmentShader);
-        program->link();
-        return program;
+    void ShaderManager::complete(u64 hash) {
+        const auto it = std::find_if(_pending.begin(), _pending.end(), [hash](const auto& p) {
+            return p.hash == hash;
+        });
+        if (it == _pending.end()) { return; }
+        complete(*it);
+        _pending.erase(it);
     }
 
-    std::shared_ptr<Graphics::ShaderProgram>
-    ShaderManager::createProgram(const str& computeSource) const {
-        const Graphics::Shader shader(Graphics::ShaderType::Compute, computeSource);
-        auto program = std::make_shared<Graphics::ShaderProgram>();
-        program->attachShader(shader);
-        program->link();
+    void ShaderManager::complete(PendingProgram& pending) {
+        // Compile errors first, they explain a failed link better than the link log
+        for (const auto& shader : pending.shaders) {
+            shader->checkErrors();
+        }
+        pending.program->endLink();
+        pending.shaders.clear();
+
+        storeCachedProgram(pending.hash, pending.compute, *pending.program);
+        _cache.insert({pending.hash, pending.program});
+        pending.promise.set_value(pending.program);
+    }
+
+    void ShaderManager::enableParallelCompile() {
+        _parallelCompileQueried = true;
+
+        GLint count = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+        for (GLint i = 0; i < count && !_parallelCompile; i++) {
+            const auto* name = RCAST<const char*>(glGetStringi(GL_EXTENSIONS, CAST<GLuint>(i)));
+            _parallelCompile = std::strcmp(name, "GL_KHR_parallel_shader_compile") == 0 ||
+                               std::strcmp(name, "GL_ARB_parallel_shader_compile") == 0;
+        }
+        if (!_parallelCompile) { return; }
+
+        // Only the extension's entry point is missing from the core profile loader
+        using MaxThreadsFunc = void(APIENTRYP)(GLuint count);
+        const auto load      = [](const char* name) {
+            return RCAST<MaxThreadsFunc>(glfwGetProcAddress(name));
+        };
+        auto maxThreads = load("glMaxShaderCompilerThreadsKHR");
+        if (!maxThreads) { maxThreads = load("glMaxShaderCompilerThreadsARB"); }
+        // All ones lets the driver pick how many threads to use
+        if (maxThreads) { maxThreads(0xFFFFFFFF); }
+    }
+
+    ShaderManager::ProgramFuture
+    ShaderManager::makeReadyFuture(const std::shared_ptr<Graphics::ShaderProgram>& program) {
+        std::promise<std::shared_ptr<Graphics::ShaderProgram>> promise;
+        promise.set_value(program);
+        return promise.get_future().share();
+    }
+
+    void ShaderManager::setCacheDirectory(const str& directory) {
+        _cacheDirectory = directory;
+    }
+
+    std::shared_ptr<Graphics::ShaderProgram> ShaderManager::loadCachedProgram(u64 hash,
+                                                                              bool compute) {
+        if (_cacheDirectory.empty()) { return nullptr; }
+        const auto path = getCachePath(hash);
+        const auto file = Filesystem::FileReader::readAllBytes(path);
+        if (file.empty()) { return nullptr; }  // Not cached yet
+
+        CacheHeader header {};
+        if (file.size() >= sizeof(header)) { std::memcpy(&header, file.data(), sizeof(header)); }
+        const bool valid = file.size() >= sizeof(header) && header.magic == kCacheMagic &&
+                           header.version == kCacheVersion && header.sourceHash == hash &&
+                           header.driverHash == getDriverHash() &&
+                           header.compute == CAST<u32>(compute) &&
+                           file.size() - sizeof(header) == header.binarySize &&
+                           XXH64(file.data() + sizeof(header), header.binarySize, 0) ==
+                             header.binaryHash;
+        if (!valid) {
+            std::printf(" -- Shader cache entry %s is stale, rebuilding\n", path.c_str());
+            return nullptr;
+        }
+
+        const u8* binary = file.data() + sizeof(header);
+        auto program     = std::make_shared<Graphics::ShaderProgram>();
+        if (!program->loadBinary(header.binaryFormat, binary, header.binarySize, compute)) {
+            std::printf(" -- Driver rejected shader cache entry %s, rebuilding\n", path.c_str());
+            return nullptr;
+        }
         return program;
     }
 
+    void ShaderManager::storeCachedProgram(u64 hash,
+                                           bool compute,
+                                           const Graphics::ShaderProgram& program) {
+        if (_cacheDirectory.empty()) { return; }
+
+        u32 format = 0;
+        std::vector<u8> binary;
+        if (!program.getBinary(format, binary)) { return; }
+
+        const CacheHeader header {kCacheMagic,
+                                  kCacheVersion,
+                                  hash,
+                                  getDriverHash(),
+                                  XXH64(binary.data(), binary.size(), 0),
+                                  format,
+                                  CAST<u32>(binary.size()),
+                                  CAST<u32>(compute),
+                                  0};
+        std::vector<u8> file(sizeof(header) + binary.size());
+        std::memcpy(file.data(), &header, sizeof(header));
+        std::memcpy(file.data() + sizeof(header), binary.data(), binary.size());
+
+        const Filesystem::Path directory(_cacheDirectory);
+        if (!directory.exists()) { directory.createAll(); }
+        // A failed or torn write only costs a rebuild next run, the checksum catches it
+        const auto path = getCachePath(hash);
+        if (!Filesystem::FileWriter::writeAllBytes(path, file)) {
+            std::printf(" -- Failed to write shader cache entry %s\n", path.c_str());
+        }
+    }
+
+    str ShaderManager::getCachePath(u64 hash) const {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.bin", CAST<unsigned long long>(hash));
+        return (Filesystem::Path(_cacheDirectory) / name).string();
+    }
+
+    u64 ShaderManager::getDriverHash() {
+        if (_driverHash != 0) { return _driverHash; }
+
+        // Binaries are only portable to the exact driver that produced them
+        str driver;
+        for (const GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION}) {
+            const auto* value = RCAST<const char*>(glGetString(name));
+            driver += value ? value : "";
+            driver += '\n';
+        }
+        _driverHash = getHash(driver);
+        return _driverHash;
+    }
+
     u64 ShaderManager::getHash(const str& source) const {
         const XXH64_hash_t hash = XXH64(source.c_str(), source.size(), 0);
         return hash;
@@ -6,10 +6,26 @@
 
 #include "Graphics/ShaderProgram.hpp"
 
+#include <future>
 #include <unordered_map>
 #include <memory>
+#include <vector>
 
 namespace x {
+    /// @brief Builds each shader program once and shares it.
+    ///
+    /// compileAsync() submits a program without waiting on the driver and returns a future
+    /// that poll() or finish() fulfil on the GL thread; loading code can submit every program
+    /// up front and overlap compilation with asset I/O. With GL_KHR_parallel_shader_compile
+    /// (or the ARB version) the driver compiles on its own threads and poll() only completes
+    /// programs whose GL_COMPLETION_STATUS is set; without it, poll() waits like finish().
+    /// getShaderProgram() returns a program from any of these states, waiting if needed.
+    ///
+    /// With a cache directory set, linked programs are also written there with
+    /// glGetProgramBinary and loaded back on later runs, which skips compiling and linking.
+    /// Entries are keyed by the source hash and validated against the driver (vendor,
+    /// renderer and version) and a checksum of the binary. Anything that fails validation, or
+    /// that the driver rejects, is rebuilt from source and rewritten.
     class ShaderManager {
     public:
         ShaderManager(const ShaderManager&)            = delete;
@@ -23,15 +39,76 @@ namespace x {
                                                                   const str& fragmentSource);
         std::shared_ptr<Graphics::ShaderProgram> getShaderProgram(const str& computeSource);
 
+        using ProgramFuture = std::shared_future<std::shared_ptr<Graphics::ShaderProgram>>;
+
+        /// @brief Submits a program for compilation. Must be called on the GL thread; the
+        /// future may be waited on from any thread other than the one that polls.
+        ProgramFuture compileAsync(const str& vertexSource, const str& fragmentSource);
+        ProgramFuture compileAsync(const str& computeSource);
+        /// @brief Completes submitted programs the driver has finished. Returns how many are
+        /// still compiling.
+        size_t poll();
+        /// @brief Completes every submitted program, waiting on the driver
+        void finish();
+
+        /// @brief Where program binaries are cached; created on first write. Empty disables
+        /// the disk cache.
+        void setCacheDirectory(const str& directory);
+
     private:
+        static constexpr u32 kCacheMagic   = 0x43505058;  // "XPPC"
+        static constexpr u32 kCacheVersion = 1;
+        // GL_KHR_parallel_shader_compile, not in the core profile glad was generated for
+        static constexpr GLenum kCompletionStatus = 0x91B1;
+
+        struct Stage {
+            Graphics::ShaderType type;
+            const str* source;
+        };
+
+        struct PendingProgram {
+            u64 hash;
+            bool compute;
+            std::shared_ptr<Graphics::ShaderProgram> program;
+            std::vector<std::unique_ptr<Graphics::Shader>> shaders;  // Checked on completion
+            std::promise<std::shared_ptr<Graphics::ShaderProgram>> promise;
+            ProgramFuture future;
+        };
+
+        struct CacheHeader {
+            u32 magic;
+            u32 version;
+            u64 sourceHash;
+            u64 driverHash;
+            u64 binaryHash;
+            u32 binaryFormat;
+            u32 binarySize;
+            u32 compute;
+            u32 padding;
+        };
+
         ShaderManager() = default;
 
-        std::shared_ptr<Graphics::ShaderProgram> createProgram(const str& vertexSource,
-                                                               const str& fragmentSource) const;
-        std::shared_ptr<Graphics::ShaderProgram> createProgram(const str& computeSource) const;
+        ProgramFuture submit(u64 hash, std::initializer_list<Stage> stages);
+        /// @brief Completes the pending program with hash, if there is one
+        void complete(u64 hash);
+        void complete(PendingProgram& pending);
+        void enableParallelCompile();
+        static ProgramFuture
+        makeReadyFuture(const std::shared_ptr<Graphics::ShaderProgram>& program);
+
+        std::shared_ptr<Graphics::ShaderProgram> loadCachedProgram(u64 hash, bool compute);
+        void storeCachedProgram(u64 hash, bool compute, const Graphics::ShaderProgram& program);
+        str getCachePath(u64 hash) const;
+        u64 getDriverHash();
 
         u64 getHash(const str& source) const;
 
         std::unordered_map<u64, std::shared_ptr<Graphics::ShaderProgram>> _cache;
+        std::vector<PendingProgram> _pending;  // In submission order
+        str _cacheDirectory;
+        bool _parallelCompile        = false;
+        bool _parallelCompileQueried = false;
+        u64 _driverHash              = 0;  // Queried on first use, needs a current context
     };
-}  // namespace x
+}  // namespace x
\ No newline at end of file
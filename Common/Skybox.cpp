@@ -4,6 +4,8 @@
 
 #include <glad.h>
 #include "Skybox.hpp"
+#include "Graphics/GLState.hpp"
+#include "Graphics/RenderStats.hpp"
 #include "Graphics/Shaders/Include/Skybox_VS.h"
 #include "Graphics/Shaders/Include/Skybox_FS.h"
 
@@ -27,15 +29,16 @@ namespace x {
         _shader->use();
         _shader->setInt("uSkybox", 0);
 
+        auto& glState = Graphics::GLState::current();
         glGenVertexArrays(1, &_vao);
-        glBindVertexArray(_vao);
+        glState.bindVertexArray(_vao);
         glGenBuffers(1, &_vbo);
-        glBindBuffer(GL_ARRAY_BUFFER, _vbo);
+        glState.bindBuffer(GL_ARRAY_BUFFER, _vbo);
         glBufferData(GL_ARRAY_BUFFER, sizeof(kSkyboxVertices), kSkyboxVertices, GL_STATIC_DRAW);
         glEnableVertexAttribArray(0);
         glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
-        glBindVertexArray(0);
+        glState.bindBuffer(GL_ARRAY_BUFFER, 0);
+        glState.bindVertexArray(0);
         CHECK_GL_ERROR();
     }
 
@@ -46,6 +49,8 @@ namespace x {
         glDeleteVertexArrays(1, &_vao);
         glDeleteBuffers(1, &_vbo);
         CHECK_GL_ERROR();
+        Graphics::GLState::current().forgetVertexArray(_vao);
+        Graphics::GLState::current().forgetBuffer(_vbo);
     }
 
     void Skybox::update(const std::weak_ptr<Clock>& clock, const std::shared_ptr<ICamera>& camera) {
@@ -62,16 +67,15 @@ namespace x {
         glDepthFunc(GL_LEQUAL);
         _shader->use();
         if (cubemapId != -1) {
-            glActiveTexture(GL_TEXTURE0);
-            glBindTexture(GL_TEXTURE_CUBE_MAP, cubemapId);
+            Graphics::GLState::current().bindTexture(0, cubemapId);
         } else {
             _cubemap->bind(0);
         }
         // draw cube vertices
-        glBindVertexArray(_vao);
-        glBindBuffer(GL_ARRAY_BUFFER, _vbo);
+        Graphics::GLState::current().bindVertexArray(_vao);
         glDrawArrays(GL_TRIANGLES, 0, 36);
         CHECK_GL_ERROR();
+        Graphics::RenderStats::current().recordDraw(36);
 
         _cubemap->unbind();
         glDepthFunc(GL_LESS);
@@ -47,19 +47,23 @@ namespace x {
 
         i32 currentWrite = _writeIndex.load(std::memory_order_acquire);
         i32 nextIndex    = (currentWrite + 1) % kBufferCount;
-        _bufferStates[currentWrite].store(BufferState::Ready, std::memory_order_release);
 
         BufferState expected = BufferState::Available;
         for (int attempts = 0; attempts < 3; ++attempts) {
             if (_bufferStates[nextIndex].compare_exchange_strong(expected,
                                                                  BufferState::Writing,
                                                                  std::memory_order_acq_rel)) {
+                // Carry this frame's state forward so the next update builds on it. Without this,
+                // entities created or destroyed in one buffer never reach the other two.
+                _buffers[nextIndex].copyFrom(_buffers[currentWrite]);
+                _bufferStates[currentWrite].store(BufferState::Ready, std::memory_order_release);
                 _writeIndex.store(nextIndex, std::memory_order_release);
                 return;
             }
             expected = BufferState::Available;
             std::this_thread::yield();
         }
+        _bufferStates[currentWrite].store(BufferState::Ready, std::memory_order_release);
     }
 
     void StateBuffer::swapReadBuffer() {
@@ -3,25 +3,25 @@
 //
 
 #include "TransformComponent.hpp"
-#include <glm/gtc/matrix_transform.hpp>
 
 namespace x {
-    static constexpr auto kIdentity = glm::mat4(1.0f);
-
     TransformComponent::TransformComponent()
         : _position(0.f, 0.f, 0.f), _rotation(0.f, 0.f, 0.f), _scale(1.f, 1.f, 1.f),
-          _transform(kIdentity), _needsUpdate(true) {}
+          _transform(Math::AffineTransform::identity()), _needsUpdate(true) {}
 
     void TransformComponent::setPosition(const glm::vec3& position) {
-        _position = position;
+        _position    = position;
+        _needsUpdate = true;
     }
 
     void TransformComponent::setRotation(const glm::vec3& rotation) {
-        _rotation = rotation;
+        _rotation    = rotation;
+        _needsUpdate = true;
     }
 
     void TransformComponent::setScale(const glm::vec3& scale) {
-        _scale = scale;
+        _scale       = scale;
+        _needsUpdate = true;
     }
 
     glm::vec3 TransformComponent::getPosition() const {
@@ -37,6 +37,10 @@ namespace x {
     }
 
     glm::mat4 TransformComponent::getMatrix() const {
+        return _transform.toMat4();
+    }
+
+    const Math::AffineTransform& TransformComponent::getAffine() const {
         return _transform;
     }
 
@@ -60,28 +64,7 @@ namespace x {
     }
 
     void TransformComponent::updateMM() {
-        const auto translation = matrixTranslation(_position);
-        const auto rotation    = matrixRotation(_rotation);
-        const auto scale       = matrixScaling(_scale);
-        _transform             = translation * rotation * scale;
-        _needsUpdate           = false;
-    }
-
-    glm::mat4 TransformComponent::matrixRotation(const glm::vec3& eulerAngles) const {
-        const auto pitch = eulerAngles.x;  // Rotation around X-axis
-        const auto yaw   = eulerAngles.y;  // Rotation around Y-axis
-        const auto roll  = eulerAngles.z;  // Rotation around Z-axis
-        const auto rotX  = glm::rotate(kIdentity, glm::radians(pitch), glm::vec3(1, 0, 0));
-        const auto rotY  = glm::rotate(kIdentity, glm::radians(yaw), glm::vec3(0, 1, 0));
-        const auto rotZ  = glm::rotate(kIdentity, glm::radians(roll), glm::vec3(0, 0, 1));
-        return rotX * rotY * rotZ;
-    }
-
-    glm::mat4 TransformComponent::matrixTranslation(const glm::vec3& position) const {
-        return glm::translate(kIdentity, position);
-    }
-
-    glm::mat4 TransformComponent::matrixScaling(const glm::vec3& scale) const {
-        return glm::scale(kIdentity, scale);
+        _transform   = Math::AffineTransform::fromTRS(_position, _rotation, _scale);
+        _needsUpdate = false;
     }
 }  // namespace x
\ No newline at end of file
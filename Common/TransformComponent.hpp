@@ -6,6 +6,7 @@
 
 #include "Types.hpp"
 #include "ComponentManager.hpp"
+#include "Math/AffineTransform.hpp"
 #include <glm/glm.hpp>
 
 namespace x {
@@ -18,7 +19,10 @@ namespace x {
         [[nodiscard]] glm::vec3 getPosition() const;
         [[nodiscard]] glm::vec3 getRotation() const;
         [[nodiscard]] glm::vec3 getScale() const;
+        /// @brief Expands the compact transform to a full matrix. Only call this where a mat4 is
+        /// actually needed (GPU upload); prefer getAffine() everywhere else.
         glm::mat4 getMatrix() const;
+        [[nodiscard]] const Math::AffineTransform& getAffine() const;
         void translate(const glm::vec3& translation);
         void rotate(const glm::vec3& rotation);
         void scale(const glm::vec3& scale);
@@ -28,12 +32,9 @@ namespace x {
         glm::vec3 _position;
         glm::vec3 _rotation;  // Stored in radians for internal calculations
         glm::vec3 _scale;
-        glm::mat4 _transform;
+        Math::AffineTransform _transform;
         bool _needsUpdate;
 
         void updateMM();
-        [[nodiscard]] glm::mat4 matrixRotation(const glm::vec3& eulerAngles) const;
-        [[nodiscard]] glm::mat4 matrixTranslation(const glm::vec3& position) const;
-        [[nodiscard]] glm::mat4 matrixScaling(const glm::vec3& scale) const;
     };
 }  // namespace x
@@ -0,0 +1,224 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "WorldStreamer.hpp"
+#include "ModelManager.hpp"
+#include "Filesystem/Filesystem.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace x {
+    WorldStreamer::WorldStreamer(Scene& scene,
+                                 Thread::ThreadPool& pool,
+                                 const str& directory,
+                                 const Settings& settings)
+        : _scene(scene), _pool(pool), _directory(directory), _settings(settings) {}
+
+    void WorldStreamer::update(GameState& state) {
+        _scene.setState(state);
+        // Cells hang below the scene root; make sure there is one so a cell never becomes it
+        if (!_scene.getRoot().valid()) { _scene.createEntity(); }
+
+        const auto camera = state.getCameraState().position;
+        pollLoads(camera);
+        requestCells(camera);
+
+        // Evict first so memory is freed before new cells are committed
+        const u32 evicted = evictCells(camera, _settings.entitiesPerFrame);
+        if (evicted < _settings.entitiesPerFrame) {
+            commitCells(state, _settings.entitiesPerFrame - evicted);
+        }
+    }
+
+    bool WorldStreamer::bake(const Scene& scene,
+                             const GameState& state,
+                             const str& directory,
+                             f32 cellSize) {
+        if (!Filesystem::Path(directory).createAll()) { return false; }
+
+        std::unordered_map<CellCoord, std::vector<EntityId>> cells;
+        for (const auto& entity : scene.getChildren(scene.getRoot())) {
+            glm::vec3 position;
+            if (const auto* transform = state.getComponent<TransformComponent>(entity)) {
+                position = transform->getPosition();
+            } else {
+                position = glm::vec3(scene.getWorldTransform(entity)[3]);
+            }
+            cells[getCell(position, cellSize)].push_back(entity);
+        }
+
+        for (const auto& [cell, roots] : cells) {
+            if (!scene.saveToFile(getCellPath(directory, cell), roots)) { return false; }
+        }
+        return true;
+    }
+
+    CellCoord WorldStreamer::getCell(const glm::vec3& position, f32 cellSize) {
+        const auto cell = glm::floor(position / cellSize);
+        return {CAST<i32>(cell.x), CAST<i32>(cell.y), CAST<i32>(cell.z)};
+    }
+
+    str WorldStreamer::getCellPath(const str& directory, const CellCoord& cell) {
+        const auto filename = "cell_" + std::to_string(cell.x) + "_" + std::to_string(cell.y) +
+                              "_" + std::to_string(cell.z) + ".xscene";
+        return Filesystem::Path(directory).join(filename).string();
+    }
+
+    size_t WorldStreamer::getResidentCellCount() const {
+        return std::count_if(_cells.begin(), _cells.end(), [](const auto& entry) {
+            return entry.second.state == CellState::Resident;
+        });
+    }
+
+    size_t WorldStreamer::getPendingCellCount() const {
+        return _loadsInFlight + _commitQueue.size();
+    }
+
+    void WorldStreamer::pollLoads(const glm::vec3& camera) {
+        for (auto it = _cells.begin(); it != _cells.end();) {
+            auto& cell = it->second;
+            if (cell.state != CellState::Loading ||
+                cell.loading.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                ++it;
+                continue;
+            }
+
+            _loadsInFlight--;
+            cell.decoded = cell.loading.get();
+            if (getDistance(it->first, camera) > _settings.evictRadius) {
+                // The camera moved away while this cell was loading
+                it = _cells.erase(it);
+                continue;
+            }
+
+            if (cell.decoded && cell.decoded->file.getEntityCount() > 0) {
+                cell.state       = CellState::Committing;
+                cell.entityCount = cell.decoded->file.getEntityCount();
+                _commitQueue.push_back(it->first);
+            } else {
+                // Nothing on disk for this cell; remember that so we don't ask again
+                cell.state = CellState::Empty;
+                cell.decoded.reset();
+            }
+            ++it;
+        }
+    }
+
+    void WorldStreamer::requestCells(const glm::vec3& camera) {
+        if (_loadsInFlight >= _settings.maxLoadsInFlight) { return; }
+
+        const auto center = getCell(camera, _settings.cellSize);
+        const i32 range   = CAST<i32>(std::ceil(_settings.loadRadius / _settings.cellSize));
+
+        std::vector<std::pair<f32, CellCoord>> candidates;
+        for (i32 z = center.z - range; z <= center.z + range; z++) {
+            for (i32 y = center.y - range; y <= center.y + range; y++) {
+                for (i32 x = center.x - range; x <= center.x + range; x++) {
+                    const CellCoord cell {x, y, z};
+                    if (_cells.find(cell) != _cells.end()) { continue; }
+                    const f32 distance = getDistance(cell, camera);
+                    if (distance <= _settings.loadRadius) {
+                        candidates.emplace_back(distance, cell);
+                    }
+                }
+            }
+        }
+
+        // Nearest cells first
+        std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) {
+            return a.first < b.first;
+        });
+
+        for (const auto& [distance, coord] : candidates) {
+            if (_loadsInFlight >= _settings.maxLoadsInFlight) { break; }
+            auto& cell   = _cells[coord];
+            cell.loading = _pool.submit(
+              [path = getCellPath(_directory, coord)]() { return decodeCell(path); });
+            _loadsInFlight++;
+        }
+    }
+
+    u32 WorldStreamer::evictCells(const glm::vec3& camera, u32 budget) {
+        std::vector<CellCoord> evict;
+        for (const auto& [coord, cell] : _cells) {
+            if (cell.state == CellState::Loading) { continue; }
+            if (getDistance(coord, camera) > _settings.evictRadius) { evict.push_back(coord); }
+        }
+
+        u32 evicted = 0;
+        for (const auto& coord : evict) {
+            const auto& cell = _cells.at(coord);
+            const u32 count  = CAST<u32>(cell.committed);
+            // Always make progress, even if a single cell is larger than the budget
+            if (evicted > 0 && evicted + count > budget) { break; }
+            removeCell(coord);
+            evicted += count;
+        }
+        return evicted;
+    }
+
+    void WorldStreamer::commitCells(GameState& state, u32 budget) {
+        while (budget > 0 && !_commitQueue.empty()) {
+            auto& cell = _cells.at(_commitQueue.front());
+
+            if (cell.committed == 0) {
+                cell.root    = _scene.createEntity();
+                cell.firstId = state.createEntities(cell.entityCount);
+            }
+
+            const size_t count = std::min<size_t>(budget, cell.entityCount - cell.committed);
+            _scene.instantiate(cell.decoded->file,
+                               cell.decoded->models,
+                               cell.firstId,
+                               cell.committed,
+                               cell.committed + count,
+                               cell.root);
+            cell.committed += count;
+            budget -= CAST<u32>(count);
+
+            if (cell.committed == cell.entityCount) {
+                // Components hold their own model handles, so the file can be unmapped now
+                cell.state = CellState::Resident;
+                cell.decoded.reset();
+                _commitQueue.pop_front();
+            }
+        }
+    }
+
+    void WorldStreamer::removeCell(const CellCoord& coord) {
+        const auto it = _cells.find(coord);
+        if (it == _cells.end()) { return; }
+
+        if (it->second.root.valid()) { _scene.removeEntity(it->second.root); }
+        if (it->second.state == CellState::Committing) {
+            _commitQueue.erase(std::find(_commitQueue.begin(), _commitQueue.end(), coord));
+        }
+        _cells.erase(it);
+    }
+
+    f32 WorldStreamer::getDistance(const CellCoord& cell, const glm::vec3& point) const {
+        const auto min     = glm::vec3(cell.x, cell.y, cell.z) * _settings.cellSize;
+        const auto max     = min + glm::vec3(_settings.cellSize);
+        const auto closest = glm::clamp(point, min, max);
+        return glm::length(point - closest);
+    }
+
+    std::unique_ptr<WorldStreamer::DecodedCell> WorldStreamer::decodeCell(const str& path) {
+        // Runs on a worker thread: only file I/O and CPU side asset imports happen here
+        if (!Filesystem::Path(path).exists()) { return nullptr; }
+
+        auto decoded = std::make_unique<DecodedCell>();
+        if (!decoded->file.open(path)) { return nullptr; }
+
+        const auto assets = decoded->file.getAssets();
+        decoded->models.reserve(assets.size());
+        for (size_t i = 0; i < assets.size(); i++) {
+            decoded->models.push_back(
+              ModelManager::instance().importModel(assets[i].assetId,
+                                                   decoded->file.getAssetPath(i)));
+        }
+        return decoded;
+    }
+}  // namespace x
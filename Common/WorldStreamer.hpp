@@ -0,0 +1,112 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "Scene.hpp"
+#include "SceneFormat.hpp"
+#include "Thread/ThreadPool.hpp"
+
+#include <deque>
+#include <future>
+#include <memory>
+#include <unordered_map>
+
+namespace x {
+    struct CellCoord {
+        i32 x = 0;
+        i32 y = 0;
+        i32 z = 0;
+
+        bool operator==(const CellCoord& other) const = default;
+    };
+}  // namespace x
+
+namespace std {
+    template<>
+    struct hash<x::CellCoord> {
+        std::size_t operator()(const x::CellCoord& cell) const {
+            // Large primes, see Teschner et al. "Optimized Spatial Hashing for Collision Detection"
+            return CAST<std::size_t>(cell.x) * 73856093u ^ CAST<std::size_t>(cell.y) * 19349663u ^
+                   CAST<std::size_t>(cell.z) * 83492791u;
+        }
+    };
+}  // namespace std
+
+namespace x {
+    struct StreamingSettings {
+        f32 cellSize         = 256.f;
+        f32 loadRadius       = 768.f;   // Cells closer than this to the camera are loaded
+        f32 evictRadius      = 1024.f;  // Keep larger than loadRadius to avoid thrashing
+        u32 entitiesPerFrame = 512;     // Entities committed or evicted per update
+        u32 maxLoadsInFlight = 4;
+    };
+
+    /// @brief Streams a world partitioned into a uniform grid of cells in and out of a Scene.
+    ///
+    /// Each cell is a separate binary scene file (see bake()). As the camera approaches a cell its
+    /// file is mapped, validated and its models imported on the thread pool. Decoded cells are
+    /// then committed into the GameState a bounded number of entities per update, and cells that
+    /// fall behind the camera are evicted.
+    ///
+    /// Call update() from IGame::update with the state being written that frame.
+    class WorldStreamer {
+    public:
+        using Settings = StreamingSettings;
+
+        WorldStreamer(Scene& scene,
+                      Thread::ThreadPool& pool,
+                      const str& directory,
+                      const Settings& settings = {});
+
+        void update(GameState& state);
+
+        /// @brief Splits the scene's top-level entities into cells by position and writes one
+        /// scene file per cell into directory.
+        static bool
+        bake(const Scene& scene, const GameState& state, const str& directory, f32 cellSize);
+        static CellCoord getCell(const glm::vec3& position, f32 cellSize);
+        static str getCellPath(const str& directory, const CellCoord& cell);
+
+        [[nodiscard]] size_t getResidentCellCount() const;
+        [[nodiscard]] size_t getPendingCellCount() const;
+
+    private:
+        enum class CellState { Loading, Committing, Resident, Empty };
+
+        struct DecodedCell {
+            SceneFormat::SceneFile file;
+            std::vector<ModelHandle> models;
+        };
+
+        struct Cell {
+            CellState state = CellState::Loading;
+            std::future<std::unique_ptr<DecodedCell>> loading;
+            std::unique_ptr<DecodedCell> decoded;
+            EntityId root;  // All of the cell's entities hang below this node
+            EntityId firstId;
+            size_t entityCount = 0;
+            size_t committed   = 0;
+        };
+
+        Scene& _scene;
+        Thread::ThreadPool& _pool;
+        str _directory;
+        Settings _settings;
+        std::unordered_map<CellCoord, Cell> _cells;
+        std::deque<CellCoord> _commitQueue;
+        u32 _loadsInFlight = 0;
+
+        void pollLoads(const glm::vec3& camera);
+        void requestCells(const glm::vec3& camera);
+        u32 evictCells(const glm::vec3& camera, u32 budget);
+        void commitCells(GameState& state, u32 budget);
+        void removeCell(const CellCoord& coord);
+        /// @brief Distance from point to the closest point of the cell's bounds
+        [[nodiscard]] f32 getDistance(const CellCoord& cell, const glm::vec3& point) const;
+
+        static std::unique_ptr<DecodedCell> decodeCell(const str& path);
+    };
+}  // namespace x
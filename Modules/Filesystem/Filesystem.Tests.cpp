@@ -6,6 +6,9 @@
 
 #include "Filesystem.hpp"
 
+#include <cstdio>
+#include <cstring>
+
 using namespace x;
 
 static const str oneMb     = "TestData/1MB.bin";
@@ -53,4 +56,30 @@ TEST_CASE("Filesystem::Path", "[Filesystem]") {
     auto newTestData = testData1Mb.replaceExtension("bin1");
     REQUIRE(newTestData.hasExtension());
     REQUIRE(newTestData.extension() == "bin1");
-}
\ No newline at end of file
+}
+
+TEST_CASE("Filesystem::MappedFile", "[Filesystem]") {
+    using Filesystem::FileWriter;
+    using Filesystem::MappedFile;
+
+    static const str mappedPath = "TestData/Mapped.bin";
+    std::vector<u8> bytes(4096 + 17);
+    for (size_t i = 0; i < bytes.size(); i++) {
+        bytes[i] = CAST<u8>(i * 31);
+    }
+    REQUIRE(FileWriter::writeAllBytes(mappedPath, bytes));
+
+    MappedFile file(mappedPath);
+    REQUIRE(file.valid());
+    REQUIRE(file.getSize() == bytes.size());
+    REQUIRE(std::memcmp(file.getData(), bytes.data(), bytes.size()) == 0);
+
+    MappedFile moved = std::move(file);
+    REQUIRE(!file.valid());
+    REQUIRE(moved.valid());
+    moved.close();
+    REQUIRE(!moved.valid());
+
+    REQUIRE(!MappedFile("TestData/DoesNotExist.bin").valid());
+    std::remove(mappedPath.c_str());
+}
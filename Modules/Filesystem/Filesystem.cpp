@@ -25,6 +25,8 @@
     #endif
 #else
     #include <sys/stat.h>
+    #include <sys/mman.h>
+    #include <fcntl.h>
 #endif
 
 namespace x::Filesystem {
@@ -155,6 +157,124 @@ namespace x::Filesystem {
     }
 #pragma endregion
 
+#pragma region MappedFile
+    MappedFile::MappedFile(const str& path) {
+        open(path);
+    }
+
+    MappedFile::~MappedFile() {
+        close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            close();
+            _data       = other._data;
+            _size       = other._size;
+            other._data = nullptr;
+            other._size = 0;
+#ifdef _WIN32
+            _file          = other._file;
+            _mapping       = other._mapping;
+            other._file    = nullptr;
+            other._mapping = nullptr;
+#endif
+        }
+        return *this;
+    }
+
+    bool MappedFile::open(const str& path) {
+        close();
+
+#ifdef _WIN32
+        HANDLE file = CreateFileA(path.c_str(),
+                                  GENERIC_READ,
+                                  FILE_SHARE_READ,
+                                  nullptr,
+                                  OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                                  nullptr);
+        if (file == INVALID_HANDLE_VALUE) { return false; }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping) {
+            CloseHandle(file);
+            return false;
+        }
+
+        const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view) {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+
+        _file    = file;
+        _mapping = mapping;
+        _data    = CAST<const u8*>(view);
+        _size    = CAST<size_t>(fileSize.QuadPart);
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) { return false; }
+
+        struct stat info {};
+        if (fstat(fd, &info) != 0 || info.st_size == 0) {
+            ::close(fd);
+            return false;
+        }
+
+        const auto size = CAST<size_t>(info.st_size);
+        void* view      = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        // The mapping keeps its own reference to the file
+        ::close(fd);
+        if (view == MAP_FAILED) { return false; }
+        madvise(view, size, MADV_WILLNEED);
+
+        _data = CAST<const u8*>(view);
+        _size = size;
+#endif
+        return true;
+    }
+
+    void MappedFile::close() {
+        if (!_data) { return; }
+
+#ifdef _WIN32
+        UnmapViewOfFile(_data);
+        CloseHandle(_mapping);
+        CloseHandle(_file);
+        _file    = nullptr;
+        _mapping = nullptr;
+#else
+        munmap(CCAST<u8*>(_data), _size);
+#endif
+        _data = nullptr;
+        _size = 0;
+    }
+
+    bool MappedFile::valid() const {
+        return _data != nullptr;
+    }
+
+    const u8* MappedFile::getData() const {
+        return _data;
+    }
+
+    size_t MappedFile::getSize() const {
+        return _size;
+    }
+#pragma endregion
+
 #pragma region Path
     Path Path::currentPath() {
         char buffer[1024];
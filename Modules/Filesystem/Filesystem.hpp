@@ -78,6 +78,35 @@ namespace x {
             }
         };
 
+        /// @brief Read-only memory mapping of an entire file. The OS pages data in on demand, so
+        /// large binary assets can be parsed in place without copying them into a buffer first.
+        class MappedFile {
+        public:
+            MappedFile() = default;
+            explicit MappedFile(const str& path);
+            ~MappedFile();
+
+            MappedFile(const MappedFile&)            = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+            MappedFile(MappedFile&& other) noexcept;
+            MappedFile& operator=(MappedFile&& other) noexcept;
+
+            bool open(const str& path);
+            void close();
+
+            [[nodiscard]] bool valid() const;
+            [[nodiscard]] const u8* getData() const;
+            [[nodiscard]] size_t getSize() const;
+
+        private:
+            const u8* _data = nullptr;
+            size_t _size    = 0;
+#ifdef _WIN32
+            void* _file    = nullptr;
+            void* _mapping = nullptr;
+#endif
+        };
+
         class StreamReader {};
 
         class StreamWriter {};
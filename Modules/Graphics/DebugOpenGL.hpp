@@ -114,6 +114,17 @@ namespace x::Graphics {
         if (count > 0) { return true; }
         return false;
     }
+
+    static constexpr bool skipErrorCheck() {
+        return false;
+    }
 }  // namespace x::Graphics
 
-#define CHECK_GL_ERROR() x::Graphics::checkError(__FILE__, __LINE__)
\ No newline at end of file
+// glGetError stalls until the driver has processed every queued command, so release builds only
+// check errors when X_CHECK_GL_ERRORS is defined. The debug output callback above is the cheaper
+// way to catch errors and is installed independently by enableDebugOutput().
+#if !defined(NDEBUG) || defined(X_CHECK_GL_ERRORS)
+    #define CHECK_GL_ERROR() x::Graphics::checkError(__FILE__, __LINE__)
+#else
+    #define CHECK_GL_ERROR() x::Graphics::skipErrorCheck()
+#endif
\ No newline at end of file
@@ -4,6 +4,8 @@
 
 #include "DebugUI.hpp"
 
+#include <algorithm>
+#include <vector>
 #include <imgui/imgui.h>
 #include <imgui/backends/imgui_impl_glfw.h>
 #include <imgui/backends/imgui_impl_opengl3.h>
@@ -29,6 +31,125 @@ namespace x::Graphics {
         ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
     }
 
+    bool DebugUI::drawGpuProfiler(const GpuProfiler& profiler) {
+        constexpr ImGuiWindowFlags windowFlags =
+          ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize |
+          ImGuiWindowFlags_NoCollapse;
+
+        ImGui::SetNextWindowBgAlpha(0.4f);
+        ImGui::Begin("GPU Profiler", nullptr, windowFlags);
+        ImGui::Columns(2, "gpuTimings");
+        for (const auto& timing : profiler.getTimings()) {
+            // Children are indented under their parent scope
+            ImGui::Text("%*s%s", CAST<i32>(timing.depth * 2), "", timing.name);
+            ImGui::NextColumn();
+            ImGui::Text("%.3f ms", timing.duration);
+            ImGui::NextColumn();
+        }
+        ImGui::Columns(1);
+        ImGui::Separator();
+        const bool exportTrace = ImGui::Button("Export Trace");
+        ImGui::End();
+        return exportTrace;
+    }
+
+    bool DebugUI::drawCpuProfiler(const ProfileCapture& capture) {
+        constexpr f32 kRowHeight = 16.f;
+
+        ImGui::SetNextWindowSize(ImVec2(720, 0), ImGuiCond_FirstUseEver);
+        ImGui::SetNextWindowBgAlpha(0.4f);
+        ImGui::Begin("CPU Profiler");
+        const bool exportTrace = ImGui::Button("Export Trace");
+
+        const f64 window   = std::max(capture.toMicroseconds(capture.lastTick), 1.0);
+        const f32 width    = std::max(ImGui::GetContentRegionAvail().x, 1.f);
+        auto* drawList     = ImGui::GetWindowDrawList();
+        const ImVec2 mouse = ImGui::GetIO().MousePos;
+        std::vector<std::pair<const char*, f64>> counters;
+
+        for (const auto& thread : capture.threads) {
+            if (thread.events.empty()) { continue; }
+
+            u32 maxDepth = 0;
+            for (const auto& event : thread.events) {
+                if (event.type == ProfileEvent::Type::Scope) {
+                    maxDepth = std::max(maxDepth, event.depth);
+                }
+            }
+
+            ImGui::Text("%s", thread.name.c_str());
+            const ImVec2 origin = ImGui::GetCursorScreenPos();
+            const f32 height    = CAST<f32>(maxDepth + 1) * kRowHeight;
+            ImGui::InvisibleButton(thread.name.c_str(), ImVec2(width, height));
+            const bool hovered = ImGui::IsItemHovered();
+            const auto toX     = [&](u64 tick) {
+                const f64 time = std::clamp(capture.toMicroseconds(tick), 0.0, window);
+                return origin.x + CAST<f32>(time / window) * width;
+            };
+
+            drawList->PushClipRect(origin, ImVec2(origin.x + width, origin.y + height), true);
+            for (const auto& event : thread.events) {
+                if (event.type == ProfileEvent::Type::Counter) {
+                    const auto it =
+                      std::find_if(counters.begin(), counters.end(), [&](const auto& counter) {
+                          return counter.first == event.name;
+                      });
+                    if (it != counters.end()) {
+                        it->second = event.getValue();
+                    } else {
+                        counters.emplace_back(event.name, event.getValue());
+                    }
+                    continue;
+                }
+                if (event.type == ProfileEvent::Type::Frame) {
+                    const f32 x = toX(event.begin);
+                    drawList->AddLine(ImVec2(x, origin.y),
+                                      ImVec2(x, origin.y + height),
+                                      IM_COL32(255, 255, 255, 96));
+                    continue;
+                }
+
+                // Scopes are colored by name so the same work is recognizable across frames
+                const u32 hash = CAST<u32>(RCAST<uintptr_t>(event.name) * 2654435761u);
+                const ImVec2 min(toX(event.begin),
+                                 origin.y + CAST<f32>(event.depth) * kRowHeight);
+                const ImVec2 max(std::max(toX(event.end), min.x + 1.f), min.y + kRowHeight - 1.f);
+                drawList->AddRectFilled(min,
+                                        max,
+                                        IM_COL32(80 + (hash & 0x7F),
+                                                 80 + ((hash >> 8) & 0x7F),
+                                                 80 + ((hash >> 16) & 0x7F),
+                                                 255));
+                if (max.x - min.x > 24.f) {
+                    drawList->PushClipRect(min, max, true);
+                    drawList->AddText(ImVec2(min.x + 2.f, min.y), IM_COL32_WHITE, event.name);
+                    drawList->PopClipRect();
+                }
+                if (hovered && mouse.x >= min.x && mouse.x < max.x && mouse.y >= min.y &&
+                    mouse.y < max.y) {
+                    const f64 duration = CAST<f64>(event.end - event.begin) /
+                                         capture.ticksPerMicrosecond / 1000.0;
+                    ImGui::SetTooltip("%s: %.3f ms", event.name, duration);
+                }
+            }
+            drawList->PopClipRect();
+        }
+
+        if (!counters.empty()) {
+            ImGui::Separator();
+            ImGui::Columns(2, "counters");
+            for (const auto& [name, value] : counters) {
+                ImGui::Text("%s", name);
+                ImGui::NextColumn();
+                ImGui::Text("%g", value);
+                ImGui::NextColumn();
+            }
+            ImGui::Columns(1);
+        }
+        ImGui::End();
+        return exportTrace;
+    }
+
     void DebugUI::shutdown() {
         ImGui_ImplOpenGL3_Shutdown();
         ImGui_ImplGlfw_Shutdown();
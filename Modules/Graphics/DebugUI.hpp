@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include "GpuProfiler.hpp"  // Includes glad, which must come before GLFW
+#include "Profiler.hpp"
 #include <GLFW/glfw3.h>
 
 namespace x::Graphics {
@@ -13,6 +15,12 @@ namespace x::Graphics {
         static void beginFrame();
         static void endFrame();
         static void shutdown();
+        /// @brief Draws the profiler's last timings as a tree. Returns true when the user asks
+        /// to export them.
+        static bool drawGpuProfiler(const GpuProfiler& profiler);
+        /// @brief Draws a flame view of a capture, one lane per thread, and the latest value of
+        /// each counter. Returns true when the user asks to export a trace.
+        static bool drawCpuProfiler(const ProfileCapture& capture);
 
     private:
         DebugUI() = default;
@@ -6,28 +6,23 @@
 
 #include "Graphics/PostProcessEffect.hpp"
 #include "Graphics/ShaderProgram.hpp"
-#include "Graphics/Texture.hpp"
 
 #include <memory>
 
 namespace x::Graphics {
     enum class AATechnique { FXAA, SMAA };
 
-    class AntiAliasing final : public PostProcessEffect {
+    class AntiAliasing final : public IPostProcessEffect {
     public:
         explicit AntiAliasing(const AATechnique technique = AATechnique::FXAA);
         ~AntiAliasing() override;
 
-        void onResize(int newWidth, int newHeight) override;
-        void apply() const override;
+        void apply(u32 inputTexture, u32 outputTexture, i32 width, i32 height) const override;
 
         void setTechnique(AATechnique tech);
-        void setTextureSize(i32 width, i32 height) const;
-        u32 getOutputTexture() const;
 
     private:
         AATechnique _technique;
-        std::unique_ptr<ShaderProgram> _shader;
-        std::unique_ptr<Texture> _outputTexture;
+        std::shared_ptr<ShaderProgram> _shader;
     };
 }  // namespace x::Graphics
\ No newline at end of file
@@ -3,77 +3,52 @@
 //
 
 #include "Tonemapper.hpp"
+#include "ShaderManager.hpp"
+#include "Graphics/GLState.hpp"
 #include "Graphics/Shaders/Include/Tonemapper_CS.h"
+#include "Graphics/Shaders/Include/TonemapFXAA_CS.h"
 
 namespace x::Graphics {
     Tonemapper::Tonemapper() {
-        const auto computeShader =
-          std::make_unique<Shader>(ShaderType::Compute, Tonemapper_CS_Source);
-        _shaderProgram = std::make_unique<ShaderProgram>();
-        _shaderProgram->attachShader(*computeShader);
-        _shaderProgram->link();
-
-        // Create output texture
-        _outputTexture = std::make_unique<Texture>();
-        if (!_outputTexture->create(0, 0, GL_RGBA8, GL_RGBA)) {
-            Panic("Failed to create output texture");
-        }
-        _outputTexture->setFilterMode(GL_LINEAR, GL_LINEAR);
-        _outputTexture->setWrapMode(GL_CLAMP_TO_EDGE);
+        _shaderProgram = ShaderManager::instance().getShaderProgram(Tonemapper_CS_Source);
 
         // Create params UBO
         // TODO: Go back and implement this in GpuBuffer
         glGenBuffers(1, &_paramsUbo);
-        glBindBuffer(GL_UNIFORM_BUFFER, _paramsUbo);
+        GLState::current().bindBuffer(GL_UNIFORM_BUFFER, _paramsUbo);
         glBufferData(GL_UNIFORM_BUFFER, sizeof(TonemapperParams), nullptr, GL_DYNAMIC_DRAW);
         updateParams();
-        glBindBufferBase(GL_UNIFORM_BUFFER, 0, _paramsUbo);
+        GLState::current().bindBufferBase(GL_UNIFORM_BUFFER, 0, _paramsUbo);
     }
 
     Tonemapper::~Tonemapper() {
-        _outputTexture.reset();
+        glDeleteBuffers(1, &_paramsUbo);
+        GLState::current().forgetBuffer(_paramsUbo);
     }
 
     void Tonemapper::updateParams() const {
-        glBindBuffer(GL_UNIFORM_BUFFER, _paramsUbo);
+        GLState::current().bindBuffer(GL_UNIFORM_BUFFER, _paramsUbo);
         glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(TonemapperParams), &_params);
     }
 
-    void Tonemapper::apply() const {
-        if (getRenderTarget() != 0) {
-            glBindFramebuffer(GL_FRAMEBUFFER, getRenderTarget());
-        } else {
-            glBindFramebuffer(GL_FRAMEBUFFER, 0);
-        }
-
-        _shaderProgram->use();
-        glBindBufferBase(GL_UNIFORM_BUFFER, 0, _paramsUbo);
+    void Tonemapper::apply(u32 inputTexture, u32 outputTexture, i32 width, i32 height) const {
+        // Fused groups are 16x16 threads that each write 2x2 pixels
+        const auto& program = _fxaa ? *_fusedProgram : *_shaderProgram;
+        const i32 groupSize = _fxaa ? 32 : 8;
+        program.use();
+        GLState::current().bindBufferBase(GL_UNIFORM_BUFFER, 0, _paramsUbo);
 
-        _outputTexture->bindImage(1, GL_WRITE_ONLY, GL_RGBA8);
-        glBindImageTexture(0, getInputTexture(), 0, GL_FALSE, 0, GL_READ_ONLY, GL_RGBA16F);
-
-        constexpr u32 kWorkGroups = 8;
-        const auto x              = (_outputTexture->getWidth() + (kWorkGroups - 1)) / kWorkGroups;
-        const auto y              = (_outputTexture->getHeight() + (kWorkGroups - 1)) / kWorkGroups;
-        _shaderProgram->dispatchCompute(x, y, 1);
-        glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);  // Ensure compute writes complete
-    }
-
-    void Tonemapper::setTextureSize(i32 width, i32 height) const {
-        _outputTexture->resize(width, height);
-    }
+        glBindImageTexture(1, outputTexture, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_RGBA8);
+        glBindImageTexture(0, inputTexture, 0, GL_FALSE, 0, GL_READ_ONLY, GL_RGBA16F);
 
-    u32 Tonemapper::getOutputTexture() const {
-        return _outputTexture->getId();
-    }
-
-    void Tonemapper::onResize(int newWidth, int newHeight) {
-        _outputTexture->resize(newWidth, newHeight);
+        const auto x = CAST<u32>((width + (groupSize - 1)) / groupSize);
+        const auto y = CAST<u32>((height + (groupSize - 1)) / groupSize);
+        program.dispatchCompute(x, y, 1);
     }
 
     void Tonemapper::setGamma(f32 gamma) {
         _params.gamma = gamma;
-        glBindBuffer(GL_UNIFORM_BUFFER, _paramsUbo);
+        GLState::current().bindBuffer(GL_UNIFORM_BUFFER, _paramsUbo);
         glBufferSubData(GL_UNIFORM_BUFFER,
                         offsetof(TonemapperParams, gamma),
                         sizeof(f32),
@@ -82,7 +57,7 @@ namespace x::Graphics {
 
     void Tonemapper::setExposure(f32 exposure) {
         _params.exposure = exposure;
-        glBindBuffer(GL_UNIFORM_BUFFER, _paramsUbo);
+        GLState::current().bindBuffer(GL_UNIFORM_BUFFER, _paramsUbo);
         glBufferSubData(GL_UNIFORM_BUFFER,
                         offsetof(TonemapperParams, exposure),
                         sizeof(f32),
@@ -91,10 +66,21 @@ namespace x::Graphics {
 
     void Tonemapper::setTonemapOperator(i32 op) {
         _params.tonemapOperator = op;
-        glBindBuffer(GL_UNIFORM_BUFFER, _paramsUbo);
+        GLState::current().bindBuffer(GL_UNIFORM_BUFFER, _paramsUbo);
         glBufferSubData(GL_UNIFORM_BUFFER,
                         offsetof(TonemapperParams, tonemapOperator),
                         sizeof(i32),
                         &_params.tonemapOperator);
     }
+
+    void Tonemapper::setFxaa(bool enabled) {
+        if (enabled && !_fusedProgram) {
+            _fusedProgram = ShaderManager::instance().getShaderProgram(TonemapFXAA_CS_Source);
+        }
+        _fxaa = enabled;
+    }
+
+    bool Tonemapper::getFxaa() const {
+        return _fxaa;
+    }
 }  // namespace x::Graphics
\ No newline at end of file
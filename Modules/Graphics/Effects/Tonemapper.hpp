@@ -6,7 +6,6 @@
 
 #include "Graphics/PostProcessEffect.hpp"
 #include "Graphics/ShaderProgram.hpp"
-#include "Graphics/Texture.hpp"
 
 #include <memory>
 
@@ -17,24 +16,26 @@ namespace x::Graphics {
     //     Exposure = 2,
     // };
 
-    class Tonemapper final : public PostProcessEffect {
+    class Tonemapper final : public IPostProcessEffect {
     public:
         Tonemapper();
         ~Tonemapper() override;
 
-        void apply() const override;
-        void setTextureSize(i32 width, i32 height) const;
-        u32 getOutputTexture() const;
-        void onResize(int newWidth, int newHeight) override;
+        void apply(u32 inputTexture, u32 outputTexture, i32 width, i32 height) const override;
 
         void setGamma(f32 gamma);
         void setExposure(f32 exposure);
         /// 0 = ACES, 1 = Reinhard, 2 = Exposure
         void setTonemapOperator(i32 op);
+        /// @brief Runs FXAA in the same dispatch, on tiles tonemapped into shared memory. Saves
+        /// AntiAliasing's full-screen read, write and barrier; the output stays RGBA8.
+        void setFxaa(bool enabled);
+        bool getFxaa() const;
 
     private:
-        std::unique_ptr<ShaderProgram> _shaderProgram;
-        std::unique_ptr<Texture> _outputTexture;
+        std::shared_ptr<ShaderProgram> _shaderProgram;
+        std::shared_ptr<ShaderProgram> _fusedProgram;  // Created on first setFxaa(true)
+        bool _fxaa = false;
         u32 _paramsUbo = 0;
         struct TonemapperParams {
             f32 exposure        = 1.0f;
@@ -0,0 +1,164 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "GLState.hpp"
+#include "DebugOpenGL.hpp"
+#include "RenderStats.hpp"
+
+#include <algorithm>
+
+namespace x::Graphics {
+    GLState& GLState::current() {
+        thread_local GLState state;
+        return state;
+    }
+
+    GLState::GLState() {
+        invalidate();
+    }
+
+    void GLState::beginFrame() {
+        _lastFrameStats = _stats;
+        _stats          = {};
+        invalidate();
+    }
+
+    void GLState::invalidate() {
+        _program     = kUnknown;
+        _vertexArray = kUnknown;
+        _buffers.fill(kUnknown);
+        _uniformBases.fill(kUnknown);
+        _storageBases.fill(kUnknown);
+        _textures.fill(kUnknown);
+    }
+
+    void GLState::invalidateTextures() {
+        _textures.fill(kUnknown);
+    }
+
+    void GLState::useProgram(u32 program) {
+        if (!track(_program, program)) { return; }
+        RenderStats::current().recordProgramSwitch();
+        glUseProgram(program);
+        CHECK_GL_ERROR();
+    }
+
+    void GLState::bindVertexArray(u32 vertexArray) {
+        if (!track(_vertexArray, vertexArray)) { return; }
+        glBindVertexArray(vertexArray);
+        CHECK_GL_ERROR();
+        // We don't know which index buffer the vertex array captured
+        _buffers[ElementArrayBuffer] = kUnknown;
+    }
+
+    void GLState::bindBuffer(GLenum target, u32 buffer) {
+        const auto slot = getBufferSlot(target);
+        if (slot != OtherBuffer && !track(_buffers[slot], buffer)) { return; }
+        if (slot == OtherBuffer) { _stats.issued++; }
+        glBindBuffer(target, buffer);
+        CHECK_GL_ERROR();
+    }
+
+    void GLState::bindBufferBase(GLenum target, u32 index, u32 buffer) {
+        u32* base = nullptr;
+        if (index < kMaxBufferBases) {
+            if (target == GL_UNIFORM_BUFFER) { base = &_uniformBases[index]; }
+            if (target == GL_SHADER_STORAGE_BUFFER) { base = &_storageBases[index]; }
+        }
+        if (base && !track(*base, buffer)) { return; }
+        if (!base) { _stats.issued++; }
+        glBindBufferBase(target, index, buffer);
+        CHECK_GL_ERROR();
+
+        // glBindBufferBase also binds the generic target, but only when it is actually issued
+        const auto slot = getBufferSlot(target);
+        if (slot != OtherBuffer) { _buffers[slot] = buffer; }
+    }
+
+    void GLState::bindBufferRange(GLenum target,
+                                  u32 index,
+                                  u32 buffer,
+                                  size_t offset,
+                                  size_t size) {
+        const auto slot = getBufferSlot(target);
+        if (slot != OtherBuffer) { _buffers[slot] = buffer; }
+        // The index no longer holds the whole buffer
+        if (index < kMaxBufferBases) {
+            if (target == GL_UNIFORM_BUFFER) { _uniformBases[index] = kUnknown; }
+            if (target == GL_SHADER_STORAGE_BUFFER) { _storageBases[index] = kUnknown; }
+        }
+        _stats.issued++;
+        glBindBufferRange(target, index, buffer, CAST<GLintptr>(offset), CAST<GLsizeiptr>(size));
+        CHECK_GL_ERROR();
+    }
+
+    void GLState::bindTexture(u32 unit, u32 texture) {
+        if (unit < kMaxTextureUnits && !track(_textures[unit], texture)) { return; }
+        if (unit >= kMaxTextureUnits) { _stats.issued++; }
+        RenderStats::current().recordTextureBind();
+        glBindTextureUnit(unit, texture);
+        CHECK_GL_ERROR();
+    }
+
+    void GLState::forgetProgram(u32 program) {
+        if (_program == program) { _program = kUnknown; }
+    }
+
+    void GLState::forgetVertexArray(u32 vertexArray) {
+        if (_vertexArray == vertexArray) {
+            _vertexArray                 = kUnknown;
+            _buffers[ElementArrayBuffer] = kUnknown;
+        }
+    }
+
+    void GLState::forgetBuffer(u32 buffer) {
+        const auto forget = [buffer](u32& slot) {
+            if (slot == buffer) { slot = kUnknown; }
+        };
+        std::for_each(_buffers.begin(), _buffers.end(), forget);
+        std::for_each(_uniformBases.begin(), _uniformBases.end(), forget);
+        std::for_each(_storageBases.begin(), _storageBases.end(), forget);
+    }
+
+    void GLState::forgetTexture(u32 texture) {
+        for (auto& slot : _textures) {
+            if (slot == texture) { slot = kUnknown; }
+        }
+    }
+
+    const GLStateStats& GLState::getStats() const {
+        return _stats;
+    }
+
+    const GLStateStats& GLState::getLastFrameStats() const {
+        return _lastFrameStats;
+    }
+
+    bool GLState::track(u32& slot, u32 value) {
+        if (slot == value) {
+            _stats.elided++;
+            return false;
+        }
+        slot = value;
+        _stats.issued++;
+        return true;
+    }
+
+    GLState::BufferSlot GLState::getBufferSlot(GLenum target) {
+        switch (target) {
+            case GL_ARRAY_BUFFER:
+                return ArrayBuffer;
+            case GL_ELEMENT_ARRAY_BUFFER:
+                return ElementArrayBuffer;
+            case GL_UNIFORM_BUFFER:
+                return UniformBuffer;
+            case GL_SHADER_STORAGE_BUFFER:
+                return ShaderStorageBuffer;
+            case GL_DRAW_INDIRECT_BUFFER:
+                return DrawIndirectBuffer;
+            default:
+                return OtherBuffer;
+        }
+    }
+}  // namespace x::Graphics
@@ -0,0 +1,89 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+
+#include <array>
+#include <glad.h>
+
+namespace x::Graphics {
+    struct GLStateStats {
+        u32 issued = 0;  // Binds that reached the driver
+        u32 elided = 0;  // Binds skipped because the object was already bound
+    };
+
+    /// @brief Shadows the GL binding state of the calling thread's context and skips binds that
+    /// would not change it. The wrappers (ShaderProgram, VertexArray, Texture, GpuBuffer) and the
+    /// render backend bind through here.
+    ///
+    /// GL code that binds objects directly leaves the shadow stale. Call invalidate() after such
+    /// code runs; beginFrame() does so once per frame.
+    class GLState {
+    public:
+        static constexpr u32 kMaxTextureUnits = 32;
+        static constexpr u32 kMaxBufferBases  = 16;
+
+        /// @brief State tracker of the calling thread, which owns the current context
+        static GLState& current();
+
+        /// @brief Invalidates the shadow state and starts counting a new frame
+        void beginFrame();
+        /// @brief Forgets every binding, forcing the next bind of each kind to be issued
+        void invalidate();
+        /// @brief Forgets the texture units only, for code that binds through glBindTexture
+        void invalidateTextures();
+
+        void useProgram(u32 program);
+        /// @brief The element array buffer is part of the vertex array's state, so binding a
+        /// vertex array also switches the tracked index buffer.
+        void bindVertexArray(u32 vertexArray);
+        void bindBuffer(GLenum target, u32 buffer);
+        void bindBufferBase(GLenum target, u32 index, u32 buffer);
+        /// @brief Ranges are always issued; ring buffers rarely bind the same range twice
+        void bindBufferRange(GLenum target, u32 index, u32 buffer, size_t offset, size_t size);
+        /// @brief Binds via glBindTextureUnit, which leaves the active texture unit untouched
+        void bindTexture(u32 unit, u32 texture);
+
+        // Deleted names can be reused by the driver; drop any cached binding that refers to them
+        void forgetProgram(u32 program);
+        void forgetVertexArray(u32 vertexArray);
+        void forgetBuffer(u32 buffer);
+        void forgetTexture(u32 texture);
+
+        /// @brief Counts for the frame in progress
+        [[nodiscard]] const GLStateStats& getStats() const;
+        /// @brief Counts for the last completed frame
+        [[nodiscard]] const GLStateStats& getLastFrameStats() const;
+
+    private:
+        static constexpr u32 kUnknown = 0xFFFFFFFF;
+
+        enum BufferSlot : u32 {
+            ArrayBuffer,
+            ElementArrayBuffer,
+            UniformBuffer,
+            ShaderStorageBuffer,
+            DrawIndirectBuffer,
+            OtherBuffer,  // Targets we do not track; always issued
+            BufferSlotCount,
+        };
+
+        u32 _program     = kUnknown;
+        u32 _vertexArray = kUnknown;
+        std::array<u32, BufferSlotCount> _buffers {};
+        std::array<u32, kMaxBufferBases> _uniformBases {};
+        std::array<u32, kMaxBufferBases> _storageBases {};
+        std::array<u32, kMaxTextureUnits> _textures {};
+        GLStateStats _stats;
+        GLStateStats _lastFrameStats;
+
+        GLState();
+
+        /// @brief Updates a cached binding; returns false if the bind can be skipped
+        bool track(u32& slot, u32 value);
+        static BufferSlot getBufferSlot(GLenum target);
+    };
+}  // namespace x::Graphics
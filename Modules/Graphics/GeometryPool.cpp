@@ -0,0 +1,135 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "GeometryPool.hpp"
+#include "DebugOpenGL.hpp"
+#include "GLState.hpp"
+#include "RenderStats.hpp"
+
+#include <algorithm>
+
+namespace x::Graphics {
+    GeometryPool::GeometryPool(const std::vector<VertexAttribute>& attributes,
+                               u32 vertexStride,
+                               u32 vertexCapacity,
+                               u32 indexCapacity)
+        : _vertexStride(vertexStride), _vertices(vertexCapacity), _indices(indexCapacity) {
+        glCreateVertexArrays(1, &_vao);
+        _vertexBuffer = resize(0, 0, CAST<size_t>(vertexCapacity) * vertexStride);
+        _indexBuffer  = resize(0, 0, CAST<size_t>(indexCapacity) * sizeof(u32));
+
+        // Every attribute reads from binding 0, so swapping the buffer is a single call
+        for (const auto& attribute : attributes) {
+            glEnableVertexArrayAttrib(_vao, attribute.index);
+            glVertexArrayAttribFormat(_vao,
+                                      attribute.index,
+                                      attribute.size,
+                                      attribute.type,
+                                      attribute.normalized,
+                                      CAST<GLuint>(RCAST<uintptr_t>(attribute.offset)));
+            glVertexArrayAttribBinding(_vao, attribute.index, 0);
+        }
+        glVertexArrayVertexBuffer(_vao, 0, _vertexBuffer, 0, CAST<GLsizei>(_vertexStride));
+        glVertexArrayElementBuffer(_vao, _indexBuffer);
+        if (CHECK_GL_ERROR()) { Panic("Failed to create geometry pool"); }
+    }
+
+    GeometryPool::~GeometryPool() {
+        glDeleteVertexArrays(1, &_vao);
+        GLState::current().forgetVertexArray(_vao);
+        for (const auto buffer : {_vertexBuffer, _indexBuffer}) {
+            glDeleteBuffers(1, &buffer);
+            GLState::current().forgetBuffer(buffer);
+        }
+    }
+
+    GeometryRange GeometryPool::allocate(const void* vertices,
+                                         u32 vertexCount,
+                                         std::span<const u32> indices) {
+        const auto indexCount = CAST<u32>(indices.size());
+        if (vertexCount == 0 || indexCount == 0) { return {}; }
+
+        auto vertexRange = _vertices.allocate(vertexCount);
+        if (!vertexRange.valid()) {
+            const u32 capacity = _vertices.getCapacity();
+            const u32 grown    = std::max(capacity * 2, capacity + vertexCount);
+            _vertexBuffer      = resize(_vertexBuffer,
+                                   CAST<size_t>(capacity) * _vertexStride,
+                                   CAST<size_t>(grown) * _vertexStride);
+            _vertices.grow(grown);
+            glVertexArrayVertexBuffer(_vao, 0, _vertexBuffer, 0, CAST<GLsizei>(_vertexStride));
+            vertexRange = _vertices.allocate(vertexCount);
+        }
+
+        auto indexRange = _indices.allocate(indexCount);
+        if (!indexRange.valid()) {
+            const u32 capacity = _indices.getCapacity();
+            const u32 grown    = std::max(capacity * 2, capacity + indexCount);
+            _indexBuffer       = resize(_indexBuffer,
+                                  CAST<size_t>(capacity) * sizeof(u32),
+                                  CAST<size_t>(grown) * sizeof(u32));
+            _indices.grow(grown);
+            glVertexArrayElementBuffer(_vao, _indexBuffer);
+            indexRange = _indices.allocate(indexCount);
+        }
+
+        glNamedBufferSubData(_vertexBuffer,
+                             CAST<GLintptr>(vertexRange.offset) * _vertexStride,
+                             CAST<GLsizeiptr>(vertexCount) * _vertexStride,
+                             vertices);
+        glNamedBufferSubData(_indexBuffer,
+                             CAST<GLintptr>(indexRange.offset) * sizeof(u32),
+                             CAST<GLsizeiptr>(indexCount) * sizeof(u32),
+                             indices.data());
+        CHECK_GL_ERROR();
+        RenderStats::current().recordUpload(CAST<size_t>(vertexCount) * _vertexStride +
+                                            indices.size_bytes());
+
+        return {vertexRange.offset, vertexCount, indexRange.offset, indexCount};
+    }
+
+    void GeometryPool::free(const GeometryRange& range) {
+        if (!range.valid()) { return; }
+        _vertices.free({range.baseVertex, range.vertexCount});
+        _indices.free({range.firstIndex, range.indexCount});
+    }
+
+    void GeometryPool::bind() const {
+        GLState::current().bindVertexArray(_vao);
+    }
+
+    u32 GeometryPool::getVertexArrayId() const {
+        return _vao;
+    }
+
+    u32 GeometryPool::getIndexBufferId() const {
+        return _indexBuffer;
+    }
+
+    u32 GeometryPool::getVertexStride() const {
+        return _vertexStride;
+    }
+
+    u32 GeometryPool::getVertexCount() const {
+        return _vertices.getUsed();
+    }
+
+    u32 GeometryPool::getIndexCount() const {
+        return _indices.getUsed();
+    }
+
+    GLuint GeometryPool::resize(GLuint buffer, size_t size, size_t capacity) {
+        GLuint resized = 0;
+        glCreateBuffers(1, &resized);
+        glNamedBufferStorage(resized, CAST<GLsizeiptr>(capacity), nullptr, GL_DYNAMIC_STORAGE_BIT);
+        if (buffer != 0) {
+            // GL orders the copy after any draw already submitted against the old buffer
+            glCopyNamedBufferSubData(buffer, resized, 0, 0, CAST<GLsizeiptr>(size));
+            glDeleteBuffers(1, &buffer);
+            GLState::current().forgetBuffer(buffer);
+        }
+        if (CHECK_GL_ERROR()) { Panic("Failed to resize geometry pool buffer"); }
+        return resized;
+    }
+}  // namespace x::Graphics
@@ -0,0 +1,89 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include <glad.h>
+#include "Types.hpp"
+#include "Panic.hpp"
+#include "VertexAttribute.hpp"
+#include "Memory/OffsetAllocator.hpp"
+
+#include <span>
+#include <vector>
+
+namespace x::Graphics {
+    /// @brief Layout of one glMultiDrawElementsIndirect command, as GL reads it.
+    struct DrawElementsIndirectCommand {
+        u32 count;
+        u32 instanceCount;
+        u32 firstIndex;
+        i32 baseVertex;
+        u32 baseInstance;
+    };
+
+    static_assert(sizeof(DrawElementsIndirectCommand) == 20);
+
+    /// @brief Where a mesh lives inside a GeometryPool. Indices are relative to baseVertex.
+    struct GeometryRange {
+        u32 baseVertex  = Memory::OffsetAllocator::kInvalidOffset;
+        u32 vertexCount = 0;
+        u32 firstIndex  = Memory::OffsetAllocator::kInvalidOffset;
+        u32 indexCount  = 0;
+
+        [[nodiscard]] bool valid() const {
+            return baseVertex != Memory::OffsetAllocator::kInvalidOffset;
+        }
+    };
+
+    /// @brief One vertex buffer, one index buffer and one vertex array shared by every mesh of
+    /// a vertex format. Meshes are sub-ranges handed out by Memory::OffsetAllocator, so drawing
+    /// any of them needs no vertex array switch, and any number of them can go into a single
+    /// glMultiDrawElementsIndirect.
+    ///
+    /// Both buffers double in size when full; existing ranges keep their offsets.
+    class GeometryPool {
+    public:
+        GeometryPool(const std::vector<VertexAttribute>& attributes,
+                     u32 vertexStride,
+                     u32 vertexCapacity,
+                     u32 indexCapacity);
+        ~GeometryPool();
+
+        GeometryPool(const GeometryPool&)            = delete;
+        GeometryPool& operator=(const GeometryPool&) = delete;
+
+        template<typename V>
+        GeometryRange allocate(const std::vector<V>& vertices, const std::vector<u32>& indices);
+        /// @brief Copies vertexCount vertices of the pool's stride and the indices into the pool.
+        GeometryRange allocate(const void* vertices, u32 vertexCount, std::span<const u32> indices);
+        void free(const GeometryRange& range);
+
+        void bind() const;
+        [[nodiscard]] u32 getVertexArrayId() const;
+        [[nodiscard]] u32 getIndexBufferId() const;
+        [[nodiscard]] u32 getVertexStride() const;
+        /// @brief Vertices and indices currently allocated
+        [[nodiscard]] u32 getVertexCount() const;
+        [[nodiscard]] u32 getIndexCount() const;
+
+    private:
+        GLuint _vao          = 0;
+        GLuint _vertexBuffer = 0;
+        GLuint _indexBuffer  = 0;
+        u32 _vertexStride;
+        Memory::OffsetAllocator _vertices;
+        Memory::OffsetAllocator _indices;
+
+        /// @brief Moves the contents of buffer into a new buffer of capacity bytes
+        static GLuint resize(GLuint buffer, size_t size, size_t capacity);
+    };
+
+    template<typename V>
+    GeometryRange GeometryPool::allocate(const std::vector<V>& vertices,
+                                         const std::vector<u32>& indices) {
+        if (sizeof(V) != _vertexStride) { Panic("Vertex type does not match the geometry pool"); }
+        return allocate(vertices.data(), CAST<u32>(vertices.size()), indices);
+    }
+}  // namespace x::Graphics
@@ -0,0 +1,111 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "GpuProfiler.hpp"
+#include "Panic.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace x::Graphics {
+    GpuProfiler::~GpuProfiler() {
+        for (auto& frame : _frames) {
+            if (!frame.queries.empty()) {
+                glDeleteQueries(CAST<GLsizei>(frame.queries.size()), frame.queries.data());
+            }
+        }
+    }
+
+    void GpuProfiler::beginFrame() {
+        _current    = (_current + 1) % kFrameLatency;
+        auto& frame = _frames[_current];
+        resolve(frame);
+
+        frame.usedQueries = 0;
+        frame.scopes.clear();
+        frame.open.clear();
+        push("Frame");
+    }
+
+    void GpuProfiler::endFrame() {
+        pop();
+        if (!_frames[_current].open.empty()) { Panic("GpuProfiler scope left open at frame end"); }
+    }
+
+    void GpuProfiler::push(const char* name) {
+        auto& frame = _frames[_current];
+        frame.open.push_back(CAST<u32>(frame.scopes.size()));
+        frame.scopes.push_back({name, CAST<u32>(frame.open.size() - 1), writeTimestamp(frame), 0});
+    }
+
+    void GpuProfiler::pop() {
+        auto& frame = _frames[_current];
+        if (frame.open.empty()) { Panic("GpuProfiler::pop() called without a matching push()"); }
+        frame.scopes[frame.open.back()].end = writeTimestamp(frame);
+        frame.open.pop_back();
+    }
+
+    std::span<const GpuTiming> GpuProfiler::getTimings() const {
+        return _timings;
+    }
+
+    f32 GpuProfiler::getFrameTime() const {
+        return _timings.empty() ? 0.f : _timings.front().duration;
+    }
+
+    str GpuProfiler::exportTrace() const {
+        // Complete ("X") events nest by time range, microseconds as the format expects
+        str trace = "[\n";
+        char buffer[256];
+        for (size_t i = 0; i < _timings.size(); i++) {
+            const auto& timing = _timings[i];
+            std::snprintf(buffer,
+                          sizeof(buffer),
+                          R"(  {"name": "%s", "ph": "X", "ts": %.3f, "dur": %.3f, )"
+                          R"("pid": 0, "tid": 0})",
+                          timing.name,
+                          timing.start * 1000.f,
+                          timing.duration * 1000.f);
+            trace += buffer;
+            trace += i + 1 < _timings.size() ? ",\n" : "\n";
+        }
+        trace += "]\n";
+        return trace;
+    }
+
+    u32 GpuProfiler::writeTimestamp(Frame& frame) {
+        if (frame.usedQueries == frame.queries.size()) {
+            frame.queries.push_back(0);
+            glGenQueries(1, &frame.queries.back());
+        }
+        glQueryCounter(frame.queries[frame.usedQueries], GL_TIMESTAMP);
+        return frame.usedQueries++;
+    }
+
+    void GpuProfiler::resolve(Frame& frame) {
+        if (frame.scopes.empty()) { return; }
+
+        // Queries complete in submission order, so the last one being ready means all are
+        GLint available = 0;
+        glGetQueryObjectiv(frame.queries[frame.usedQueries - 1],
+                           GL_QUERY_RESULT_AVAILABLE,
+                           &available);
+        if (!available) { return; }
+
+        std::vector<u64> timestamps(frame.usedQueries);
+        for (u32 i = 0; i < frame.usedQueries; i++) {
+            glGetQueryObjectui64v(frame.queries[i], GL_QUERY_RESULT, &timestamps[i]);
+        }
+
+        const u64 frameStart = timestamps[frame.scopes.front().begin];
+        const auto toMs      = [](u64 nanoseconds) { return CAST<f32>(nanoseconds) / 1000000.f; };
+        _timings.clear();
+        for (const auto& scope : frame.scopes) {
+            const u64 begin = timestamps[scope.begin];
+            const u64 end   = std::max(timestamps[scope.end], begin);
+            _timings.push_back(
+              {scope.name, scope.depth, toMs(begin - frameStart), toMs(end - begin)});
+        }
+    }
+}  // namespace x::Graphics
@@ -0,0 +1,96 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include <glad.h>
+#include "Types.hpp"
+
+#include <array>
+#include <span>
+#include <vector>
+
+namespace x::Graphics {
+    /// @brief GPU time spent in one profiler scope.
+    struct GpuTiming {
+        const char* name;  // Scope names are not copied, pass string literals
+        u32 depth;         // 0 for the frame itself
+        f32 start;         // ms since the frame began on the GPU
+        f32 duration;      // ms
+    };
+
+    /// @brief Times named, nested scopes on the GPU without stalling the CPU.
+    ///
+    /// Each scope writes a GL_TIMESTAMP query at its start and end. Queries go into a ring of
+    /// kFrameLatency frames, and a frame's results are only read back when its slot comes around
+    /// again, by which point the GPU has long finished it. A frame whose results are still not
+    /// available then is dropped rather than waited on.
+    ///
+    /// Call from the thread that owns the GL context.
+    class GpuProfiler {
+    public:
+        static constexpr u32 kFrameLatency = 4;
+
+        /// @brief Times the GPU work issued during its lifetime.
+        class Scope {
+        public:
+            Scope(GpuProfiler& profiler, const char* name) : _profiler(profiler) {
+                _profiler.push(name);
+            }
+
+            ~Scope() {
+                _profiler.pop();
+            }
+
+            Scope(const Scope&)            = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            GpuProfiler& _profiler;
+        };
+
+        GpuProfiler() = default;
+        ~GpuProfiler();
+
+        GpuProfiler(const GpuProfiler&)            = delete;
+        GpuProfiler& operator=(const GpuProfiler&) = delete;
+
+        /// @brief Reads back the frame recorded kFrameLatency frames ago and opens the root
+        /// "Frame" scope.
+        void beginFrame();
+        void endFrame();
+
+        void push(const char* name);
+        void pop();
+
+        /// @brief Scopes of the most recent frame read back, parents before their children
+        [[nodiscard]] std::span<const GpuTiming> getTimings() const;
+        /// @brief GPU time of the most recent frame read back in ms
+        [[nodiscard]] f32 getFrameTime() const;
+        /// @brief Formats getTimings() as Chrome trace events (chrome://tracing, Perfetto)
+        [[nodiscard]] str exportTrace() const;
+
+    private:
+        struct PendingScope {
+            const char* name;
+            u32 depth;
+            u32 begin;  // Query indices into the frame's queries
+            u32 end;
+        };
+
+        struct Frame {
+            std::vector<GLuint> queries;
+            u32 usedQueries = 0;
+            std::vector<PendingScope> scopes;
+            std::vector<u32> open;  // Indices of scopes not yet popped
+        };
+
+        std::array<Frame, kFrameLatency> _frames;
+        u32 _current = 0;
+        std::vector<GpuTiming> _timings;
+
+        u32 writeTimestamp(Frame& frame);
+        void resolve(Frame& frame);
+    };
+}  // namespace x::Graphics
@@ -0,0 +1,835 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "GLState.hpp"
+#include "HeadlessBackend.hpp"
+#include "MeshOptimizer.hpp"
+#include "MeshSimplifier.hpp"
+#include "RenderCommandList.hpp"
+#include "RenderGraph.hpp"
+#include "RenderQueue.hpp"
+#include "RenderStats.hpp"
+#include "StreamingBuffer.hpp"
+#include "UniformId.hpp"
+#include "VertexPacking.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace x::Graphics;
+
+static DrawPacket makePacket(RenderPass pass, u32 program, u32 material, u32 mesh, f32 depth) {
+    DrawPacket packet {};
+    packet.key         = RenderQueue::makeKey(pass, program, material, mesh, depth);
+    packet.program     = program;
+    packet.vertexArray = mesh;
+    packet.indexBuffer = mesh;
+    packet.indexCount  = 36;
+    // Any stable address works as a material identity
+    packet.material    = RCAST<void*>(CAST<uintptr_t>(program * 1000 + material));
+    return packet;
+}
+
+TEST_CASE("MeshOptimizer - Welds and reorders a grid without losing triangles", "[Graphics]") {
+    // Unindexed triangles in random order, the worst case for both cache and fetch
+    constexpr u32 kSize = 32;
+    std::vector<std::array<glm::vec3, 3>> triangles;
+    for (u32 y = 0; y < kSize; y++) {
+        for (u32 x = 0; x < kSize; x++) {
+            const glm::vec3 a(x, y, 0), b(x + 1, y, 0), c(x + 1, y + 1, 0), d(x, y + 1, 0);
+            triangles.push_back({a, b, c});
+            triangles.push_back({a, c, d});
+        }
+    }
+    std::mt19937 rng(3);
+    std::shuffle(triangles.begin(), triangles.end(), rng);
+
+    std::vector<VertexPosNormTanBiTanTex> vertices;
+    std::vector<u32> indices;
+    for (const auto& triangle : triangles) {
+        for (const auto& position : triangle) {
+            VertexPosNormTanBiTanTex vertex {};
+            vertex.position = position;
+            vertex.normal   = glm::vec3(0, 0, 1);
+            indices.push_back(CAST<u32>(vertices.size()));
+            vertices.push_back(vertex);
+        }
+    }
+
+    const auto stats = optimizeMesh(vertices, indices);
+    REQUIRE(stats.triangles == kSize * kSize * 2);
+    REQUIRE(stats.verticesBefore == kSize * kSize * 6);
+    REQUIRE(stats.verticesAfter == (kSize + 1) * (kSize + 1));
+    REQUIRE(stats.acmrBefore == 3.f);
+    REQUIRE(stats.acmrAfter < 0.8f);
+    REQUIRE(stats.acmrAfter == computeAcmr(indices, CAST<u32>(vertices.size())));
+
+    // Same triangles with the same winding, each rotated to start at its smallest vertex
+    const auto canonical = [](std::array<glm::vec3, 3> t) {
+        const auto less = [](const glm::vec3& a, const glm::vec3& b) {
+            return std::tie(a.x, a.y, a.z) < std::tie(b.x, b.y, b.z);
+        };
+        while (less(t[1], t[0]) || less(t[2], t[0])) {
+            std::rotate(t.begin(), t.begin() + 1, t.end());
+        }
+        return std::array<f32, 9> {
+          t[0].x, t[0].y, t[0].z, t[1].x, t[1].y, t[1].z, t[2].x, t[2].y, t[2].z};
+    };
+    std::vector<std::array<f32, 9>> expected, actual;
+    for (const auto& triangle : triangles) {
+        expected.push_back(canonical(triangle));
+    }
+    for (size_t i = 0; i < indices.size(); i += 3) {
+        actual.push_back(canonical({vertices[indices[i]].position,
+                                    vertices[indices[i + 1]].position,
+                                    vertices[indices[i + 2]].position}));
+    }
+    std::sort(expected.begin(), expected.end());
+    std::sort(actual.begin(), actual.end());
+    REQUIRE(actual == expected);
+
+    // Fetch order: every vertex is first used after all lower numbered ones
+    u32 next = 0;
+    for (const u32 index : indices) {
+        REQUIRE(index <= next);
+        if (index == next) { next++; }
+    }
+}
+
+TEST_CASE("MeshOptimizer - ACMR of a FIFO cache", "[Graphics]") {
+    // A strip-like sequence reuses two vertices per triangle
+    const std::vector<u32> strip = {0, 1, 2, 1, 2, 3, 2, 3, 4, 3, 4, 5};
+    REQUIRE(computeAcmr(strip, 6, 16) == 6.f / 4.f);
+    // With room for only three vertices, revisiting vertex 0 misses
+    const std::vector<u32> revisit = {0, 1, 2, 3, 4, 5, 0, 4, 5};
+    REQUIRE(computeAcmr(revisit, 6, 3) == 7.f / 3.f);
+    REQUIRE(computeAcmr(revisit, 6, 16) == 2.f);
+}
+
+TEST_CASE("MeshSimplifier - Flat grid keeps its outline and orientation", "[Graphics]") {
+    constexpr u32 kSize = 32;
+    std::vector<VertexPosNormTanBiTanTex> vertices;
+    std::vector<u32> indices;
+    for (u32 y = 0; y <= kSize; y++) {
+        for (u32 x = 0; x <= kSize; x++) {
+            VertexPosNormTanBiTanTex vertex {};
+            vertex.position  = glm::vec3(x, y, 0);
+            vertex.normal    = glm::vec3(0, 0, 1);
+            vertex.texCoords = glm::vec2(x, y) / CAST<f32>(kSize);
+            vertices.push_back(vertex);
+        }
+    }
+    for (u32 y = 0; y < kSize; y++) {
+        for (u32 x = 0; x < kSize; x++) {
+            const u32 a = y * (kSize + 1) + x, b = a + 1, c = a + kSize + 1, d = c + 1;
+            indices.insert(indices.end(), {a, b, d, a, d, c});
+        }
+    }
+
+    f32 error      = 0.f;
+    const auto lod = simplifyMesh(vertices, indices, indices.size() / 4, 1e-3f, &error);
+    REQUIRE(lod.size() <= indices.size() / 4);
+    REQUIRE(lod.size() % 3 == 0);
+    REQUIRE(error < 1e-3f);
+
+    // A flat, linearly textured grid simplifies without error: same area, nothing flipped
+    f32 area = 0.f;
+    for (size_t i = 0; i < lod.size(); i += 3) {
+        const glm::vec3& a     = vertices[lod[i]].position;
+        const glm::vec3 normal = glm::cross(vertices[lod[i + 1]].position - a,
+                                            vertices[lod[i + 2]].position - a);
+        REQUIRE(normal.z > 0.f);
+        area += normal.z * 0.5f;
+    }
+    REQUIRE(std::abs(area - CAST<f32>(kSize * kSize)) < 1e-3f);
+}
+
+TEST_CASE("MeshSimplifier - LOD chain halves triangles with growing error", "[Graphics]") {
+    // UV sphere; the seam column and the poles share positions, so they stay locked
+    constexpr u32 kRings = 64;
+    std::vector<VertexPosNormTanBiTanTex> vertices;
+    std::vector<u32> indices;
+    for (u32 i = 0; i <= kRings; i++) {
+        for (u32 j = 0; j <= kRings; j++) {
+            const f32 theta = std::numbers::pi_v<f32> * CAST<f32>(i) / kRings;
+            const f32 phi   = 2.f * std::numbers::pi_v<f32> * CAST<f32>(j) / kRings;
+            VertexPosNormTanBiTanTex vertex {};
+            vertex.position  = glm::vec3(std::sin(theta) * std::cos(phi),
+                                        std::sin(theta) * std::sin(phi),
+                                        std::cos(theta));
+            vertex.normal    = vertex.position;
+            vertex.texCoords = glm::vec2(j, i) / CAST<f32>(kRings);
+            vertices.push_back(vertex);
+        }
+    }
+    for (u32 i = 0; i < kRings; i++) {
+        for (u32 j = 0; j < kRings; j++) {
+            const u32 a = i * (kRings + 1) + j, b = a + 1, c = a + kRings + 1, d = c + 1;
+            indices.insert(indices.end(), {a, c, d, a, d, b});
+        }
+    }
+    const auto fullCount = CAST<u32>(indices.size());
+
+    const auto lods = generateLods(vertices, indices);
+    REQUIRE(lods.size() == kMaxLods);
+    REQUIRE(lods[0].firstIndex == 0);
+    REQUIRE(lods[0].indexCount == fullCount);
+    REQUIRE(lods[0].error == 0.f);
+    for (size_t i = 1; i < lods.size(); i++) {
+        REQUIRE(lods[i].firstIndex == lods[i - 1].firstIndex + lods[i - 1].indexCount);
+        REQUIRE(lods[i].indexCount * 4 <= lods[i - 1].indexCount * 3);
+        REQUIRE(lods[i].error > lods[i - 1].error);
+        REQUIRE(lods[i].error < 0.05f);
+    }
+    REQUIRE(indices.size() == lods.back().firstIndex + lods.back().indexCount);
+    REQUIRE(std::all_of(indices.begin(), indices.end(), [&](u32 index) {
+        return index < vertices.size();
+    }));
+}
+
+TEST_CASE("MeshSimplifier - LOD selection follows projected error", "[Graphics]") {
+    const std::vector<MeshLod> lods = {{0, 300, 0.f}, {300, 150, 0.01f}, {450, 75, 0.1f}};
+    // With a 90 degree field of view, an error e at distance d covers e / (2 * d) of the screen
+    REQUIRE(selectLod(lods, 1.f, 1.f, 1.f, 0.001f) == 0);
+    REQUIRE(selectLod(lods, 1.f, 10.f, 1.f, 0.001f) == 1);
+    REQUIRE(selectLod(lods, 1.f, 100.f, 1.f, 0.001f) == 2);
+    // Scaling the model up scales its error with it
+    REQUIRE(selectLod(lods, 10.f, 100.f, 1.f, 0.001f) == 1);
+    REQUIRE(selectLod(std::span<const MeshLod>(lods).first(1), 1.f, 1000.f, 1.f, 0.001f) == 0);
+}
+
+/// Hands out fake texture ids and records what a GL backend would have been asked to do
+struct RecordingGraphBackend final : IRenderGraphBackend {
+    u32 nextTexture = 1;
+    u32 created     = 0;
+    u32 destroyed   = 0;
+    std::vector<u32> barriers;
+
+    u32 createTexture(const RenderTextureDesc&) override {
+        created++;
+        return nextTexture++;
+    }
+
+    void destroyTexture(u32) override {
+        destroyed++;
+    }
+
+    void memoryBarrier(u32 bits) override {
+        barriers.push_back(bits);
+    }
+};
+
+TEST_CASE("RenderGraph - Culls passes nothing live reads", "[Graphics]") {
+    constexpr RenderTextureDesc desc {64, 64, 1};
+    RenderGraph graph;
+    std::vector<str> executed;
+    const auto record = [&](const char* name) {
+        return [&executed, name](const RenderGraph&) { executed.emplace_back(name); };
+    };
+
+    const auto backbuffer = graph.importTexture("Backbuffer", 100, desc);
+    const auto color      = graph.createTexture("Color", desc);
+    const auto unused     = graph.createTexture("Unused", desc);
+    const auto debug      = graph.createTexture("Debug", desc);
+    graph.addPass(
+      "Scene",
+      [&](auto& builder) { builder.write(color, RenderAccess::ColorAttachment); },
+      record("Scene"));
+    graph.addPass(
+      "Unused",
+      [&](auto& builder) {
+          builder.read(color, RenderAccess::Sampled);
+          builder.write(unused, RenderAccess::ImageWrite);
+      },
+      record("Unused"));
+    graph.addPass(
+      "Composite",
+      [&](auto& builder) {
+          builder.read(color, RenderAccess::Sampled);
+          builder.write(backbuffer, RenderAccess::ColorAttachment);
+      },
+      record("Composite"));
+    // Only feeds a pass that is itself culled
+    graph.addPass(
+      "Debug",
+      [&](auto& builder) { builder.write(debug, RenderAccess::ColorAttachment); },
+      record("Debug"));
+    graph.addPass(
+      "DebugView",
+      [&](auto& builder) { builder.read(debug, RenderAccess::Sampled); },
+      record("DebugView"));
+    graph.addPass(
+      "Present",
+      [&](auto& builder) { builder.setSideEffect(); },
+      record("Present"));
+
+    RecordingGraphBackend backend;
+    graph.execute(backend);
+    REQUIRE(executed == std::vector<str> {"Scene", "Composite", "Present"});
+    REQUIRE(graph.isCulled(1));
+    REQUIRE(graph.isCulled(3));
+    REQUIRE(graph.isCulled(4));
+    REQUIRE(graph.getTexture(backbuffer) == 100);
+    // Culled passes allocate nothing
+    REQUIRE(graph.getPoolSize() == 1);
+    REQUIRE(backend.created == 1);
+}
+
+TEST_CASE("RenderGraph - Transient textures alias across disjoint lifetimes", "[Graphics]") {
+    constexpr RenderTextureDesc hdr {1600, 900, 1};
+    constexpr RenderTextureDesc ldr {1600, 900, 2};
+    RenderGraph graph;
+    RecordingGraphBackend backend;
+    std::vector<u32> textures;
+
+    // A four effect chain only ever has an input and an output alive at once
+    for (u32 frame = 0; frame < 3; frame++) {
+        textures.clear();
+        graph.reset();
+        const RenderResource chain[] = {
+          graph.createTexture("Scene", hdr),
+          graph.createTexture("Bloom", hdr),
+          graph.createTexture("Taa", hdr),
+          graph.createTexture("Tonemapped", ldr),
+          graph.createTexture("Fxaa", ldr),
+        };
+        graph.addPass(
+          "Scene",
+          [&](auto& builder) { builder.write(chain[0], RenderAccess::ColorAttachment); },
+          [&](const RenderGraph& g) { textures.push_back(g.getTexture(chain[0])); });
+        for (u32 i = 1; i < std::size(chain); i++) {
+            graph.addPass(
+              "Effect",
+              [&, i](auto& builder) {
+                  builder.read(chain[i - 1], RenderAccess::Sampled);
+                  builder.write(chain[i], RenderAccess::ImageWrite);
+              },
+              [&, i](const RenderGraph& g) { textures.push_back(g.getTexture(chain[i])); });
+        }
+        graph.addPass(
+          "Present",
+          [&](auto& builder) {
+              builder.read(chain[std::size(chain) - 1], RenderAccess::Sampled);
+              builder.setSideEffect();
+          },
+          [](const RenderGraph&) {});
+        graph.execute(backend);
+
+        REQUIRE(graph.getPoolSize() == 4);
+        REQUIRE(textures[0] == textures[2]);
+        REQUIRE(textures[0] != textures[1]);
+        REQUIRE(textures[3] != textures[4]);
+    }
+    // The pool carries across frames
+    REQUIRE(backend.created == 4);
+
+    // Textures a frame no longer asks for are released once they have idled long enough
+    for (u32 frame = 0; frame <= RenderGraph::kMaxIdleFrames; frame++) {
+        graph.reset();
+        const auto ldrOnly = graph.createTexture("Ldr", ldr);
+        graph.addPass(
+          "Present",
+          [&](auto& builder) {
+              builder.write(ldrOnly, RenderAccess::ColorAttachment);
+              builder.setSideEffect();
+          },
+          [](const RenderGraph&) {});
+        graph.execute(backend);
+    }
+    REQUIRE(graph.getPoolSize() == 1);
+    REQUIRE(backend.destroyed == 3);
+
+    graph.releasePool(backend);
+    REQUIRE(graph.getPoolSize() == 0);
+    REQUIRE(backend.destroyed == backend.created);
+}
+
+TEST_CASE("RenderGraph - Barriers only follow image writes", "[Graphics]") {
+    constexpr RenderTextureDesc desc {64, 64, 1};
+    RenderGraph graph;
+    const auto scene  = graph.importTexture("Scene", 7, desc);
+    const auto first  = graph.createTexture("First", desc);
+    const auto second = graph.createTexture("Second", desc);
+    const auto nothing = [](const RenderGraph&) {};
+
+    graph.addPass(
+      "Scene",
+      [&](auto& builder) { builder.write(scene, RenderAccess::ColorAttachment); },
+      nothing);
+    // Framebuffer writes are visible to later commands without a barrier
+    graph.addPass(
+      "Tonemap",
+      [&](auto& builder) {
+          builder.read(scene, RenderAccess::ImageRead);
+          builder.write(first, RenderAccess::ImageWrite);
+      },
+      nothing);
+    graph.addPass(
+      "Blur",
+      [&](auto& builder) {
+          builder.read(first, RenderAccess::ImageRead);
+          builder.write(second, RenderAccess::ImageWrite);
+      },
+      nothing);
+    // Sampling both outputs takes one barrier covering both writes
+    graph.addPass(
+      "Composite",
+      [&](auto& builder) {
+          builder.read(first, RenderAccess::Sampled);
+          builder.read(second, RenderAccess::Sampled);
+          builder.write(scene, RenderAccess::ColorAttachment);
+      },
+      nothing);
+    graph.addPass(
+      "Present",
+      [&](auto& builder) {
+          builder.read(second, RenderAccess::Sampled);
+          builder.setSideEffect();
+      },
+      nothing);
+
+    RecordingGraphBackend backend;
+    graph.execute(backend);
+    REQUIRE(graph.getBarriers(0) == 0);
+    REQUIRE(graph.getBarriers(1) == 0);
+    REQUIRE(graph.getBarriers(2) == ImageAccessBarrier);
+    REQUIRE(graph.getBarriers(3) == TextureFetchBarrier);
+    REQUIRE(graph.getBarriers(4) == 0);
+    REQUIRE(backend.barriers == std::vector<u32> {ImageAccessBarrier, TextureFetchBarrier});
+}
+
+TEST_CASE("RenderQueue - Radix sort orders keys", "[Graphics]") {
+    std::mt19937 random(42);
+    RenderQueue queue;
+    std::vector<u64> keys;
+    for (i32 i = 0; i < 5000; i++) {
+        const auto packet = makePacket(RenderPass::Opaque,
+                                       random() % 4,
+                                       random() % 16,
+                                       random() % 64,
+                                       CAST<f32>(random() % 1000) * 0.1f);
+        keys.push_back(packet.key);
+        queue.submit(packet);
+    }
+    queue.sort();
+
+    std::sort(keys.begin(), keys.end());
+    REQUIRE(queue.size() == keys.size());
+    for (size_t i = 0; i < keys.size(); i++) {
+        REQUIRE(queue[i].key == keys[i]);
+    }
+}
+
+TEST_CASE("RenderQueue - Depth ordering per pass", "[Graphics]") {
+    RenderQueue queue;
+    queue.submit(makePacket(RenderPass::Transparent, 1, 1, 1, 5.f));
+    queue.submit(makePacket(RenderPass::Opaque, 1, 1, 1, 20.f));
+    queue.submit(makePacket(RenderPass::Transparent, 1, 1, 1, 50.f));
+    queue.submit(makePacket(RenderPass::Opaque, 1, 1, 1, 2.f));
+    queue.submit(makePacket(RenderPass::Transparent, 2, 2, 2, 10.f));
+    queue.sort();
+
+    // Opaque first, front to back
+    REQUIRE(queue[0].key == RenderQueue::makeKey(RenderPass::Opaque, 1, 1, 1, 2.f));
+    REQUIRE(queue[1].key == RenderQueue::makeKey(RenderPass::Opaque, 1, 1, 1, 20.f));
+    // Then transparent, back to front regardless of state
+    REQUIRE(queue[2].key == RenderQueue::makeKey(RenderPass::Transparent, 1, 1, 1, 50.f));
+    REQUIRE(queue[3].key == RenderQueue::makeKey(RenderPass::Transparent, 2, 2, 2, 10.f));
+    REQUIRE(queue[4].key == RenderQueue::makeKey(RenderPass::Transparent, 1, 1, 1, 5.f));
+}
+
+TEST_CASE("RenderQueue - Sorting removes redundant binds", "[Graphics]") {
+    constexpr u32 kPrograms  = 4;
+    constexpr u32 kMaterials = 8;
+    constexpr u32 kMeshes    = 32;
+    constexpr u32 kCount     = 4096;
+
+    std::mt19937 random(7);
+    RenderQueue queue;
+    queue.reserve(kCount);
+    for (u32 i = 0; i < kCount; i++) {
+        queue.submit(makePacket(RenderPass::Opaque,
+                                1 + random() % kPrograms,
+                                1 + random() % kMaterials,
+                                1 + random() % kMeshes,
+                                CAST<f32>(random() % 100)));
+    }
+
+    // Unsorted flush is what drawing in component order costs
+    HeadlessBackend unsorted;
+    queue.flush(unsorted);
+
+    queue.sort();
+    HeadlessBackend sorted;
+    queue.flush(sorted);
+
+    REQUIRE(sorted.drawCalls == kCount);
+    REQUIRE(unsorted.drawCalls == kCount);
+    REQUIRE(sorted.programBinds == kPrograms);
+    REQUIRE(sorted.materialBinds == kPrograms * kMaterials);
+    REQUIRE(sorted.vertexArrayBinds <= kPrograms * kMaterials * kMeshes);
+    REQUIRE(sorted.programBinds * 100 < unsorted.programBinds);
+    REQUIRE(sorted.vertexArrayBinds * 2 < unsorted.vertexArrayBinds);
+    REQUIRE(std::is_sorted(sorted.drawnKeys.begin(), sorted.drawnKeys.end()));
+}
+
+TEST_CASE("RenderQueue - Instanced packets merge into one draw per mesh", "[Graphics]") {
+    constexpr u32 kModels    = 3;
+    constexpr u32 kAsteroids = 20000;
+
+    std::mt19937 random(11);
+    RenderQueue queue;
+    for (u32 i = 0; i < kAsteroids; i++) {
+        const u32 model = 1 + random() % kModels;
+        const f32 depth = CAST<f32>(random() % 500);
+        auto packet     = makePacket(RenderPass::Opaque, 1, model, model, depth);
+        packet.flags    = Instanced;
+        queue.submit(packet);
+    }
+    // Non instanced packets still get a draw each
+    queue.submit(makePacket(RenderPass::Opaque, 2, 1, 1, 0.f));
+    queue.sort();
+
+    HeadlessBackend backend;
+    queue.flush(backend);
+    REQUIRE(backend.drawCalls == kModels + 1);
+    REQUIRE(backend.drawCommands == kModels + 1);
+    REQUIRE(backend.instances == kAsteroids + 1);
+    REQUIRE(backend.programBinds == 2);
+}
+
+TEST_CASE("RenderQueue - Meshes in a geometry pool share one multi-draw", "[Graphics]") {
+    constexpr u32 kMeshes = 50;
+    constexpr u32 kCount  = 5000;
+
+    std::mt19937 random(5);
+    RenderQueue queue;
+    for (u32 i = 0; i < kCount; i++) {
+        // Every mesh shares vertex array 1 and index buffer 1, at its own offsets
+        const u32 mesh    = random() % kMeshes;
+        auto packet       = makePacket(RenderPass::Opaque, 1, 1, 1, 0.f);
+        packet.firstIndex = mesh * 36;
+        packet.baseVertex = mesh * 24;
+        packet.key        = RenderQueue::makeKey(
+          RenderPass::Opaque, 1, 1, packet.firstIndex, CAST<f32>(random() % 500));
+        packet.flags    = Instanced;
+        queue.submit(packet);
+    }
+    queue.sort();
+
+    HeadlessBackend backend;
+    queue.flush(backend);
+    REQUIRE(backend.drawCalls == 1);
+    REQUIRE(backend.drawCommands == kMeshes);
+    REQUIRE(backend.instances == kCount);
+    REQUIRE(backend.vertexArrayBinds == 1);
+}
+
+TEST_CASE("RenderCommandList - Per thread lists merge in key order", "[Graphics]") {
+    constexpr size_t kThreads = 4;
+    constexpr u32 kPerThread  = 2000;
+    constexpr u32 kModels     = 16;
+
+    RenderCommandList commands;
+    commands.begin(kThreads);
+    std::vector<std::thread> threads;
+    for (size_t thread = 0; thread < kThreads; thread++) {
+        threads.emplace_back([&commands, thread] {
+            std::mt19937 random(CAST<u32>(thread));
+            for (u32 i = 0; i < kPerThread; i++) {
+                RenderCommand command {};
+                command.model = random() % kModels;
+                command.mesh  = CAST<u16>(thread * kPerThread + i);  // Unique, in record order
+                command.key   = RenderQueue::makeKey(RenderPass::Opaque, 0, command.model, 0, 0.f);
+                commands.record(thread, command);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    REQUIRE(commands.empty());
+    commands.finish();
+
+    const auto sorted = commands.getCommands();
+    REQUIRE(sorted.size() == kThreads * kPerThread);
+    for (size_t i = 1; i < sorted.size(); i++) {
+        REQUIRE(sorted[i - 1].key <= sorted[i].key);
+        // Equal keys keep list order, then record order
+        if (sorted[i - 1].key == sorted[i].key) { REQUIRE(sorted[i - 1].mesh < sorted[i].mesh); }
+    }
+
+    // A new tick starts from scratch
+    commands.begin(1);
+    commands.finish();
+    REQUIRE(commands.empty());
+}
+
+TEST_CASE("RenderStats - Flushing a queue reports its draws", "[Graphics]") {
+    auto& stats = RenderStats::current();
+    stats.reset();
+
+    RenderQueue queue;
+    for (u32 i = 0; i < 100; i++) {
+        auto packet  = makePacket(RenderPass::Opaque, 1, 1, 1 + i % 2, CAST<f32>(i));
+        packet.flags = Instanced;
+        queue.submit(packet);
+    }
+    queue.submit(makePacket(RenderPass::Opaque, 2, 1, 1, 0.f));
+    queue.sort();
+
+    HeadlessBackend backend;
+    queue.flush(backend);
+    REQUIRE(stats.getStats().drawCalls == backend.drawCalls);
+    REQUIRE(stats.getStats().indices == 101 * 36);
+    REQUIRE(stats.getStats().programSwitches == 2);
+
+    stats.beginFrame();
+    REQUIRE(stats.getStats().drawCalls == 0);
+    REQUIRE(stats.getLastFrameStats().drawCalls == backend.drawCalls);
+}
+
+TEST_CASE("RenderStats - Rolling averages and percentiles", "[Graphics]") {
+    RenderStats stats;
+    REQUIRE(stats.getAverage(RenderStats::Counter::DrawCalls) == 0.0);
+    REQUIRE(stats.getPercentile(RenderStats::Counter::DrawCalls, 50.0) == 0);
+
+    // Frame n issues n draws, oldest frames fall out of the history
+    for (u32 frame = 1; frame <= RenderStats::kHistorySize + 20; frame++) {
+        for (u32 i = 0; i < frame; i++) {
+            stats.recordDraw(3, 2);
+        }
+        stats.recordUpload(256);
+        stats.beginFrame();
+    }
+
+    constexpr u64 kOldest = 21;
+    constexpr u64 kNewest = RenderStats::kHistorySize + 20;
+    REQUIRE(stats.getHistorySize() == RenderStats::kHistorySize);
+    REQUIRE(stats.getLastFrameStats().drawCalls == kNewest);
+    REQUIRE(stats.getLastFrameStats().indices == kNewest * 6);
+    REQUIRE(stats.getAverage(RenderStats::Counter::DrawCalls) ==
+            CAST<f64>(kOldest + kNewest) / 2.0);
+    REQUIRE(stats.getAverage(RenderStats::Counter::BytesUploaded) == 256.0);
+    REQUIRE(stats.getPercentile(RenderStats::Counter::DrawCalls, 0.0) == kOldest);
+    REQUIRE(stats.getPercentile(RenderStats::Counter::DrawCalls, 50.0) == kOldest + 59);
+    REQUIRE(stats.getPercentile(RenderStats::Counter::DrawCalls, 95.0) == kOldest + 113);
+    REQUIRE(stats.getPercentile(RenderStats::Counter::DrawCalls, 100.0) == kNewest);
+}
+
+TEST_CASE("VertexPacking - Packed vertices decode within quantization error", "[Graphics]") {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<f32> coord(-50.f, 50.f);
+    std::uniform_real_distribution<f32> unit(-1.f, 1.f);
+    const auto randomDirection = [&] {
+        glm::vec3 v(unit(rng), unit(rng), unit(rng));
+        while (glm::length(v) < 0.1f) {
+            v = glm::vec3(unit(rng), unit(rng), unit(rng));
+        }
+        return glm::normalize(v);
+    };
+
+    std::vector<VertexPosNormTanBiTanTex> vertices(1000);
+    x::Math::AABB bounds;
+    for (auto& vertex : vertices) {
+        vertex.position  = glm::vec3(coord(rng), coord(rng) * 0.1f, coord(rng));
+        vertex.normal    = randomDirection();
+        vertex.tangent   = glm::normalize(glm::cross(vertex.normal, randomDirection()));
+        const f32 handedness = unit(rng) < 0.f ? -1.f : 1.f;
+        vertex.biTangent     = glm::cross(vertex.normal, vertex.tangent) * handedness;
+        vertex.texCoords = glm::vec2(unit(rng), unit(rng) * 4.f);
+        bounds.expand(vertex.position);
+    }
+
+    std::vector<VertexPacked> packed;
+    const auto dequantize = packVertices(vertices, bounds, packed);
+    REQUIRE(packed.size() == vertices.size());
+
+    // Half a step of unorm16 over the longest side; snorm16 octahedral stays well under 0.001
+    const f32 positionError = 100.f / 65535.f;
+    for (size_t i = 0; i < vertices.size(); i++) {
+        const auto& original = vertices[i];
+        const auto decoded   = unpackVertex(packed[i], dequantize);
+        REQUIRE(glm::length(decoded.position - original.position) < positionError);
+        REQUIRE(glm::dot(decoded.normal, original.normal) > 0.99999f);
+        REQUIRE(glm::dot(decoded.tangent, original.tangent) > 0.99999f);
+        REQUIRE(glm::dot(decoded.biTangent, original.biTangent) > 0.9999f);
+        REQUIRE(std::abs(decoded.texCoords.x - original.texCoords.x) < 0.001f);
+        REQUIRE(std::abs(decoded.texCoords.y - original.texCoords.y) < 0.002f);
+    }
+}
+
+TEST_CASE("VertexPacking - Octahedral and half float edge cases", "[Graphics]") {
+    const glm::vec3 axes[] = {{1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}};
+    for (const auto& axis : axes) {
+        REQUIRE(glm::dot(octDecode(octEncode(axis)), axis) > 0.99999f);
+    }
+
+    REQUIRE(floatToHalf(0.f) == 0x0000);
+    REQUIRE(floatToHalf(-0.f) == 0x8000);
+    REQUIRE(floatToHalf(1.f) == 0x3C00);
+    REQUIRE(floatToHalf(-2.f) == 0xC000);
+    REQUIRE(floatToHalf(65504.f) == 0x7BFF);
+    REQUIRE(floatToHalf(1e6f) == 0x7C00);
+    REQUIRE(halfToFloat(0x3555) == std::ldexp(CAST<f32>(0x555), -12));
+    REQUIRE(halfToFloat(floatToHalf(5.96046448e-8f)) == 5.96046448e-8f);  // Smallest subnormal
+    REQUIRE(std::isinf(halfToFloat(floatToHalf(INFINITY))));
+    REQUIRE(std::isnan(halfToFloat(floatToHalf(NAN))));
+}
+
+/// Backs buffers with host memory and lets the test decide when fences signal
+struct FakeStreamingBackend final : IStreamingBufferBackend {
+    std::vector<std::vector<u8>> buffers {{}};  // Index is the buffer id; 0 is never handed out
+    std::vector<bool> alive {false};
+    std::vector<bool> signaled;
+    u32 fencesAlive = 0;
+
+    size_t getAlignment() override {
+        return 256;
+    }
+
+    u32 createBuffer(size_t size, u8*& mapped) override {
+        buffers.emplace_back(size);
+        alive.push_back(true);
+        mapped = buffers.back().data();
+        return CAST<u32>(buffers.size() - 1);
+    }
+
+    void destroyBuffer(u32 buffer) override {
+        REQUIRE(alive[buffer]);
+        alive[buffer] = false;
+    }
+
+    // Fence handles are indices into signaled, offset by one so none is null
+    Fence createFence() override {
+        signaled.push_back(false);
+        fencesAlive++;
+        return RCAST<Fence>(CAST<uintptr_t>(signaled.size()));
+    }
+
+    bool isSignaled(Fence fence) override {
+        return signaled[RCAST<uintptr_t>(fence) - 1];
+    }
+
+    void waitFence(Fence fence) override {
+        signaled[RCAST<uintptr_t>(fence) - 1] = true;
+    }
+
+    void deleteFence(Fence) override {
+        fencesAlive--;
+    }
+};
+
+TEST_CASE("StreamingBuffer - Growing keeps earlier allocations alive", "[Graphics]") {
+    FakeStreamingBackend backend;
+    {
+        StreamingBuffer stream(backend, 1024);
+        stream.beginFrame();
+        const auto frame  = stream.write(u32 {0xF00D});
+        const auto object = stream.write(u32 {0xBEEF});
+        REQUIRE(frame.buffer == object.buffer);
+        REQUIRE(object.offset == frame.offset + 256);
+
+        // Outgrows the region mid-frame; the ranges above are still bound
+        const auto instances = stream.allocate(4096);
+        REQUIRE(instances.buffer != frame.buffer);
+        REQUIRE(stream.getRegionSize() >= 4096);
+        REQUIRE(stream.getRetiredCount() == 1);
+        REQUIRE(backend.alive[frame.buffer]);
+        REQUIRE(*CAST<u32*>(frame.data) == 0xF00D);
+        REQUIRE(*CAST<u32*>(object.data) == 0xBEEF);
+
+        // The retired buffer is fenced at the end of the frame and only released once the GPU
+        // is done with it
+        stream.beginFrame();
+        REQUIRE(backend.alive[frame.buffer]);
+        stream.write(u32 {0});
+        stream.beginFrame();
+        REQUIRE(backend.alive[frame.buffer]);
+
+        std::fill(backend.signaled.begin(), backend.signaled.end(), true);
+        stream.beginFrame();
+        REQUIRE_FALSE(backend.alive[frame.buffer]);
+        REQUIRE(stream.getRetiredCount() == 0);
+        REQUIRE(backend.alive[instances.buffer]);
+    }
+    REQUIRE(std::none_of(backend.alive.begin(), backend.alive.end(), [](bool b) { return b; }));
+    REQUIRE(backend.fencesAlive == 0);
+}
+
+TEST_CASE("UniformId - Compile time and runtime hashes agree", "[Graphics]") {
+    constexpr UniformId albedo = "uMaterial.albedo";
+    static_assert(albedo.value() == UniformId::hash("uMaterial.albedo"));
+
+    const str name = "uMaterial.albedo";
+    REQUIRE(UniformId(name) == albedo);
+    REQUIRE(UniformId(name + "[0]") != albedo);
+    REQUIRE(UniformId("uMaterial.metallic") != albedo);
+}
+
+namespace {
+    // GLState only calls through glad's function pointers, so the test installs recording fakes
+    constexpr u32 kGenericTarget = 0xFFFFFFFF;  // Index recorded for glBindBuffer
+
+    struct RecordedBind {
+        GLenum target;
+        u32 index;
+        u32 buffer;
+    };
+
+    std::vector<RecordedBind> gRecordedBinds;
+
+    void APIENTRY fakeBindBuffer(GLenum target, GLuint buffer) {
+        gRecordedBinds.push_back({target, kGenericTarget, buffer});
+    }
+
+    void APIENTRY fakeBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+        gRecordedBinds.push_back({target, index, buffer});
+    }
+
+    GLenum APIENTRY fakeGetError() {
+        return GL_NO_ERROR;
+    }
+}  // namespace
+
+TEST_CASE("GLState - Elided base binds leave the generic target alone", "[Graphics]") {
+    glad_glBindBuffer     = fakeBindBuffer;
+    glad_glBindBufferBase = fakeBindBufferBase;
+    glad_glGetError       = fakeGetError;
+    gRecordedBinds.clear();
+
+    constexpr u32 a = 1;
+    constexpr u32 b = 2;
+    auto& state     = GLState::current();
+    state.beginFrame();
+
+    state.bindBufferBase(GL_UNIFORM_BUFFER, 0, a);
+    state.bindBuffer(GL_UNIFORM_BUFFER, b);
+    // Base 0 still holds A, so this is skipped and the generic target keeps B
+    state.bindBufferBase(GL_UNIFORM_BUFFER, 0, a);
+    REQUIRE(gRecordedBinds.size() == 2);
+    REQUIRE(state.getStats().elided == 1);
+
+    // Updating A through the generic target must rebind it
+    state.bindBuffer(GL_UNIFORM_BUFFER, a);
+    REQUIRE(gRecordedBinds.size() == 3);
+    REQUIRE(gRecordedBinds.back().index == kGenericTarget);
+    REQUIRE(gRecordedBinds.back().buffer == a);
+
+    // An issued base bind does switch the generic target
+    state.bindBufferBase(GL_UNIFORM_BUFFER, 1, b);
+    state.bindBuffer(GL_UNIFORM_BUFFER, b);
+    REQUIRE(gRecordedBinds.size() == 4);
+    REQUIRE(state.getStats().elided == 2);
+
+    state.invalidate();
+    gRecordedBinds.clear();
+}
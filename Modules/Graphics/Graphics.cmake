@@ -2,6 +2,10 @@ set(GRAPHICS_SRCS
         ${MODULES}/Graphics/DebugOpenGL.hpp
         ${MODULES}/Graphics/DebugUI.cpp
         ${MODULES}/Graphics/DebugUI.hpp
+        ${MODULES}/Graphics/GeometryPool.cpp
+        ${MODULES}/Graphics/GeometryPool.hpp
+        ${MODULES}/Graphics/GpuProfiler.cpp
+        ${MODULES}/Graphics/GpuProfiler.hpp
         ${MODULES}/Graphics/Pipeline.cpp
         ${MODULES}/Graphics/Pipeline.hpp
         ${MODULES}/Graphics/PostProcessEffect.hpp
@@ -9,21 +13,91 @@ set(GRAPHICS_SRCS
         ${MODULES}/Graphics/PostProcessQuad.hpp
         ${MODULES}/Graphics/Primitives.cpp
         ${MODULES}/Graphics/Primitives.hpp
+        ${MODULES}/Graphics/GLState.cpp
+        ${MODULES}/Graphics/GLState.hpp
+        ${MODULES}/Graphics/HeadlessBackend.hpp
+        ${MODULES}/Graphics/MeshOptimizer.cpp
+        ${MODULES}/Graphics/MeshOptimizer.hpp
+        ${MODULES}/Graphics/MeshSimplifier.cpp
+        ${MODULES}/Graphics/MeshSimplifier.hpp
+        ${MODULES}/Graphics/OpenGLGraphBackend.cpp
+        ${MODULES}/Graphics/OpenGLGraphBackend.hpp
+        ${MODULES}/Graphics/OpenGLStreamingBackend.cpp
+        ${MODULES}/Graphics/OpenGLStreamingBackend.hpp
+        ${MODULES}/Graphics/RadixSort.cpp
+        ${MODULES}/Graphics/RadixSort.hpp
+        ${MODULES}/Graphics/RenderCommandList.cpp
+        ${MODULES}/Graphics/RenderCommandList.hpp
+        ${MODULES}/Graphics/RenderGraph.cpp
+        ${MODULES}/Graphics/RenderGraph.hpp
+        ${MODULES}/Graphics/RenderQueue.cpp
+        ${MODULES}/Graphics/RenderQueue.hpp
+        ${MODULES}/Graphics/RenderStats.cpp
+        ${MODULES}/Graphics/RenderStats.hpp
         ${MODULES}/Graphics/RenderTarget.cpp
         ${MODULES}/Graphics/RenderTarget.hpp
         ${MODULES}/Graphics/Shader.cpp
         ${MODULES}/Graphics/Shader.hpp
         ${MODULES}/Graphics/ShaderProgram.cpp
         ${MODULES}/Graphics/ShaderProgram.hpp
+        ${MODULES}/Graphics/StreamingBuffer.cpp
+        ${MODULES}/Graphics/StreamingBuffer.hpp
         ${MODULES}/Graphics/Texture.cpp
         ${MODULES}/Graphics/Texture.hpp
+        ${MODULES}/Graphics/UniformBlocks.hpp
+        ${MODULES}/Graphics/UniformId.hpp
         ${MODULES}/Graphics/Vertex.hpp
         ${MODULES}/Graphics/VertexArray.cpp
         ${MODULES}/Graphics/VertexArray.hpp
         ${MODULES}/Graphics/VertexAttribute.hpp
+        ${MODULES}/Graphics/VertexPacking.cpp
+        ${MODULES}/Graphics/VertexPacking.hpp
         # Post processing effects
         ${MODULES}/Graphics/Effects/Tonemapper.hpp
         ${MODULES}/Graphics/Effects/Tonemapper.cpp
         ${MODULES}/Graphics/Effects/AntiAliasing.hpp
         ${MODULES}/Graphics/Effects/AntiAliasing.cpp
+)
+
+set(GRAPHICS_TESTS
+        ${MODULES}/Graphics/Graphics.Tests.cpp
+)
+
+# Only the GL independent parts of the module are tested, against the headless backend. GLState
+# links the GL loader but the tests replace its entry points, so no context is needed.
+add_executable(Tests.Graphics
+        ${MODULES}/Graphics/GLState.hpp
+        ${MODULES}/Graphics/GLState.cpp
+        ${MODULES}/Graphics/HeadlessBackend.hpp
+        ${MODULES}/Graphics/MeshOptimizer.hpp
+        ${MODULES}/Graphics/MeshOptimizer.cpp
+        ${MODULES}/Graphics/MeshSimplifier.hpp
+        ${MODULES}/Graphics/MeshSimplifier.cpp
+        ${MODULES}/Graphics/RadixSort.hpp
+        ${MODULES}/Graphics/RadixSort.cpp
+        ${MODULES}/Graphics/RenderCommandList.hpp
+        ${MODULES}/Graphics/RenderCommandList.cpp
+        ${MODULES}/Graphics/RenderGraph.hpp
+        ${MODULES}/Graphics/RenderGraph.cpp
+        ${MODULES}/Graphics/RenderQueue.hpp
+        ${MODULES}/Graphics/RenderQueue.cpp
+        ${MODULES}/Graphics/RenderStats.hpp
+        ${MODULES}/Graphics/RenderStats.cpp
+        ${MODULES}/Graphics/StreamingBuffer.hpp
+        ${MODULES}/Graphics/StreamingBuffer.cpp
+        ${MODULES}/Graphics/VertexPacking.hpp
+        ${MODULES}/Graphics/VertexPacking.cpp
+        ${MODULES}/Math/AffineTransform.hpp
+        ${MODULES}/Math/AffineTransform.cpp
+        ${MODULES}/Math/Bounds.hpp
+        ${MODULES}/Math/Bounds.cpp
+        ${GLAD_SRCS}
+        ${GRAPHICS_TESTS}
+)
+
+find_package(Catch2 3 REQUIRED)
+target_link_libraries(Tests.Graphics PRIVATE
+        glm::glm-header-only
+        Catch2::Catch2WithMain
+        ${CMAKE_DL_LIBS}
 )
\ No newline at end of file
@@ -0,0 +1,67 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "RenderQueue.hpp"
+#include "RenderStats.hpp"
+
+namespace x::Graphics {
+    /// @brief Render backend that issues no GL calls and only counts what it is asked to do.
+    /// Used to measure state changes of a RenderQueue without a GPU. Reports into RenderStats
+    /// the way OpenGLBackend does.
+    class HeadlessBackend final : public IRenderBackend {
+    public:
+        u32 programBinds     = 0;
+        u32 materialBinds    = 0;
+        u32 vertexArrayBinds = 0;
+        u32 drawCalls        = 0;
+        u32 drawCommands     = 0;  // Draws a multi-draw call would issue on the GPU
+        u32 instances        = 0;
+        std::vector<u64> drawnKeys;
+
+        void bindProgram(u32) override {
+            programBinds++;
+            RenderStats::current().recordProgramSwitch();
+        }
+
+        void bindMaterial(const DrawPacket&) override {
+            materialBinds++;
+        }
+
+        void bindVertexArray(const DrawPacket&) override {
+            vertexArrayBinds++;
+        }
+
+        void draw(const DrawPacket& packet) override {
+            drawCalls++;
+            drawCommands++;
+            instances++;
+            drawnKeys.push_back(packet.key);
+            RenderStats::current().recordDraw(packet.indexCount);
+        }
+
+        void drawInstanced(std::span<const DrawPacket> packets) override {
+            drawCalls++;
+            instances += CAST<u32>(packets.size());
+            u64 indexCount = 0;
+            for (size_t i = 0; i < packets.size(); i++) {
+                if (i == 0 || !isSameMesh(packets[i - 1], packets[i])) { drawCommands++; }
+                drawnKeys.push_back(packets[i].key);
+                indexCount += packets[i].indexCount;
+            }
+            RenderStats::current().recordMultiDraw(indexCount);
+        }
+
+        void reset() {
+            programBinds     = 0;
+            materialBinds    = 0;
+            vertexArrayBinds = 0;
+            drawCalls        = 0;
+            drawCommands     = 0;
+            instances        = 0;
+            drawnKeys.clear();
+        }
+    };
+}  // namespace x::Graphics
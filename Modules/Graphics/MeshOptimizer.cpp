@@ -0,0 +1,306 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "MeshOptimizer.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+namespace x::Graphics {
+    namespace {
+        /// @brief FIFO cache simulation; a vertex is cached while fewer than cacheSize misses
+        /// happened since it was loaded.
+        class VertexCache {
+        public:
+            VertexCache(u32 vertexCount, u32 cacheSize)
+                : _loadedAt(vertexCount, 0), _time(cacheSize + 1), _cacheSize(cacheSize) {}
+
+            /// @brief Returns true on a miss
+            bool access(u32 vertex) {
+                if (_time - _loadedAt[vertex] <= _cacheSize) { return false; }
+                _loadedAt[vertex] = _time++;
+                return true;
+            }
+
+            void clear() {
+                _time += _cacheSize + 1;
+            }
+
+        private:
+            std::vector<u64> _loadedAt;
+            u64 _time;
+            u32 _cacheSize;
+        };
+
+        u64 hashVertex(const VertexPosNormTanBiTanTex& vertex) {
+            // FNV-1a over the raw bytes; welding only merges exact copies
+            u8 bytes[sizeof(VertexPosNormTanBiTanTex)];
+            std::memcpy(bytes, &vertex, sizeof(bytes));
+            u64 hash = 14695981039346656037ull;
+            for (const u8 byte : bytes) {
+                hash = (hash ^ byte) * 1099511628211ull;
+            }
+            return hash;
+        }
+
+        /// @brief Triangles using each vertex, as offsets into a flat list
+        struct Adjacency {
+            std::vector<u32> offsets;
+            std::vector<u32> triangles;
+
+            Adjacency(std::span<const u32> indices, u32 vertexCount) : offsets(vertexCount + 1, 0) {
+                for (const u32 index : indices) {
+                    offsets[index + 1]++;
+                }
+                std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+                triangles.resize(indices.size());
+                std::vector<u32> fill(offsets.begin(), offsets.end() - 1);
+                for (size_t i = 0; i < indices.size(); i++) {
+                    triangles[fill[indices[i]]++] = CAST<u32>(i / 3);
+                }
+            }
+        };
+    }  // namespace
+
+    f32 computeAcmr(std::span<const u32> indices, u32 vertexCount, u32 cacheSize) {
+        if (indices.size() < 3) { return 0.f; }
+        VertexCache cache(vertexCount, cacheSize);
+        u32 misses = 0;
+        for (const u32 index : indices) {
+            misses += cache.access(index) ? 1 : 0;
+        }
+        return CAST<f32>(misses) / CAST<f32>(indices.size() / 3);
+    }
+
+    void weldVertices(std::vector<VertexPosNormTanBiTanTex>& vertices, std::vector<u32>& indices) {
+        // Open addressing at under half load; slots hold unique vertex indices
+        size_t capacity = 16;
+        while (capacity < vertices.size() * 2) {
+            capacity *= 2;
+        }
+        constexpr u32 kEmpty = ~0u;
+        std::vector<u32> table(capacity, kEmpty);
+        std::vector<u32> remap(vertices.size());
+
+        u32 uniqueCount = 0;
+        for (size_t i = 0; i < vertices.size(); i++) {
+            size_t slot = hashVertex(vertices[i]) & (capacity - 1);
+            while (table[slot] != kEmpty &&
+                   std::memcmp(&vertices[table[slot]], &vertices[i], sizeof(vertices[i])) != 0) {
+                slot = (slot + 1) & (capacity - 1);
+            }
+            if (table[slot] == kEmpty) {
+                // Compacting in place is safe, uniqueCount never passes i
+                vertices[uniqueCount] = vertices[i];
+                table[slot]           = uniqueCount++;
+            }
+            remap[i] = table[slot];
+        }
+
+        vertices.resize(uniqueCount);
+        for (auto& index : indices) {
+            index = remap[index];
+        }
+    }
+
+    void optimizeVertexCache(std::vector<u32>& indices, u32 vertexCount, u32 cacheSize) {
+        const size_t triangleCount = indices.size() / 3;
+        if (triangleCount == 0) { return; }
+
+        const Adjacency adjacency(indices, vertexCount);
+        std::vector<u32> live(vertexCount);
+        for (u32 v = 0; v < vertexCount; v++) {
+            live[v] = adjacency.offsets[v + 1] - adjacency.offsets[v];
+        }
+        std::vector<u64> cachedAt(vertexCount, 0);
+        std::vector<bool> emitted(triangleCount, false);
+        std::vector<u32> deadEnd;
+        std::vector<u32> candidates;
+        std::vector<u32> output;
+        output.reserve(indices.size());
+
+        u64 time    = cacheSize + 1;
+        u32 cursor  = 0;
+        i64 fanning = 0;
+        while (fanning >= 0) {
+            const u32 f = CAST<u32>(fanning);
+            candidates.clear();
+            for (u32 a = adjacency.offsets[f]; a < adjacency.offsets[f + 1]; a++) {
+                const u32 triangle = adjacency.triangles[a];
+                if (emitted[triangle]) { continue; }
+                emitted[triangle] = true;
+                for (u32 k = 0; k < 3; k++) {
+                    const u32 v = indices[triangle * 3 + k];
+                    output.push_back(v);
+                    deadEnd.push_back(v);
+                    candidates.push_back(v);
+                    live[v]--;
+                    if (time - cachedAt[v] > cacheSize) { cachedAt[v] = time++; }
+                }
+            }
+
+            // Prefer the candidate that will still be cached after its remaining triangles are
+            // emitted, and among those the one that has been cached longest
+            fanning  = -1;
+            i64 best = -1;
+            for (const u32 v : candidates) {
+                if (live[v] == 0) { continue; }
+                i64 priority = 0;
+                if (time - cachedAt[v] + 2 * live[v] <= cacheSize) {
+                    priority = CAST<i64>(time - cachedAt[v]);
+                }
+                if (priority > best) {
+                    best    = priority;
+                    fanning = v;
+                }
+            }
+
+            // Dead end: back up through recently used vertices, then scan in input order
+            while (fanning < 0 && !deadEnd.empty()) {
+                const u32 v = deadEnd.back();
+                deadEnd.pop_back();
+                if (live[v] > 0) { fanning = v; }
+            }
+            while (fanning < 0 && cursor < vertexCount) {
+                if (live[cursor] > 0) { fanning = cursor; }
+                cursor++;
+            }
+        }
+
+        indices = std::move(output);
+    }
+
+    void optimizeOverdraw(std::vector<u32>& indices,
+                          std::span<const VertexPosNormTanBiTanTex> vertices,
+                          f32 threshold,
+                          u32 cacheSize) {
+        const size_t triangleCount = indices.size() / 3;
+        if (triangleCount == 0) { return; }
+        const auto vertexCount = CAST<u32>(vertices.size());
+
+        // Hard boundaries: triangles whose vertices all miss start over with a cold cache
+        std::vector<u32> hardStarts;
+        {
+            VertexCache cache(vertexCount, cacheSize);
+            for (size_t t = 0; t < triangleCount; t++) {
+                u32 misses = 0;
+                for (u32 k = 0; k < 3; k++) {
+                    misses += cache.access(indices[t * 3 + k]) ? 1 : 0;
+                }
+                if (misses == 3) { hardStarts.push_back(CAST<u32>(t)); }
+            }
+            hardStarts.push_back(CAST<u32>(triangleCount));
+            if (hardStarts.front() != 0) { hardStarts.insert(hardStarts.begin(), 0); }
+        }
+
+        // Soft boundaries: end a cluster as soon as its own ACMR is close to that of the hard
+        // cluster it is part of
+        std::vector<u32> clusterStarts;
+        VertexCache cache(vertexCount, cacheSize);
+        for (size_t h = 0; h + 1 < hardStarts.size(); h++) {
+            const u32 begin = hardStarts[h];
+            const u32 end   = hardStarts[h + 1];
+            const f32 target =
+              computeAcmr({indices.data() + begin * 3, CAST<size_t>(end - begin) * 3},
+                          vertexCount,
+                          cacheSize) *
+              threshold;
+
+            cache.clear();
+            u32 misses = 0;
+            u32 start  = begin;
+            clusterStarts.push_back(begin);
+            for (u32 t = begin; t < end; t++) {
+                for (u32 k = 0; k < 3; k++) {
+                    misses += cache.access(indices[t * 3 + k]) ? 1 : 0;
+                }
+                const u32 triangles = t - start + 1;
+                if (t + 1 < end && CAST<f32>(misses) <= target * CAST<f32>(triangles)) {
+                    clusterStarts.push_back(t + 1);
+                    cache.clear();
+                    misses = 0;
+                    start  = t + 1;
+                }
+            }
+        }
+        clusterStarts.push_back(CAST<u32>(triangleCount));
+
+        // Clusters facing away from the mesh center are the ones likely to occlude the rest
+        glm::vec3 meshCenter(0.f);
+        f32 meshArea = 0.f;
+        std::vector<glm::vec3> centers(clusterStarts.size() - 1, glm::vec3(0.f));
+        std::vector<glm::vec3> normals(clusterStarts.size() - 1, glm::vec3(0.f));
+        std::vector<f32> areas(clusterStarts.size() - 1, 0.f);
+        for (size_t c = 0; c + 1 < clusterStarts.size(); c++) {
+            for (u32 t = clusterStarts[c]; t < clusterStarts[c + 1]; t++) {
+                const glm::vec3& a    = vertices[indices[t * 3 + 0]].position;
+                const glm::vec3& b    = vertices[indices[t * 3 + 1]].position;
+                const glm::vec3& d    = vertices[indices[t * 3 + 2]].position;
+                const glm::vec3 cross = glm::cross(b - a, d - a);
+                const f32 area        = glm::length(cross);
+                centers[c] += (a + b + d) * (area / 3.f);
+                normals[c] += cross;
+                areas[c] += area;
+            }
+            meshCenter += centers[c];
+            meshArea += areas[c];
+            if (areas[c] > 0.f) { centers[c] /= areas[c]; }
+        }
+        if (meshArea > 0.f) { meshCenter /= meshArea; }
+
+        std::vector<std::pair<f32, u32>> order(clusterStarts.size() - 1);
+        for (u32 c = 0; c < order.size(); c++) {
+            const f32 length = glm::length(normals[c]);
+            const f32 facing =
+              length > 0.f ? glm::dot(centers[c] - meshCenter, normals[c] / length) : 0.f;
+            order[c] = {facing, c};
+        }
+        std::stable_sort(order.begin(), order.end(), [](const auto& a, const auto& b) {
+            return a.first > b.first;
+        });
+
+        std::vector<u32> output;
+        output.reserve(indices.size());
+        for (const auto& [facing, c] : order) {
+            output.insert(output.end(),
+                          indices.begin() + CAST<i64>(clusterStarts[c]) * 3,
+                          indices.begin() + CAST<i64>(clusterStarts[c + 1]) * 3);
+        }
+        indices = std::move(output);
+    }
+
+    void optimizeVertexFetch(std::vector<VertexPosNormTanBiTanTex>& vertices,
+                             std::vector<u32>& indices) {
+        constexpr u32 kUnused = ~0u;
+        std::vector<u32> remap(vertices.size(), kUnused);
+        std::vector<VertexPosNormTanBiTanTex> ordered;
+        ordered.reserve(vertices.size());
+        for (auto& index : indices) {
+            if (remap[index] == kUnused) {
+                remap[index] = CAST<u32>(ordered.size());
+                ordered.push_back(vertices[index]);
+            }
+            index = remap[index];
+        }
+        vertices = std::move(ordered);
+    }
+
+    MeshOptimizationStats optimizeMesh(std::vector<VertexPosNormTanBiTanTex>& vertices,
+                                       std::vector<u32>& indices) {
+        MeshOptimizationStats stats;
+        stats.triangles      = CAST<u32>(indices.size() / 3);
+        stats.verticesBefore = CAST<u32>(vertices.size());
+        stats.acmrBefore     = computeAcmr(indices, CAST<u32>(vertices.size()));
+
+        weldVertices(vertices, indices);
+        optimizeVertexCache(indices, CAST<u32>(vertices.size()));
+        optimizeOverdraw(indices, vertices);
+        optimizeVertexFetch(vertices, indices);
+
+        stats.verticesAfter = CAST<u32>(vertices.size());
+        stats.acmrAfter     = computeAcmr(indices, CAST<u32>(vertices.size()));
+        return stats;
+    }
+}  // namespace x::Graphics
@@ -0,0 +1,426 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "MeshSimplifier.hpp"
+#include "MeshOptimizer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+
+namespace x::Graphics {
+    namespace {
+        constexpr u32 kDimension    = 8;  // Position, normal, UV
+        constexpr u32 kPackedSize   = kDimension * (kDimension + 1) / 2;
+        constexpr f32 kNormalWeight = 0.5f;
+        constexpr f32 kUvWeight     = 1.f;
+        constexpr f32 kBorderWeight = 10.f;
+
+        // Doubles: the errors that matter are many orders of magnitude below the terms they
+        // cancel from
+        using Point = std::array<f64, kDimension>;
+
+        f64 dot(const Point& a, const Point& b) {
+            f64 result = 0.0;
+            for (u32 i = 0; i < kDimension; i++) {
+                result += a[i] * b[i];
+            }
+            return result;
+        }
+
+        /// @brief Squared distance to a plane of the position, normal and UV space, weighted
+        struct Quadric {
+            std::array<f64, kPackedSize> a {};  // Upper triangle of the symmetric matrix
+            Point b {};
+            f64 c      = 0.0;
+            f64 weight = 0.0;  // Area the quadric was built from, to normalize errors
+
+            void add(const Quadric& other) {
+                for (u32 i = 0; i < kPackedSize; i++) {
+                    a[i] += other.a[i];
+                }
+                for (u32 i = 0; i < kDimension; i++) {
+                    b[i] += other.b[i];
+                }
+                c += other.c;
+                weight += other.weight;
+            }
+
+            [[nodiscard]] f64 evaluate(const Point& v) const {
+                f64 result = c;
+                u32 k      = 0;
+                for (u32 i = 0; i < kDimension; i++) {
+                    result += a[k++] * v[i] * v[i];
+                    for (u32 j = i + 1; j < kDimension; j++) {
+                        result += 2.0 * a[k++] * v[i] * v[j];
+                    }
+                    result += 2.0 * b[i] * v[i];
+                }
+                return result;
+            }
+        };
+
+        /// @brief Distance to the plane through a triangle of the full space
+        Quadric triangleQuadric(const Point& p, const Point& q, const Point& r, f64 weight) {
+            Point e1, e2;
+            for (u32 i = 0; i < kDimension; i++) {
+                e1[i] = q[i] - p[i];
+                e2[i] = r[i] - p[i];
+            }
+            const f64 length1 = std::sqrt(dot(e1, e1));
+            if (length1 <= 1e-12) { return {}; }
+            for (auto& x : e1) {
+                x /= length1;
+            }
+            const f64 along = dot(e1, e2);
+            for (u32 i = 0; i < kDimension; i++) {
+                e2[i] -= along * e1[i];
+            }
+            const f64 length2 = std::sqrt(dot(e2, e2));
+            if (length2 <= 1e-12) { return {}; }
+            for (auto& x : e2) {
+                x /= length2;
+            }
+
+            Quadric quadric;
+            u32 k = 0;
+            for (u32 i = 0; i < kDimension; i++) {
+                for (u32 j = i; j < kDimension; j++) {
+                    const f64 identity = i == j ? 1.0 : 0.0;
+                    quadric.a[k++]     = weight * (identity - e1[i] * e1[j] - e2[i] * e2[j]);
+                }
+            }
+            const f64 pe1 = dot(p, e1);
+            const f64 pe2 = dot(p, e2);
+            for (u32 i = 0; i < kDimension; i++) {
+                quadric.b[i] = weight * (pe1 * e1[i] + pe2 * e2[i] - p[i]);
+            }
+            quadric.c      = weight * (dot(p, p) - pe1 * pe1 - pe2 * pe2);
+            quadric.weight = weight;
+            return quadric;
+        }
+
+        /// @brief Distance to a plane of position space; attributes are free
+        Quadric planeQuadric(const glm::vec3& normal, f64 distance, f64 weight) {
+            Quadric quadric;
+            u32 k = 0;
+            for (u32 i = 0; i < 3; i++) {
+                for (u32 j = i; j < kDimension; j++) {
+                    quadric.a[k++] = j < 3 ? weight * normal[i] * normal[j] : 0.0;
+                }
+                quadric.b[i] = weight * distance * normal[i];
+            }
+            quadric.c = weight * distance * distance;
+            return quadric;
+        }
+
+        struct PositionHash {
+            size_t operator()(const glm::vec3& p) const {
+                const u64 x = std::bit_cast<u32>(p.x);
+                const u64 y = std::bit_cast<u32>(p.y);
+                const u64 z = std::bit_cast<u32>(p.z);
+                return std::hash<u64> {}((x * 73856093u) ^ (y * 19349663u) ^ (z * 83492791u));
+            }
+        };
+    }  // namespace
+
+    std::vector<u32> simplifyMesh(std::span<const VertexPosNormTanBiTanTex> vertices,
+                                  std::span<const u32> indices,
+                                  size_t targetIndexCount,
+                                  f32 targetError,
+                                  f32* resultError) {
+        std::vector<u32> result(indices.begin(), indices.end());
+        if (resultError) { *resultError = 0.f; }
+        const auto vertexCount = CAST<u32>(vertices.size());
+        if (result.size() <= targetIndexCount || vertexCount == 0) { return result; }
+
+        // Positions are normalized to the longest side so errors are relative to the mesh size
+        glm::vec3 min(std::numeric_limits<f32>::max());
+        glm::vec3 max(std::numeric_limits<f32>::lowest());
+        for (const auto& vertex : vertices) {
+            min = glm::min(min, vertex.position);
+            max = glm::max(max, vertex.position);
+        }
+        const glm::vec3 extent = max - min;
+        const f32 scale        = std::max({extent.x, extent.y, extent.z, 1e-6f});
+
+        std::vector<Point> points(vertexCount);
+        std::vector<glm::vec3> positions(vertexCount);
+        for (u32 v = 0; v < vertexCount; v++) {
+            const auto& vertex = vertices[v];
+            positions[v]       = (vertex.position - min) / scale;
+            points[v]          = {positions[v].x,
+                                  positions[v].y,
+                                  positions[v].z,
+                                  vertex.normal.x * kNormalWeight,
+                                  vertex.normal.y * kNormalWeight,
+                                  vertex.normal.z * kNormalWeight,
+                                  vertex.texCoords.x * kUvWeight,
+                                  vertex.texCoords.y * kUvWeight};
+        }
+
+        // Vertices sharing a position sit on an attribute seam; moving one would open a crack
+        std::vector<u32> canonical(vertexCount);
+        std::vector<u8> locked(vertexCount, 0);
+        {
+            std::unordered_map<glm::vec3, u32, PositionHash> firstAt;
+            firstAt.reserve(vertexCount);
+            for (u32 v = 0; v < vertexCount; v++) {
+                const auto [it, inserted] = firstAt.try_emplace(vertices[v].position, v);
+                canonical[v]              = it->second;
+                if (!inserted) {
+                    locked[v]          = 1;
+                    locked[it->second] = 1;
+                }
+            }
+        }
+
+        // Triangles around each position, rebuilt whenever the triangles change. Edges are
+        // compared by position so seams don't read as borders.
+        std::vector<u32> offsets, adjacent;
+        const auto buildAdjacency = [&] {
+            offsets.assign(vertexCount + 1, 0);
+            for (const u32 index : result) {
+                offsets[canonical[index] + 1]++;
+            }
+            std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+            adjacent.resize(result.size());
+            std::vector<u32> fill(offsets.begin(), offsets.end() - 1);
+            for (size_t i = 0; i < result.size(); i++) {
+                adjacent[fill[canonical[result[i]]]++] = CAST<u32>(i / 3);
+            }
+        };
+        const auto countEdges = [&](u32 from, u32 to) {
+            const u32 a = canonical[from];
+            const u32 b = canonical[to];
+            u32 count   = 0;
+            for (u32 i = offsets[a]; i < offsets[a + 1]; i++) {
+                const u32* tri = &result[CAST<size_t>(adjacent[i]) * 3];
+                for (u32 k = 0; k < 3; k++) {
+                    if (canonical[tri[k]] == a && canonical[tri[(k + 1) % 3]] == b) { count++; }
+                }
+            }
+            return count;
+        };
+        const auto isBorder = [&](u32 from, u32 to) {
+            return countEdges(to, from) == 0;
+        };
+
+        std::vector<Quadric> quadrics(vertexCount);
+        buildAdjacency();
+        for (size_t i = 0; i < result.size(); i += 3) {
+            const u32 tri[3]       = {result[i], result[i + 1], result[i + 2]};
+            const glm::vec3 normal = glm::cross(positions[tri[1]] - positions[tri[0]],
+                                                positions[tri[2]] - positions[tri[0]]);
+            const f32 area         = glm::length(normal) * 0.5f;
+            const auto quadric =
+              triangleQuadric(points[tri[0]], points[tri[1]], points[tri[2]], area);
+            for (const u32 v : tri) {
+                quadrics[v].add(quadric);
+            }
+
+            // Borders get a wall perpendicular to the surface so they keep their outline
+            if (area <= 0.f) { continue; }
+            for (u32 k = 0; k < 3; k++) {
+                const u32 a = tri[k];
+                const u32 b = tri[(k + 1) % 3];
+                if (!isBorder(a, b)) { continue; }
+                const glm::vec3 edge = positions[b] - positions[a];
+                const f32 length     = glm::length(edge);
+                if (length <= 0.f) { continue; }
+                const glm::vec3 wall = glm::normalize(glm::cross(edge, normal));
+                const auto border    = planeQuadric(wall,
+                                                 -glm::dot(wall, positions[a]),
+                                                 kBorderWeight * length * length);
+                quadrics[a].add(border);
+                quadrics[b].add(border);
+            }
+        }
+
+        constexpr f32 kNoCandidate = std::numeric_limits<f32>::max();
+        const f32 errorLimit       = targetError * targetError;
+        f32 maxError               = 0.f;
+        std::vector<u32> borderEdges(vertexCount), bestTarget(vertexCount), order;
+        std::vector<f64> selfError(vertexCount);
+        std::vector<f32> bestCost(vertexCount);
+        std::vector<u8> pinned(vertexCount), touched(vertexCount);
+        std::vector<u32> remap(vertexCount);
+        std::iota(remap.begin(), remap.end(), 0);
+
+        // Collapses are made in passes of independent edges, cheapest first
+        while (result.size() > targetIndexCount) {
+            const size_t triangleCount = result.size() / 3;
+
+            // Classify against the current triangles: complex borders and non-manifold edges pin
+            // their vertices, simple borders may only slide along themselves
+            std::fill(borderEdges.begin(), borderEdges.end(), 0);
+            std::copy(locked.begin(), locked.end(), pinned.begin());
+            for (size_t i = 0; i < result.size(); i += 3) {
+                for (u32 k = 0; k < 3; k++) {
+                    const u32 a = result[i + k];
+                    const u32 b = result[i + (k + 1) % 3];
+                    if (countEdges(a, b) > 1) { pinned[a] = pinned[b] = 1; }
+                    if (isBorder(a, b)) {
+                        borderEdges[a]++;
+                        borderEdges[b]++;
+                    }
+                }
+            }
+            for (u32 v = 0; v < vertexCount; v++) {
+                if (borderEdges[v] != 0 && borderEdges[v] != 2) { pinned[v] = 1; }
+                selfError[v] = quadrics[v].evaluate(points[v]);
+            }
+
+            // Collapsing v onto t costs both quadrics evaluated at t
+            std::fill(bestCost.begin(), bestCost.end(), kNoCandidate);
+            for (size_t i = 0; i < result.size(); i += 3) {
+                for (u32 k = 0; k < 6; k++) {
+                    const u32 v = result[i + k % 3];
+                    const u32 t = result[i + (k < 3 ? (k + 1) % 3 : (k + 2) % 3)];
+                    if (pinned[v] || v == t) { continue; }
+                    if (borderEdges[v] && !(isBorder(v, t) || isBorder(t, v))) { continue; }
+
+                    const f64 error  = quadrics[v].evaluate(points[t]) + selfError[t];
+                    const f64 weight = quadrics[v].weight + quadrics[t].weight;
+                    const auto cost  = CAST<f32>(std::max(error, 0.0) / std::max(weight, 1e-12));
+                    if (cost < bestCost[v]) {
+                        bestCost[v]   = cost;
+                        bestTarget[v] = t;
+                    }
+                }
+            }
+
+            order.clear();
+            for (u32 v = 0; v < vertexCount; v++) {
+                if (bestCost[v] <= errorLimit && bestCost[v] < kNoCandidate) { order.push_back(v); }
+            }
+            if (order.empty()) { break; }
+            std::sort(order.begin(), order.end(), [&](u32 a, u32 b) {
+                return bestCost[a] < bestCost[b];
+            });
+
+            // Most collapses remove two triangles. Going far past the cost of the collapse that
+            // would reach the target in one pass would take expensive collapses before cheaper
+            // ones that only appear in later passes.
+            const size_t toRemove = std::max<size_t>((result.size() - targetIndexCount) / 3, 1);
+            const size_t goal     = std::min(toRemove / 2, order.size() - 1);
+            const f32 passLimit   = std::min(errorLimit, bestCost[order[goal]] * 1.5f);
+
+            std::fill(touched.begin(), touched.end(), 0);
+            size_t removed = 0;
+            u32 collapses  = 0;
+            for (const u32 v : order) {
+                if (bestCost[v] > passLimit) { break; }
+                const u32 t = bestTarget[v];
+                if (touched[v] || touched[t]) { continue; }
+
+                // Reject collapses that would turn a triangle around v over
+                bool flips      = false;
+                size_t degraded = 0;
+                const u32 c     = canonical[v];
+                for (u32 a = offsets[c]; a < offsets[c + 1] && !flips; a++) {
+                    const u32* tri = &result[CAST<size_t>(adjacent[a]) * 3];
+                    if (tri[0] == t || tri[1] == t || tri[2] == t) {
+                        degraded++;
+                        continue;
+                    }
+                    glm::vec3 p[3], q[3];
+                    for (u32 k = 0; k < 3; k++) {
+                        p[k] = positions[tri[k]];
+                        q[k] = positions[tri[k] == v ? t : tri[k]];
+                    }
+                    const glm::vec3 before = glm::cross(p[1] - p[0], p[2] - p[0]);
+                    const glm::vec3 after  = glm::cross(q[1] - q[0], q[2] - q[0]);
+                    flips                  = glm::dot(before, after) <= 0.f;
+                }
+                if (flips) { continue; }
+
+                remap[v] = t;
+                quadrics[t].add(quadrics[v]);
+                maxError = std::max(maxError, bestCost[v]);
+                for (u32 a = offsets[c]; a < offsets[c + 1]; a++) {
+                    const u32* tri = &result[CAST<size_t>(adjacent[a]) * 3];
+                    touched[tri[0]] = touched[tri[1]] = touched[tri[2]] = 1;
+                }
+                collapses++;
+                removed += degraded;
+                if (removed >= toRemove) { break; }
+            }
+            if (collapses == 0) { break; }
+
+            size_t write = 0;
+            for (size_t i = 0; i < triangleCount; i++) {
+                const u32 a = remap[result[i * 3 + 0]];
+                const u32 b = remap[result[i * 3 + 1]];
+                const u32 c = remap[result[i * 3 + 2]];
+                if (a == b || b == c || c == a) { continue; }
+                result[write++] = a;
+                result[write++] = b;
+                result[write++] = c;
+            }
+            result.resize(write);
+            buildAdjacency();
+        }
+
+        if (resultError) { *resultError = std::sqrt(maxError); }
+        return result;
+    }
+
+    std::vector<MeshLod> generateLods(std::span<const VertexPosNormTanBiTanTex> vertices,
+                                      std::vector<u32>& indices) {
+        std::vector<MeshLod> lods;
+        lods.push_back({0, CAST<u32>(indices.size()), 0.f});
+
+        glm::vec3 min(std::numeric_limits<f32>::max());
+        glm::vec3 max(std::numeric_limits<f32>::lowest());
+        for (const auto& vertex : vertices) {
+            min = glm::min(min, vertex.position);
+            max = glm::max(max, vertex.position);
+        }
+        const glm::vec3 extent = vertices.empty() ? glm::vec3(0.f) : max - min;
+        const f32 scale        = std::max({extent.x, extent.y, extent.z});
+
+        // Every level starts from the full mesh, so errors don't compound between levels
+        const std::vector<u32> source = indices;
+        for (u32 level = 1; level < kMaxLods; level++) {
+            const size_t target = lods.back().indexCount / 6 * 3;
+            if (target < 3) { break; }
+
+            f32 error = 0.f;
+            auto lod  = simplifyMesh(vertices,
+                                    source,
+                                    target,
+                                    std::numeric_limits<f32>::max(),
+                                    &error);
+            // Not worth the index memory once simplification stalls
+            if (lod.size() * 4 > CAST<size_t>(lods.back().indexCount) * 3) { break; }
+
+            optimizeVertexCache(lod, CAST<u32>(vertices.size()));
+            lods.push_back({CAST<u32>(indices.size()),
+                            CAST<u32>(lod.size()),
+                            std::max(error * scale, lods.back().error)});
+            indices.insert(indices.end(), lod.begin(), lod.end());
+        }
+        return lods;
+    }
+
+    u32 selectLod(std::span<const MeshLod> lods,
+                  f32 scale,
+                  f32 distance,
+                  f32 projectionScale,
+                  f32 maxScreenError) {
+        // An error e at distance d spans e * projectionScale / d of the 2 unit high NDC range
+        const f32 toScreen = scale * projectionScale / (2.f * std::max(distance, 1e-4f));
+        u32 selected       = 0;
+        for (u32 i = 1; i < lods.size(); i++) {
+            if (lods[i].error * toScreen > maxScreenError) { break; }
+            selected = i;
+        }
+        return selected;
+    }
+}  // namespace x::Graphics
@@ -0,0 +1,56 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "Vertex.hpp"
+
+#include <span>
+#include <vector>
+
+namespace x::Graphics {
+    static constexpr u32 kMaxLods = 4;
+
+    /// @brief One level of detail: a range of the mesh's index buffer over the shared vertices.
+    struct MeshLod {
+        u32 firstIndex;  // Relative to the mesh's first index
+        u32 indexCount;
+        f32 error;  // Deviation from the full mesh in model units, 0 for level 0
+    };
+
+    /// @brief Collapses edges of a triangle list until it has at most targetIndexCount indices or
+    /// the next collapse would exceed targetError, relative to the mesh's longest side.
+    ///
+    /// The error is a quadric over position, normal and UV (Garland and Heckbert 1998), so
+    /// collapses that smear shading or texturing cost as much as those that move the surface.
+    /// Vertices only ever collapse onto other existing vertices, so the result indexes the same
+    /// vertices. Border vertices only slide along the border, and vertices that share a
+    /// position with another (UV seams, hard edges) never move.
+    ///
+    /// @param resultError Receives the largest error of the collapses made, same units as
+    /// targetError
+    [[nodiscard]] std::vector<u32> simplifyMesh(std::span<const VertexPosNormTanBiTanTex> vertices,
+                                                std::span<const u32> indices,
+                                                size_t targetIndexCount,
+                                                f32 targetError,
+                                                f32* resultError = nullptr);
+
+    /// @brief Generates up to kMaxLods levels, each with about half the triangles of the one
+    /// before, stopping early once simplification stalls. indices becomes every level's indices
+    /// one after the other, level 0 (the input) first; levels past 0 are cache optimized.
+    std::vector<MeshLod> generateLods(std::span<const VertexPosNormTanBiTanTex> vertices,
+                                      std::vector<u32>& indices);
+
+    /// @brief Coarsest level whose error, projected at distance, covers at most maxScreenError
+    /// of the screen's height.
+    ///
+    /// @param scale Largest scale of the model transform
+    /// @param projectionScale Element [1][1] of the projection matrix, 1 / tan(fovY / 2)
+    [[nodiscard]] u32 selectLod(std::span<const MeshLod> lods,
+                                f32 scale,
+                                f32 distance,
+                                f32 projectionScale,
+                                f32 maxScreenError);
+}  // namespace x::Graphics
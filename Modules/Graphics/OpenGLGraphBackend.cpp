@@ -0,0 +1,34 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "OpenGLGraphBackend.hpp"
+#include "GLState.hpp"
+
+#include <glad.h>
+
+namespace x::Graphics {
+    u32 OpenGLGraphBackend::createTexture(const RenderTextureDesc& desc) {
+        u32 texture = 0;
+        glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+        glTextureStorage2D(texture, 1, desc.internalFormat, desc.width, desc.height);
+        glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTextureParameteri(texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        return texture;
+    }
+
+    void OpenGLGraphBackend::destroyTexture(u32 texture) {
+        glDeleteTextures(1, &texture);
+        GLState::current().forgetTexture(texture);
+    }
+
+    void OpenGLGraphBackend::memoryBarrier(u32 barriers) {
+        GLbitfield bits = 0;
+        if (barriers & TextureFetchBarrier) { bits |= GL_TEXTURE_FETCH_BARRIER_BIT; }
+        if (barriers & ImageAccessBarrier) { bits |= GL_SHADER_IMAGE_ACCESS_BARRIER_BIT; }
+        if (barriers & FramebufferBarrier) { bits |= GL_FRAMEBUFFER_BARRIER_BIT; }
+        glMemoryBarrier(bits);
+    }
+}  // namespace x::Graphics
@@ -0,0 +1,19 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "RenderGraph.hpp"
+
+namespace x::Graphics {
+    /// @brief Backs a RenderGraph's pool with immutable 2D textures and translates its barriers
+    /// to glMemoryBarrier. Pooled textures are linearly filtered and clamped to edge, so the
+    /// same texture works as an image and as a sampled input.
+    class OpenGLGraphBackend final : public IRenderGraphBackend {
+    public:
+        u32 createTexture(const RenderTextureDesc& desc) override;
+        void destroyTexture(u32 texture) override;
+        void memoryBarrier(u32 barriers) override;
+    };
+}  // namespace x::Graphics
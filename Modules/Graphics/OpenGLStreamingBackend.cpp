@@ -0,0 +1,68 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "OpenGLStreamingBackend.hpp"
+#include "DebugOpenGL.hpp"
+#include "GLState.hpp"
+#include "Panic.hpp"
+
+#include <algorithm>
+
+namespace x::Graphics {
+    size_t OpenGLStreamingBackend::getAlignment() {
+        GLint uniformAlignment = 0, storageAlignment = 0;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniformAlignment);
+        glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &storageAlignment);
+        return CAST<size_t>(std::max(uniformAlignment, storageAlignment));
+    }
+
+    u32 OpenGLStreamingBackend::createBuffer(size_t size, u8*& mapped) {
+        constexpr GLbitfield kFlags =
+          GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        u32 buffer = 0;
+        glCreateBuffers(1, &buffer);
+        glNamedBufferStorage(buffer, CAST<GLsizeiptr>(size), nullptr, kFlags);
+        mapped = CAST<u8*>(glMapNamedBufferRange(buffer, 0, CAST<GLsizeiptr>(size), kFlags));
+        if (CHECK_GL_ERROR() || !mapped) { Panic("Failed to map streaming buffer"); }
+        return buffer;
+    }
+
+    void OpenGLStreamingBackend::destroyBuffer(u32 buffer) {
+        glUnmapNamedBuffer(buffer);
+        glDeleteBuffers(1, &buffer);
+        GLState::current().forgetBuffer(buffer);
+    }
+
+    IStreamingBufferBackend::Fence OpenGLStreamingBackend::createFence() {
+        return glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+    bool OpenGLStreamingBackend::isSignaled(Fence fence) {
+        const GLenum result = glClientWaitSync(CAST<GLsync>(fence), 0, 0);
+        return result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+    }
+
+    void OpenGLStreamingBackend::waitFence(Fence fence) {
+        constexpr GLuint64 kTimeout = 1000000000;  // 1 second, in nanoseconds
+        GLenum result;
+        do {
+            result = glClientWaitSync(CAST<GLsync>(fence), GL_SYNC_FLUSH_COMMANDS_BIT, kTimeout);
+        } while (result == GL_TIMEOUT_EXPIRED);
+        if (result == GL_WAIT_FAILED) { CHECK_GL_ERROR(); }
+    }
+
+    void OpenGLStreamingBackend::deleteFence(Fence fence) {
+        glDeleteSync(CAST<GLsync>(fence));
+    }
+
+    void OpenGLStreamingBackend::bindRange(GLenum target,
+                                           u32 index,
+                                           const StreamingBuffer::Allocation& allocation) {
+        GLState::current().bindBufferRange(target,
+                                           index,
+                                           allocation.buffer,
+                                           allocation.offset,
+                                           allocation.size);
+    }
+}  // namespace x::Graphics
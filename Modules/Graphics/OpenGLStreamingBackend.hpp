@@ -0,0 +1,31 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "StreamingBuffer.hpp"
+
+#include <glad.h>
+
+namespace x::Graphics {
+    /// @brief Backs a StreamingBuffer with immutable, persistently and coherently mapped GL
+    /// buffers and GL sync objects.
+    class OpenGLStreamingBackend final : public IStreamingBufferBackend {
+    public:
+        size_t getAlignment() override;
+        u32 createBuffer(size_t size, u8*& mapped) override;
+        void destroyBuffer(u32 buffer) override;
+
+        Fence createFence() override;
+        bool isSignaled(Fence fence) override;
+        void waitFence(Fence fence) override;
+        void deleteFence(Fence fence) override;
+
+        /// @brief Binds an allocation to an indexed target (GL_UNIFORM_BUFFER,
+        /// GL_SHADER_STORAGE_BUFFER)
+        static void bindRange(GLenum target,
+                              u32 index,
+                              const StreamingBuffer::Allocation& allocation);
+    };
+}  // namespace x::Graphics
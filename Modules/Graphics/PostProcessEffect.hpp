@@ -5,38 +5,14 @@
 #pragma once
 
 #include "Types.hpp"
-#include "Volatile.hpp"
 
 namespace x::Graphics {
-    class IPostProcessEffect : public Volatile {
+    class IPostProcessEffect {
     public:
-        virtual void setInputTexture(const u32 texture)     = 0;
-        virtual void setRenderTarget(const u32 frameBuffer) = 0;
-        virtual void apply() const                          = 0;
+        virtual ~IPostProcessEffect() = default;
+        /// @brief Runs the effect from inputTexture into outputTexture, a width x height image
+        /// owned by the caller (e.g. a RenderGraph). The caller also places the barrier the
+        /// output's readers need.
+        virtual void apply(u32 inputTexture, u32 outputTexture, i32 width, i32 height) const = 0;
     };
-
-    class PostProcessEffect : public IPostProcessEffect {
-    public:
-        PostProcessEffect() : _inputTexture(0), _renderTarget(0) {}
-
-        void setInputTexture(const u32 texture) override {
-            _inputTexture = texture;
-        }
-
-        void setRenderTarget(const u32 frameBuffer) override {
-            _renderTarget = frameBuffer;
-        }
-
-        u32 getInputTexture() const {
-            return _inputTexture;
-        }
-
-        u32 getRenderTarget() const {
-            return _renderTarget;
-        }
-
-    private:
-        u32 _inputTexture;
-        u32 _renderTarget;
-    };
-}  // namespace x::Graphics
\ No newline at end of file
+}  // namespace x::Graphics
@@ -3,6 +3,8 @@
 //
 
 #include "PostProcessQuad.hpp"
+#include "GLState.hpp"
+#include "RenderStats.hpp"
 #include "ShaderManager.hpp"
 
 #include <glad.h>
@@ -41,14 +43,12 @@ namespace x {
         void PostProcessQuad::draw(u32 renderTexture) const {
             _shader->use();
             _shader->setInt("uRenderTexture", 0);
-            glActiveTexture(GL_TEXTURE0);
-            glBindTexture(GL_TEXTURE_2D, renderTexture);
-            CHECK_GL_ERROR();
+            GLState::current().bindTexture(0, renderTexture);
 
             _vertexArray->bind();
-            _vertexArray->bindIndexBuffer();
             glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_INT, 0);
             CHECK_GL_ERROR();
+            RenderStats::current().recordDraw(3);
             _vertexArray->unbind();
         }
 
@@ -5,7 +5,7 @@
 #pragma once
 
 #include "Types.hpp"
-#include "Mesh.hpp"
+#include "VertexArray.hpp"
 #include "ShaderProgram.hpp"
 
 #include <memory>
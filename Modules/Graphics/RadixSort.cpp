@@ -0,0 +1,40 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "RadixSort.hpp"
+
+#include <array>
+
+namespace x::Graphics {
+    void radixSort(std::vector<SortEntry>& entries, std::vector<SortEntry>& scratch) {
+        const size_t count = entries.size();
+        if (count < 2) { return; }
+        scratch.resize(count);
+
+        // Build all eight histograms in a single pass over the keys
+        std::array<std::array<u32, 256>, 8> histograms {};
+        for (const auto& entry : entries) {
+            for (size_t byte = 0; byte < 8; byte++) {
+                histograms[byte][(entry.key >> (byte * 8)) & 0xFF]++;
+            }
+        }
+
+        for (size_t byte = 0; byte < 8; byte++) {
+            auto& histogram = histograms[byte];
+            // Every key has the same value in this byte, so this pass would not move anything
+            if (histogram[(entries[0].key >> (byte * 8)) & 0xFF] == count) { continue; }
+
+            u32 offset = 0;
+            for (auto& bucket : histogram) {
+                const u32 bucketCount = bucket;
+                bucket                = offset;
+                offset += bucketCount;
+            }
+            for (const auto& entry : entries) {
+                scratch[histogram[(entry.key >> (byte * 8)) & 0xFF]++] = entry;
+            }
+            entries.swap(scratch);
+        }
+    }
+}  // namespace x::Graphics
@@ -0,0 +1,22 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+
+#include <vector>
+
+namespace x::Graphics {
+    /// @brief Sort key plus the index of the item it belongs to. Sorting these instead of the
+    /// items themselves keeps the passes cheap for large items.
+    struct SortEntry {
+        u64 key;
+        u32 index;
+    };
+
+    /// @brief Stable LSD radix sort on the keys, one byte per pass. Byte passes where every key
+    /// is equal are skipped. scratch is resized as needed and can be reused between calls.
+    void radixSort(std::vector<SortEntry>& entries, std::vector<SortEntry>& scratch);
+}  // namespace x::Graphics
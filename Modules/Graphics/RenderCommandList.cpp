@@ -0,0 +1,52 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "RenderCommandList.hpp"
+
+#include <algorithm>
+
+namespace x::Graphics {
+    void RenderCommandList::begin(size_t listCount) {
+        // Lists are cleared rather than dropped so their capacity carries over between ticks
+        _lists.resize(std::max<size_t>(listCount, 1));
+        for (auto& list : _lists) {
+            list.clear();
+        }
+        _commands.clear();
+    }
+
+    void RenderCommandList::record(size_t list, const RenderCommand& command) {
+        _lists[list].push_back(command);
+    }
+
+    void RenderCommandList::finish() {
+        _merged.clear();
+        _order.clear();
+        for (const auto& list : _lists) {
+            for (const auto& command : list) {
+                _order.push_back({command.key, CAST<u32>(_merged.size())});
+                _merged.push_back(command);
+            }
+        }
+        radixSort(_order, _scratch);
+
+        _commands.clear();
+        _commands.reserve(_merged.size());
+        for (const auto& entry : _order) {
+            _commands.push_back(_merged[entry.index]);
+        }
+    }
+
+    std::span<const RenderCommand> RenderCommandList::getCommands() const {
+        return _commands;
+    }
+
+    size_t RenderCommandList::size() const {
+        return _commands.size();
+    }
+
+    bool RenderCommandList::empty() const {
+        return _commands.empty();
+    }
+}  // namespace x::Graphics
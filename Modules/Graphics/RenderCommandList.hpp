@@ -0,0 +1,51 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "RadixSort.hpp"
+#include "Math/AffineTransform.hpp"
+
+#include <span>
+#include <vector>
+
+namespace x::Graphics {
+    /// @brief One recorded draw: which mesh of which model, where, and its sort key. Model IDs
+    /// are resolved to GPU state by the render thread, so recording needs no GL context.
+    struct RenderCommand {
+        u64 key;  // See RenderQueue::makeKey
+        u32 model;
+        u16 mesh;  // Index of the mesh within the model
+        u16 lod;   // Level of detail of the mesh, see MeshLod
+        Math::AffineTransform transform;
+    };
+
+    static_assert(sizeof(RenderCommand) == 64, "RenderCommand should fill one cache line");
+
+    /// @brief Draws recorded by the update side at the end of a tick, for the render thread to
+    /// decode and submit without walking the game state.
+    ///
+    /// begin() sets up one list per recording thread. Each thread only appends to its own list,
+    /// so recording needs no locking. finish() merges the lists in order and sorts the result by
+    /// key; commands with equal keys keep their recording order.
+    class RenderCommandList {
+    public:
+        void begin(size_t listCount);
+        void record(size_t list, const RenderCommand& command);
+        void finish();
+
+        /// @brief Commands in key order. Empty until finish() has run.
+        [[nodiscard]] std::span<const RenderCommand> getCommands() const;
+        [[nodiscard]] size_t size() const;
+        [[nodiscard]] bool empty() const;
+
+    private:
+        std::vector<std::vector<RenderCommand>> _lists;
+        std::vector<RenderCommand> _commands;
+        std::vector<RenderCommand> _merged;
+        std::vector<SortEntry> _order;
+        std::vector<SortEntry> _scratch;
+    };
+}  // namespace x::Graphics
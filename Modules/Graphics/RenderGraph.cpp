@@ -0,0 +1,265 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "RenderGraph.hpp"
+#include "Panic.hpp"
+
+#include <array>
+#include <bit>
+
+namespace x::Graphics {
+    void RenderGraph::Builder::read(RenderResource resource, RenderAccess access) {
+        _graph.addAccess(_pass, resource, access, false);
+    }
+
+    void RenderGraph::Builder::write(RenderResource resource, RenderAccess access) {
+        _graph.addAccess(_pass, resource, access, true);
+    }
+
+    void RenderGraph::Builder::setSideEffect() {
+        _graph._passes[_pass].sideEffect = true;
+    }
+
+    void RenderGraph::reset() {
+        _resources.clear();
+        _accesses.clear();
+        _passes.clear();
+        _compiled = false;
+    }
+
+    RenderResource RenderGraph::importTexture(const char* name,
+                                              u32 texture,
+                                              const RenderTextureDesc& desc) {
+        _resources.push_back({name, desc, texture, kNone, kNone, kNone, true});
+        _compiled = false;
+        return CAST<RenderResource>(_resources.size() - 1);
+    }
+
+    RenderResource RenderGraph::createTexture(const char* name, const RenderTextureDesc& desc) {
+        _resources.push_back({name, desc, 0, kNone, kNone, kNone, false});
+        _compiled = false;
+        return CAST<RenderResource>(_resources.size() - 1);
+    }
+
+    void RenderGraph::addPass(const char* name, const SetupFunc& setup, ExecuteFunc execute) {
+        const auto pass = CAST<u32>(_passes.size());
+        _passes.push_back(
+          {name, std::move(execute), CAST<u32>(_accesses.size()), 0, 0, false, false});
+        Builder builder(*this, pass);
+        setup(builder);
+        _compiled = false;
+    }
+
+    void RenderGraph::addAccess(u32 pass,
+                                RenderResource resource,
+                                RenderAccess access,
+                                bool write) {
+        if (resource >= _resources.size()) {
+            Panic("Pass '%s' uses an unknown resource", _passes[pass].name);
+        }
+        _accesses.push_back({resource, access, write});
+        _passes[pass].accessCount++;
+    }
+
+    void RenderGraph::compile() {
+        _frame++;
+        cullPasses();
+        assignSlots();
+        placeBarriers();
+        _compiled = true;
+    }
+
+    void RenderGraph::cullPasses() {
+        // Walk back from the passes that must run; a live pass needs whatever it reads, and a
+        // full overwrite ends the need for earlier writers
+        _needed.assign(_resources.size(), 0);
+        for (u32 p = CAST<u32>(_passes.size()); p-- > 0;) {
+            auto& pass = _passes[p];
+            bool live  = pass.sideEffect;
+            for (u32 a = pass.firstAccess; a < pass.firstAccess + pass.accessCount; a++) {
+                const auto& access = _accesses[a];
+                if (!access.write) { continue; }
+                live |= _resources[access.resource].imported || _needed[access.resource];
+            }
+            pass.culled = !live;
+            if (!live) { continue; }
+
+            for (u32 a = pass.firstAccess; a < pass.firstAccess + pass.accessCount; a++) {
+                if (_accesses[a].write) { _needed[_accesses[a].resource] = 0; }
+            }
+            for (u32 a = pass.firstAccess; a < pass.firstAccess + pass.accessCount; a++) {
+                if (!_accesses[a].write) { _needed[_accesses[a].resource] = 1; }
+            }
+        }
+    }
+
+    void RenderGraph::assignSlots() {
+        for (auto& slot : _pool) {
+            slot.inUse = false;
+        }
+        for (auto& resource : _resources) {
+            resource.slot     = kNone;
+            resource.lastPass = kNone;
+        }
+
+        for (u32 p = 0; p < _passes.size(); p++) {
+            const auto& pass = _passes[p];
+            if (pass.culled) { continue; }
+            for (u32 a = pass.firstAccess; a < pass.firstAccess + pass.accessCount; a++) {
+                _resources[_accesses[a].resource].lastPass = p;
+            }
+        }
+
+        // A texture is acquired at its first live use and returned after its last, so a later
+        // resource with the same description can take it over
+        for (u32 p = 0; p < _passes.size(); p++) {
+            const auto& pass = _passes[p];
+            if (pass.culled) { continue; }
+            for (u32 a = pass.firstAccess; a < pass.firstAccess + pass.accessCount; a++) {
+                auto& resource = _resources[_accesses[a].resource];
+                if (resource.imported || resource.slot != kNone) { continue; }
+                if (!_accesses[a].write) {
+                    Panic("Pass '%s' reads '%s' before any pass writes it",
+                          pass.name,
+                          resource.name);
+                }
+                resource.slot = acquireSlot(resource.desc);
+            }
+            for (u32 a = pass.firstAccess; a < pass.firstAccess + pass.accessCount; a++) {
+                const auto& resource = _resources[_accesses[a].resource];
+                if (!resource.imported && resource.lastPass == p) {
+                    _pool[resource.slot].inUse = false;
+                }
+            }
+        }
+    }
+
+    u32 RenderGraph::acquireSlot(const RenderTextureDesc& desc) {
+        for (u32 i = 0; i < _pool.size(); i++) {
+            auto& slot = _pool[i];
+            if (slot.inUse || slot.desc != desc) { continue; }
+            slot.inUse         = true;
+            slot.lastUsedFrame = _frame;
+            return i;
+        }
+        _pool.push_back({desc, 0, _frame, true});
+        return CAST<u32>(_pool.size() - 1);
+    }
+
+    void RenderGraph::placeBarriers() {
+        // barrierBefore[bit] is the pass a barrier with that bit was last issued in front of; it
+        // covers ImageWrites of every pass before it
+        std::array<u32, 3> barrierBefore {};
+        for (auto& resource : _resources) {
+            resource.lastWrite = kNone;
+        }
+
+        for (u32 p = 0; p < _passes.size(); p++) {
+            auto& pass    = _passes[p];
+            pass.barriers = 0;
+            if (pass.culled) { continue; }
+
+            for (u32 a = pass.firstAccess; a < pass.firstAccess + pass.accessCount; a++) {
+                const auto& access = _accesses[a];
+                const u32 written  = _resources[access.resource].lastWrite;
+                const u32 bit      = getBarrierBit(access.access);
+                if (written == kNone) { continue; }
+                if (barrierBefore[std::countr_zero(bit)] <= written) { pass.barriers |= bit; }
+            }
+            for (u32 b = 0; b < barrierBefore.size(); b++) {
+                if (pass.barriers & (1u << b)) { barrierBefore[b] = p; }
+            }
+            for (u32 a = pass.firstAccess; a < pass.firstAccess + pass.accessCount; a++) {
+                const auto& access = _accesses[a];
+                if (access.write && access.access == RenderAccess::ImageWrite) {
+                    _resources[access.resource].lastWrite = p;
+                }
+            }
+        }
+    }
+
+    u32 RenderGraph::getBarrierBit(RenderAccess access) {
+        switch (access) {
+            case RenderAccess::Sampled:
+                return TextureFetchBarrier;
+            case RenderAccess::ImageRead:
+            case RenderAccess::ImageWrite:
+                return ImageAccessBarrier;
+            case RenderAccess::ColorAttachment:
+                return FramebufferBarrier;
+        }
+        return 0;
+    }
+
+    void RenderGraph::execute(IRenderGraphBackend& backend) {
+        if (!_compiled) { compile(); }
+
+        for (auto& slot : _pool) {
+            if (slot.lastUsedFrame == _frame && slot.texture == 0) {
+                slot.texture = backend.createTexture(slot.desc);
+            }
+        }
+        for (auto& resource : _resources) {
+            if (resource.slot != kNone) { resource.texture = _pool[resource.slot].texture; }
+        }
+
+        // Slot indices are dead once resources hold their textures, so the pool can compact
+        std::erase_if(_pool, [&](const PoolSlot& slot) {
+            if (_frame - slot.lastUsedFrame <= kMaxIdleFrames) { return false; }
+            if (slot.texture != 0) { backend.destroyTexture(slot.texture); }
+            return true;
+        });
+        for (auto& resource : _resources) {
+            if (!resource.imported) { resource.slot = kNone; }
+        }
+
+        for (const auto& pass : _passes) {
+            if (pass.culled) { continue; }
+            if (pass.barriers != 0) { backend.memoryBarrier(pass.barriers); }
+            pass.execute(*this);
+        }
+    }
+
+    void RenderGraph::releasePool(IRenderGraphBackend& backend) {
+        for (const auto& slot : _pool) {
+            if (slot.texture != 0) { backend.destroyTexture(slot.texture); }
+        }
+        _pool.clear();
+        _compiled = false;
+        for (auto& resource : _resources) {
+            if (!resource.imported) {
+                resource.texture = 0;
+                resource.slot    = kNone;
+            }
+        }
+    }
+
+    u32 RenderGraph::getTexture(RenderResource resource) const {
+        return _resources[resource].texture;
+    }
+
+    const RenderTextureDesc& RenderGraph::getDesc(RenderResource resource) const {
+        return _resources[resource].desc;
+    }
+
+    u32 RenderGraph::getPassCount() const {
+        return CAST<u32>(_passes.size());
+    }
+
+    const char* RenderGraph::getPassName(u32 pass) const {
+        return _passes[pass].name;
+    }
+
+    bool RenderGraph::isCulled(u32 pass) const {
+        return _passes[pass].culled;
+    }
+
+    u32 RenderGraph::getBarriers(u32 pass) const {
+        return _passes[pass].barriers;
+    }
+
+    u32 RenderGraph::getPoolSize() const {
+        return CAST<u32>(_pool.size());
+    }
+}  // namespace x::Graphics
@@ -0,0 +1,171 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+
+#include <functional>
+#include <vector>
+
+namespace x::Graphics {
+    /// @brief How a pass touches a texture. Decides which memory barrier, if any, the access
+    /// needs after an incoherent write.
+    enum class RenderAccess : u8 {
+        Sampled,          // Texture fetch through a sampler
+        ImageRead,        // imageLoad
+        ImageWrite,       // imageStore, incoherent until a barrier
+        ColorAttachment,  // Rendered to through a framebuffer
+    };
+
+    /// @brief Backend independent glMemoryBarrier bits
+    enum RenderBarrier : u32 {
+        TextureFetchBarrier = 1 << 0,
+        ImageAccessBarrier  = 1 << 1,
+        FramebufferBarrier  = 1 << 2,
+    };
+
+    struct RenderTextureDesc {
+        i32 width          = 0;
+        i32 height         = 0;
+        u32 internalFormat = 0;  // Sized GL format; the graph only compares it
+
+        bool operator==(const RenderTextureDesc&) const = default;
+    };
+
+    using RenderResource                           = u32;
+    static constexpr RenderResource kInvalidResource = ~0u;
+
+    /// @brief Creates the graph's pooled textures and issues its barriers.
+    class IRenderGraphBackend {
+    public:
+        virtual ~IRenderGraphBackend() = default;
+
+        /// @brief Returns the new texture's id
+        virtual u32 createTexture(const RenderTextureDesc& desc) = 0;
+        virtual void destroyTexture(u32 texture)                 = 0;
+        /// @brief barriers is a mask of RenderBarrier bits
+        virtual void memoryBarrier(u32 barriers) = 0;
+    };
+
+    /// @brief Orders a frame's passes by the textures they read and write.
+    ///
+    /// The graph is rebuilt every frame: reset(), import the persistent textures, create the
+    /// transient ones, then add passes in execution order. compile() culls passes whose writes
+    /// nothing live reads, unless they have side effects or write an imported texture. Each
+    /// transient texture lives from the first to the last live pass that touches it and is
+    /// backed by a pooled texture; textures with the same description and disjoint lifetimes
+    /// share one, so intermediate targets cost VRAM per overlapping lifetime rather than per
+    /// effect. Pooled textures persist across frames and are released after kMaxIdleFrames
+    /// frames without use.
+    ///
+    /// Barriers are placed before a pass only when it accesses a texture that an earlier pass
+    /// wrote through ImageWrite and no barrier with the matching bit was issued since. Writes
+    /// from earlier frames are assumed to be visible.
+    class RenderGraph {
+    public:
+        static constexpr u32 kMaxIdleFrames = 3;
+
+        /// @brief Declares the accesses of the pass being added
+        class Builder {
+        public:
+            void read(RenderResource resource, RenderAccess access);
+            void write(RenderResource resource, RenderAccess access);
+            /// @brief The pass has effects outside the graph, e.g. it presents, so it is never
+            /// culled
+            void setSideEffect();
+
+        private:
+            friend class RenderGraph;
+
+            Builder(RenderGraph& graph, u32 pass) : _graph(graph), _pass(pass) {}
+
+            RenderGraph& _graph;
+            u32 _pass;
+        };
+
+        using SetupFunc   = std::function<void(Builder&)>;
+        using ExecuteFunc = std::function<void(const RenderGraph&)>;
+
+        /// @brief Drops passes and resources. The texture pool is kept.
+        void reset();
+        /// @brief Texture owned outside the graph, never aliased
+        RenderResource importTexture(const char* name, u32 texture, const RenderTextureDesc& desc);
+        /// @brief Texture backed by the pool for the span of its live uses
+        RenderResource createTexture(const char* name, const RenderTextureDesc& desc);
+        /// @brief setup runs immediately; execute runs from execute() if the pass survives
+        void addPass(const char* name, const SetupFunc& setup, ExecuteFunc execute);
+
+        /// @brief Culls passes, assigns pooled textures and computes barriers
+        void compile();
+        /// @brief Compiles if needed, creates missing pooled textures, then runs the live passes
+        void execute(IRenderGraphBackend& backend);
+        /// @brief Destroys every pooled texture. Must be called while the context is current.
+        void releasePool(IRenderGraphBackend& backend);
+
+        /// @brief Texture id backing resource. Valid inside pass execution.
+        [[nodiscard]] u32 getTexture(RenderResource resource) const;
+        [[nodiscard]] const RenderTextureDesc& getDesc(RenderResource resource) const;
+
+        [[nodiscard]] u32 getPassCount() const;
+        [[nodiscard]] const char* getPassName(u32 pass) const;
+        [[nodiscard]] bool isCulled(u32 pass) const;
+        /// @brief RenderBarrier bits issued before pass
+        [[nodiscard]] u32 getBarriers(u32 pass) const;
+        /// @brief Pooled textures, including ones idle this frame
+        [[nodiscard]] u32 getPoolSize() const;
+
+    private:
+        static constexpr u32 kNone = ~0u;
+
+        struct Resource {
+            const char* name;
+            RenderTextureDesc desc;
+            u32 texture;
+            u32 slot;       // Pool slot of transient resources
+            u32 lastPass;   // Last live pass touching it
+            u32 lastWrite;  // Last pass that wrote it through ImageWrite
+            bool imported;
+        };
+
+        struct Access {
+            RenderResource resource;
+            RenderAccess access;
+            bool write;
+        };
+
+        struct Pass {
+            const char* name;
+            ExecuteFunc execute;
+            u32 firstAccess;
+            u32 accessCount;
+            u32 barriers;
+            bool sideEffect;
+            bool culled;
+        };
+
+        struct PoolSlot {
+            RenderTextureDesc desc;
+            u32 texture;
+            u64 lastUsedFrame;
+            bool inUse;
+        };
+
+        std::vector<Resource> _resources;
+        std::vector<Access> _accesses;  // Grouped by pass, in declaration order
+        std::vector<Pass> _passes;
+        std::vector<PoolSlot> _pool;
+        std::vector<u8> _needed;  // compile() scratch, per resource
+        u64 _frame     = 0;
+        bool _compiled = false;
+
+        void addAccess(u32 pass, RenderResource resource, RenderAccess access, bool write);
+        void cullPasses();
+        void assignSlots();
+        void placeBarriers();
+        u32 acquireSlot(const RenderTextureDesc& desc);
+
+        static u32 getBarrierBit(RenderAccess access);
+    };
+}  // namespace x::Graphics
@@ -0,0 +1,106 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "RenderQueue.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace x::Graphics {
+    u64 RenderQueue::makeKey(RenderPass pass, u32 program, u32 material, u32 mesh, f32 depth) {
+        // Bit patterns of non-negative floats sort like the floats themselves
+        const u32 depthBits = std::bit_cast<u32>(std::max(depth, 0.f));
+        const u64 passBits  = CAST<u64>(pass) << 60;
+
+        if (pass == RenderPass::Transparent) {
+            // pass:4 | ~depth:24 | program:12 | material:12 | mesh:12
+            const u64 farFirst = ~(depthBits >> 8) & 0xFFFFFF;
+            return passBits | farFirst << 36 | CAST<u64>(program & 0xFFF) << 24 |
+                   CAST<u64>(material & 0xFFF) << 12 | CAST<u64>(mesh & 0xFFF);
+        }
+
+        // pass:4 | program:12 | material:16 | mesh:16 | depth:16
+        return passBits | CAST<u64>(program & 0xFFF) << 48 | CAST<u64>(material & 0xFFFF) << 32 |
+               CAST<u64>(mesh & 0xFFFF) << 16 | CAST<u64>(depthBits >> 16);
+    }
+
+    void RenderQueue::reserve(size_t count) {
+        _packets.reserve(count);
+        _sortedPackets.reserve(count);
+        _order.reserve(count);
+        _scratch.reserve(count);
+    }
+
+    void RenderQueue::clear() {
+        _packets.clear();
+        _order.clear();
+    }
+
+    void RenderQueue::submit(const DrawPacket& packet) {
+        _order.push_back({packet.key, CAST<u32>(_packets.size())});
+        _packets.push_back(packet);
+    }
+
+    void RenderQueue::sort() {
+        if (_order.size() < 2) { return; }
+        radixSort(_order, _scratch);
+
+        // Keep _order[i].index == i so later submissions stay consistent
+        _sortedPackets.clear();
+        for (auto& entry : _order) {
+            _sortedPackets.push_back(_packets[entry.index]);
+            entry.index = CAST<u32>(_sortedPackets.size() - 1);
+        }
+        _packets.swap(_sortedPackets);
+    }
+
+    void RenderQueue::flush(IRenderBackend& backend) const {
+        const DrawPacket* previous = nullptr;
+        for (size_t i = 0; i < _packets.size();) {
+            const auto& packet = _packets[i];
+
+            const bool programChanged = !previous || packet.program != previous->program;
+            if (programChanged) { backend.bindProgram(packet.program); }
+            // Material uniforms live in the program object, so a new program needs them again
+            if (programChanged || packet.material != previous->material) {
+                backend.bindMaterial(packet);
+            }
+            if (!previous || packet.vertexArray != previous->vertexArray ||
+                packet.indexBuffer != previous->indexBuffer) {
+                backend.bindVertexArray(packet);
+            }
+
+            size_t runEnd = i + 1;
+            while (runEnd < _packets.size() && canBatch(packet, _packets[runEnd])) {
+                runEnd++;
+            }
+
+            if (packet.flags & Instanced) {
+                backend.drawInstanced(std::span(&packet, runEnd - i));
+            } else {
+                backend.draw(packet);
+            }
+            previous = &packet;
+            i        = runEnd;
+        }
+    }
+
+    size_t RenderQueue::size() const {
+        return _packets.size();
+    }
+
+    bool RenderQueue::empty() const {
+        return _packets.empty();
+    }
+
+    const DrawPacket& RenderQueue::operator[](size_t i) const {
+        return _packets[i];
+    }
+
+    bool RenderQueue::canBatch(const DrawPacket& a, const DrawPacket& b) {
+        return (a.flags & Instanced) && (b.flags & Instanced) && a.program == b.program &&
+               a.material == b.material && a.vertexArray == b.vertexArray &&
+               a.indexBuffer == b.indexBuffer;
+    }
+}  // namespace x::Graphics
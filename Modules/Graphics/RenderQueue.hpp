@@ -0,0 +1,98 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "RadixSort.hpp"
+#include "Math/AffineTransform.hpp"
+
+#include <span>
+#include <vector>
+
+namespace x::Graphics {
+    enum class RenderPass : u8 {
+        Opaque,
+        Transparent,
+    };
+
+    enum DrawFlags : u32 {
+        // The program reads per-instance data, so runs of identical state can be merged
+        Instanced = 1 << 0,
+    };
+
+    /// @brief Everything needed to issue one indexed draw.
+    struct DrawPacket {
+        u64 key;  // See RenderQueue::makeKey
+        u32 program;
+        u32 vertexArray;
+        u32 indexBuffer;
+        u32 indexCount;
+        u32 firstIndex;  // Where the mesh starts in a shared index buffer
+        u32 baseVertex;  // Added to every index, for meshes in a shared vertex buffer
+        u32 flags;
+        void* material;  // Opaque to the queue, only compared to detect material changes
+        Math::AffineTransform transform;
+    };
+
+    /// @brief Receives the state changes and draws of a flushed RenderQueue. The queue only calls
+    /// a bind function when the state actually differs from the previous packet.
+    class IRenderBackend {
+    public:
+        virtual ~IRenderBackend() = default;
+
+        virtual void bindProgram(u32 program)                 = 0;
+        virtual void bindMaterial(const DrawPacket& packet)    = 0;
+        virtual void bindVertexArray(const DrawPacket& packet) = 0;
+        virtual void draw(const DrawPacket& packet)            = 0;
+        /// @brief Draws one instance per packet. Only called with packets that are flagged
+        /// Instanced and share program, material, vertex array and index buffer; consecutive
+        /// packets for the same mesh (see isSameMesh) are instances of one draw command.
+        virtual void drawInstanced(std::span<const DrawPacket> packets) = 0;
+    };
+
+    /// @brief True if both packets draw the same range of the same buffers.
+    inline bool isSameMesh(const DrawPacket& a, const DrawPacket& b) {
+        return a.vertexArray == b.vertexArray && a.indexBuffer == b.indexBuffer &&
+               a.firstIndex == b.firstIndex && a.indexCount == b.indexCount &&
+               a.baseVertex == b.baseVertex;
+    }
+
+    /// @brief Collects a frame's draw packets and submits them in sort key order.
+    ///
+    /// Keys put the pass in the top bits. Opaque packets are then grouped by program, material
+    /// and mesh, with depth last so each group is drawn front to back. Transparent packets are
+    /// ordered by inverted depth first, giving back to front blending.
+    ///
+    /// Consecutive Instanced packets with the same program, material and buffers are merged into
+    /// one drawInstanced() call. Meshes sharing a geometry pool therefore collapse into a single
+    /// multi-draw, with sorting grouping every copy of a mesh into one of its commands.
+    class RenderQueue {
+    public:
+        static u64 makeKey(RenderPass pass, u32 program, u32 material, u32 mesh, f32 depth);
+
+        void reserve(size_t count);
+        void clear();
+        void submit(const DrawPacket& packet);
+        /// @brief Radix sorts the keys, then reorders the packets so each instanced batch is
+        /// contiguous.
+        void sort();
+        /// @brief Submits the packets in order. Call sort() first, unless they were submitted in
+        /// key order already (e.g. decoded from a RenderCommandList).
+        void flush(IRenderBackend& backend) const;
+
+        [[nodiscard]] size_t size() const;
+        [[nodiscard]] bool empty() const;
+        /// @brief Packet at position i, in sorted order once sort() has run
+        [[nodiscard]] const DrawPacket& operator[](size_t i) const;
+
+    private:
+        std::vector<DrawPacket> _packets;
+        std::vector<DrawPacket> _sortedPackets;
+        std::vector<SortEntry> _order;
+        std::vector<SortEntry> _scratch;
+
+        static bool canBatch(const DrawPacket& a, const DrawPacket& b);
+    };
+}  // namespace x::Graphics
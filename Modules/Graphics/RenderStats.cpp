@@ -0,0 +1,131 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "RenderStats.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace x::Graphics {
+    RenderStats& RenderStats::current() {
+        thread_local RenderStats stats;
+        return stats;
+    }
+
+    void RenderStats::beginFrame() {
+        _history[_historyHead] = _stats;
+        _historyHead           = (_historyHead + 1) % kHistorySize;
+        _historyCount          = std::min<size_t>(_historyCount + 1, kHistorySize);
+        _stats                 = {};
+    }
+
+    void RenderStats::reset() {
+        _stats        = {};
+        _historyCount = 0;
+        _historyHead  = 0;
+    }
+
+    void RenderStats::recordDraw(u64 indexCount, u64 instanceCount) {
+        _stats.drawCalls++;
+        _stats.indices += indexCount * instanceCount;
+    }
+
+    void RenderStats::recordMultiDraw(u64 indexCount) {
+        _stats.drawCalls++;
+        _stats.indices += indexCount;
+    }
+
+    void RenderStats::recordProgramSwitch() {
+        _stats.programSwitches++;
+    }
+
+    void RenderStats::recordTextureBind() {
+        _stats.textureBinds++;
+    }
+
+    void RenderStats::recordUpload(size_t bytes) {
+        _stats.bytesUploaded += bytes;
+    }
+
+    void RenderStats::recordDispatch() {
+        _stats.computeDispatches++;
+    }
+
+    const FrameStats& RenderStats::getStats() const {
+        return _stats;
+    }
+
+    FrameStats RenderStats::getLastFrameStats() const {
+        if (_historyCount == 0) { return {}; }
+        return _history[(_historyHead + kHistorySize - 1) % kHistorySize];
+    }
+
+    size_t RenderStats::getHistorySize() const {
+        return _historyCount;
+    }
+
+    f64 RenderStats::getAverage(Counter counter) const {
+        if (_historyCount == 0) { return 0.0; }
+        f64 sum = 0.0;
+        for (size_t i = 0; i < _historyCount; i++) {
+            sum += CAST<f64>(get(_history[i], counter));
+        }
+        return sum / CAST<f64>(_historyCount);
+    }
+
+    u64 RenderStats::getPercentile(Counter counter, f64 percentile) const {
+        if (_historyCount == 0) { return 0; }
+
+        // Order doesn't matter here, so the ring is read front to back
+        _scratch.resize(_historyCount);
+        for (size_t i = 0; i < _historyCount; i++) {
+            _scratch[i] = get(_history[i], counter);
+        }
+        const f64 clamped = std::clamp(percentile, 0.0, 100.0);
+        const auto rank   = CAST<size_t>(std::ceil(clamped / 100.0 * CAST<f64>(_historyCount)));
+        const auto nth    = _scratch.begin() + CAST<i64>(std::max<size_t>(rank, 1) - 1);
+        std::nth_element(_scratch.begin(), nth, _scratch.end());
+        return *nth;
+    }
+
+    const char* RenderStats::getName(Counter counter) {
+        switch (counter) {
+            case Counter::DrawCalls:
+                return "Draw Calls";
+            case Counter::Indices:
+                return "Indices";
+            case Counter::ProgramSwitches:
+                return "Program Switches";
+            case Counter::TextureBinds:
+                return "Texture Binds";
+            case Counter::BytesUploaded:
+                return "Bytes Uploaded";
+            case Counter::ComputeDispatches:
+                return "Compute Dispatches";
+            case Counter::Count:
+                break;
+        }
+        return "";
+    }
+
+    u64 RenderStats::get(const FrameStats& stats, Counter counter) {
+        switch (counter) {
+            case Counter::DrawCalls:
+                return stats.drawCalls;
+            case Counter::Indices:
+                return stats.indices;
+            case Counter::ProgramSwitches:
+                return stats.programSwitches;
+            case Counter::TextureBinds:
+                return stats.textureBinds;
+            case Counter::BytesUploaded:
+                return stats.bytesUploaded;
+            case Counter::ComputeDispatches:
+                return stats.computeDispatches;
+            case Counter::Count:
+                break;
+        }
+        return 0;
+    }
+}  // namespace x::Graphics
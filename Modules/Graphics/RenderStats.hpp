@@ -0,0 +1,80 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+
+#include <array>
+#include <vector>
+
+namespace x::Graphics {
+    struct FrameStats {
+        u64 drawCalls         = 0;
+        u64 indices           = 0;  // Vertices for non-indexed draws, summed over instances
+        u64 programSwitches   = 0;  // Program binds that reached the driver
+        u64 textureBinds      = 0;  // Texture binds that reached the driver
+        u64 bytesUploaded     = 0;  // Buffer updates and streamed per-frame data
+        u64 computeDispatches = 0;
+    };
+
+    /// @brief Counts the work the graphics wrappers submit each frame and keeps the last
+    /// kHistorySize frames for rolling averages and percentiles.
+    ///
+    /// Like GLState, there is one instance per thread; the render thread's is the one that
+    /// matters. Counting has no GL dependency, so tests can report into it directly.
+    class RenderStats {
+    public:
+        static constexpr u32 kHistorySize = 120;
+
+        enum class Counter : u32 {
+            DrawCalls,
+            Indices,
+            ProgramSwitches,
+            TextureBinds,
+            BytesUploaded,
+            ComputeDispatches,
+            Count,
+        };
+
+        RenderStats() = default;
+
+        /// @brief Stats of the calling thread
+        static RenderStats& current();
+
+        /// @brief Moves the frame in progress into the history and starts counting a new one
+        void beginFrame();
+        /// @brief Drops the history and the frame in progress
+        void reset();
+
+        void recordDraw(u64 indexCount, u64 instanceCount = 1);
+        /// @brief A multi-draw counts as one call covering all of its commands
+        void recordMultiDraw(u64 indexCount);
+        void recordProgramSwitch();
+        void recordTextureBind();
+        void recordUpload(size_t bytes);
+        void recordDispatch();
+
+        /// @brief Counts for the frame in progress
+        [[nodiscard]] const FrameStats& getStats() const;
+        /// @brief Counts for the last completed frame
+        [[nodiscard]] FrameStats getLastFrameStats() const;
+        /// @brief Number of completed frames in the history
+        [[nodiscard]] size_t getHistorySize() const;
+        /// @brief Mean of counter over the history
+        [[nodiscard]] f64 getAverage(Counter counter) const;
+        /// @brief Nearest-rank percentile (0-100) of counter over the history
+        [[nodiscard]] u64 getPercentile(Counter counter, f64 percentile) const;
+
+        static const char* getName(Counter counter);
+        static u64 get(const FrameStats& stats, Counter counter);
+
+    private:
+        FrameStats _stats;
+        std::array<FrameStats, kHistorySize> _history {};
+        size_t _historyCount = 0;
+        size_t _historyHead  = 0;  // Next slot to write
+        mutable std::vector<u64> _scratch;
+    };
+}  // namespace x::Graphics
@@ -6,9 +6,9 @@
 #include "Panic.hpp"
 
 namespace x::Graphics {
-    Shader::Shader(ShaderType shaderType, const str& shaderSource)
+    Shader::Shader(ShaderType shaderType, const str& shaderSource, bool deferErrorCheck)
         : _shaderType(shaderType), _shaderSource(shaderSource) {
-        compile();
+        compile(deferErrorCheck);
     }
 
     Shader::~Shader() {
@@ -27,12 +27,12 @@ namespace x::Graphics {
         return _shaderType;
     }
 
-    bool Shader::compile() {
+    bool Shader::compile(bool deferErrorCheck) {
         _id                = glCreateShader(shaderTypeToEnum(_shaderType));
         const char* source = _shaderSource.c_str();
         glShaderSource(_id, 1, &source, nullptr);
         glCompileShader(_id);
-        checkErrors();
+        if (!deferErrorCheck) { checkErrors(); }
         return true;
     }
 
@@ -19,19 +19,22 @@ namespace x::Graphics {
         friend class ComputeShader;
 
     public:
-        Shader(ShaderType shaderType, const str& shaderSource);
+        /// @brief Compiles the source. With deferErrorCheck the compile status is not queried,
+        /// so the call does not wait on the driver; call checkErrors() once it is done.
+        Shader(ShaderType shaderType, const str& shaderSource, bool deferErrorCheck = false);
         ~Shader();
 
         GLuint getId() const;
         const str& getSource() const;
         ShaderType getType() const;
+        /// @brief Panics with the info log if compilation failed. Waits for the compile.
+        void checkErrors() const;
 
     private:
         GLuint _id;
         ShaderType _shaderType;
         const str _shaderSource;
-        bool compile();
-        void checkErrors() const;
+        bool compile(bool deferErrorCheck);
         static GLenum shaderTypeToEnum(const ShaderType shaderType);
     };
 }  // namespace x::Graphics
\ No newline at end of file
@@ -4,7 +4,12 @@
 
 #include "ShaderProgram.hpp"
 #include "DebugOpenGL.hpp"
+#include "GLState.hpp"
 #include "Panic.hpp"
+#include "RenderStats.hpp"
+
+#include <algorithm>
+#include <string>
 
 namespace x::Graphics {
     ShaderProgram::ShaderProgram() {
@@ -14,6 +19,7 @@ namespace x::Graphics {
 
     ShaderProgram::~ShaderProgram() {
         glDeleteProgram(_id);
+        GLState::current().forgetProgram(_id);
     }
 
     void ShaderProgram::attachShader(const Shader& shader) {
@@ -21,13 +27,45 @@ namespace x::Graphics {
         glAttachShader(_id, shader.getId());
     }
 
-    void ShaderProgram::link() const {
+    void ShaderProgram::link() {
+        beginLink();
+        endLink();
+    }
+
+    void ShaderProgram::beginLink() {
+        // Lets ShaderManager cache the linked binary
+        glProgramParameteri(_id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
         glLinkProgram(_id);
+    }
+
+    void ShaderProgram::endLink() {
         checkErrors();
+        reflectUniforms();
+    }
+
+    bool ShaderProgram::loadBinary(u32 format, const void* binary, size_t size, bool compute) {
+        glProgramBinary(_id, format, binary, CAST<GLsizei>(size));
+        GLint success = 0;
+        glGetProgramiv(_id, GL_LINK_STATUS, &success);
+        if (!success) { return false; }
+        _containsCompute = compute;
+        reflectUniforms();
+        return true;
+    }
+
+    bool ShaderProgram::getBinary(u32& format, std::vector<u8>& binary) const {
+        GLint length = 0;
+        glGetProgramiv(_id, GL_PROGRAM_BINARY_LENGTH, &length);
+        if (length <= 0) { return false; }
+        binary.resize(CAST<size_t>(length));
+        GLsizei written = 0;
+        glGetProgramBinary(_id, length, &written, &format, binary.data());
+        binary.resize(CAST<size_t>(written));
+        return written > 0;
     }
 
     void ShaderProgram::use() const {
-        glUseProgram(_id);
+        GLState::current().useProgram(_id);
     }
 
     GLuint ShaderProgram::getId() const {
@@ -38,10 +76,7 @@ namespace x::Graphics {
         if (_containsCompute) {
             glDispatchCompute(x, y, z);
             CHECK_GL_ERROR();
-
-            glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
-            glBindFramebuffer(GL_FRAMEBUFFER, 0);
-            CHECK_GL_ERROR();
+            RenderStats::current().recordDispatch();
         } else {
             std::cout << "WARNING: ShaderProgram::dispatchCompute called on instance not "
                          "containing compute shader(s)."
@@ -56,8 +91,8 @@ namespace x::Graphics {
         return std::make_pair(x, y);
     }
 
-    void ShaderProgram::setBool(const str& name, bool value) const {
-        if (const auto location = getUniformLocation(name); location != -1) {
+    void ShaderProgram::setBool(UniformId uniform, bool value) const {
+        if (const auto location = getUniformLocation(uniform); location != -1) {
             glUniform1i(location, value);
         }
     }
@@ -126,92 +161,92 @@ namespace x::Graphics {
         glUniform1fv(location, (GLsizei)count, values);
     }
 
-    void ShaderProgram::setInt(const str& name, int value) const {
-        if (const auto location = getUniformLocation(name); location != -1) {
+    void ShaderProgram::setInt(UniformId uniform, int value) const {
+        if (const auto location = getUniformLocation(uniform); location != -1) {
             glUniform1i(location, value);
         }
     }
 
-    void ShaderProgram::setFloat(const str& name, float value) const {
-        if (const auto location = getUniformLocation(name); location != -1) {
+    void ShaderProgram::setFloat(UniformId uniform, float value) const {
+        if (const auto location = getUniformLocation(uniform); location != -1) {
             glUniform1f(location, value);
         }
     }
 
-    void ShaderProgram::setVec2(const str& name, const glm::vec2& value) const {
-        if (const auto location = getUniformLocation(name); location != -1) {
+    void ShaderProgram::setVec2(UniformId uniform, const glm::vec2& value) const {
+        if (const auto location = getUniformLocation(uniform); location != -1) {
             glUniform2fv(location, 1, &value[0]);
         }
     }
 
-    void ShaderProgram::setVec2(const str& name, float x, float y) const {
-        if (const auto location = getUniformLocation(name); location != -1) {
+    void ShaderProgram::setVec2(UniformId uniform, float x, float y) const {
+        if (const auto location = getUniformLocation(uniform); location != -1) {
             glUniform2f(location, x, y);
         }
     }
 
-    void ShaderProgram::setVec3(const str& name, const glm::vec3& value) const {
-        if (const auto location = getUniformLocation(name); location != -1) {
+    void ShaderProgram::setVec3(UniformId uniform, const glm::vec3& value) const {
+        if (const auto location = getUniformLocation(uniform); location != -1) {
             glUniform3fv(location, 1, &value[0]);
         }
     }
 
-    void ShaderProgram::setVec3(const str& name, float x, float y, float z) const {
-        if (const auto location = getUniformLocation(name); location != -1) {
+    void ShaderProgram::setVec3(UniformId uniform, float x, float y, float z) const {
+        if (const auto location = getUniformLocation(uniform); location != -1) {
             glUniform3f(location, x, y, z);
         }
     }
 
-    void ShaderProgram::setVec4(const str& name, const glm::vec4& value) const {
-        if (const auto location = getUniformLocation(name); location != -1) {
+    void ShaderProgram::setVec4(UniformId uniform, const glm::vec4& value) const {
+        if (const auto location = getUniformLocation(uniform); location != -1) {
             glUniform4fv(location, 1, &value[0]);
         }
     }
 
-    void ShaderProgram::setVec4(const str& name, float x, float y, float z, float w) const {
-        if (const auto location = getUniformLocation(name); location != -1) {
+    void ShaderProgram::setVec4(UniformId uniform, float x, float y, float z, float w) const {
+        if (const auto location = getUniformLocation(uniform); location != -1) {
             glUniform4f(location, x, y, z, w);
         }
     }
 
-    void ShaderProgram::setMat2(const str& name, const glm::mat2& mat) const {
-        if (const auto location = getUniformLocation(name); location != -1) {
+    void ShaderProgram::setMat2(UniformId uniform, const glm::mat2& mat) const {
+        if (const auto location = getUniformLocation(uniform); location != -1) {
             glUniformMatrix2fv(location, 1, GL_FALSE, &mat[0][0]);
         }
     }
 
-    void ShaderProgram::setMat3(const str& name, const glm::mat3& mat) const {
-        if (const auto location = getUniformLocation(name); location != -1) {
+    void ShaderProgram::setMat3(UniformId uniform, const glm::mat3& mat) const {
+        if (const auto location = getUniformLocation(uniform); location != -1) {
             glUniformMatrix3fv(location, 1, GL_FALSE, &mat[0][0]);
         }
     }
 
-    void ShaderProgram::setMat4(const str& name, const glm::mat4& mat) const {
-        if (const auto location = getUniformLocation(name); location != -1) {
+    void ShaderProgram::setMat4(UniformId uniform, const glm::mat4& mat) const {
+        if (const auto location = getUniformLocation(uniform); location != -1) {
             glUniformMatrix4fv(location, 1, GL_FALSE, &mat[0][0]);
         }
     }
 
-    void ShaderProgram::setVec2i(const str& name, i32 x, i32 y) const {
-        if (const auto location = getUniformLocation(name); location != -1) {
+    void ShaderProgram::setVec2i(UniformId uniform, i32 x, i32 y) const {
+        if (const auto location = getUniformLocation(uniform); location != -1) {
             glUniform2i(location, x, y);
         }
     }
 
-    void ShaderProgram::setVec3i(const str& name, i32 x, i32 y, i32 z) const {
-        if (const auto location = getUniformLocation(name); location != -1) {
+    void ShaderProgram::setVec3i(UniformId uniform, i32 x, i32 y, i32 z) const {
+        if (const auto location = getUniformLocation(uniform); location != -1) {
             glUniform3i(location, x, y, z);
         }
     }
 
-    void ShaderProgram::setVec4i(const str& name, i32 x, i32 y, i32 z, i32 w) const {
-        if (const auto location = getUniformLocation(name); location != -1) {
+    void ShaderProgram::setVec4i(UniformId uniform, i32 x, i32 y, i32 z, i32 w) const {
+        if (const auto location = getUniformLocation(uniform); location != -1) {
             glUniform4i(location, x, y, z, w);
         }
     }
 
-    void ShaderProgram::setFloatArray(const str& name, const f32* values, size_t count) const {
-        if (const auto location = getUniformLocation(name); location != -1) {
+    void ShaderProgram::setFloatArray(UniformId uniform, const f32* values, size_t count) const {
+        if (const auto location = getUniformLocation(uniform); location != -1) {
             glUniform1fv(location, CAST<GLsizei>(count), values);
         }
     }
@@ -226,7 +261,54 @@ namespace x::Graphics {
         }
     }
 
-    i32 ShaderProgram::getUniformLocation(const str& name) const {
-        return glGetUniformLocation(_id, name.c_str());
+    i32 ShaderProgram::getUniformLocation(UniformId uniform) const {
+        const auto it = std::lower_bound(
+          _uniforms.begin(),
+          _uniforms.end(),
+          uniform.value(),
+          [](const UniformSlot& slot, u64 hash) { return slot.hash < hash; });
+        if (it == _uniforms.end() || it->hash != uniform.value()) { return -1; }
+        return it->location;
+    }
+
+    void ShaderProgram::reflectUniforms() {
+        _uniforms.clear();
+
+        GLint count = 0, maxNameLength = 0;
+        glGetProgramInterfaceiv(_id, GL_UNIFORM, GL_ACTIVE_RESOURCES, &count);
+        glGetProgramInterfaceiv(_id, GL_UNIFORM, GL_MAX_NAME_LENGTH, &maxNameLength);
+        CHECK_GL_ERROR();
+
+        std::vector<char> name(CAST<size_t>(std::max(maxNameLength, 1)));
+        const GLenum properties[] = {GL_LOCATION, GL_ARRAY_SIZE};
+        for (GLint i = 0; i < count; i++) {
+            GLint values[2] = {-1, 1};
+            glGetProgramResourceiv(_id, GL_UNIFORM, i, 2, properties, 2, nullptr, values);
+            const auto [location, arraySize] = values;
+            // Members of uniform blocks have no location
+            if (location == -1) { continue; }
+
+            GLsizei length = 0;
+            glGetProgramResourceName(
+              _id, GL_UNIFORM, i, CAST<GLsizei>(name.size()), &length, name.data());
+            const std::string_view uniformName(name.data(), length);
+            _uniforms.push_back({UniformId::hash(uniformName), location});
+
+            // Arrays of basic types are reported once, as "name[0]", and their elements take
+            // consecutive locations. Let the bare name address the first element.
+            if (uniformName.ends_with("[0]")) {
+                const auto arrayName = uniformName.substr(0, uniformName.size() - 3);
+                _uniforms.push_back({UniformId::hash(arrayName), location});
+                for (GLint element = 1; element < arraySize; element++) {
+                    const auto elementName = str(arrayName) + "[" + std::to_string(element) + "]";
+                    _uniforms.push_back({UniformId::hash(elementName), location + element});
+                }
+            }
+        }
+        CHECK_GL_ERROR();
+
+        std::sort(_uniforms.begin(), _uniforms.end(), [](const auto& a, const auto& b) {
+            return a.hash < b.hash;
+        });
     }
 }  // namespace x::Graphics
\ No newline at end of file
@@ -8,7 +8,9 @@
 
 #include "Shader.hpp"
 #include "Types.hpp"
+#include "UniformId.hpp"
 #include <glm/glm.hpp>
+#include <vector>
 
 namespace x::Graphics {
     class ShaderProgram {
@@ -17,56 +19,80 @@ namespace x::Graphics {
         ~ShaderProgram();
 
         void attachShader(const Shader& shader);
-        void link() const;
+        /// @brief Links the program and reflects its active uniforms into the location table.
+        void link();
+        /// @brief First half of link(): starts the link without waiting for it
+        void beginLink();
+        /// @brief Second half of link(): waits for the link, then checks and reflects it
+        void endLink();
+        /// @brief Loads a binary from getBinary() in place of attaching and linking. Returns
+        /// false if the driver rejects it, e.g. after a driver update; the program is then
+        /// unlinked and can still be built from source.
+        bool loadBinary(u32 format, const void* binary, size_t size, bool compute);
+        /// @brief Retrieves the linked program's binary. False if the driver offers none.
+        bool getBinary(u32& format, std::vector<u8>& binary) const;
         void use() const;
         u32 getId() const;
+        /// @brief Issues no barrier; callers (or a RenderGraph) place the one their readers need.
         void dispatchCompute(u32 x, u32 y, u32 z) const;
 
         static std::pair<u32, u32> getComputeWorkGroupSize(u32 workGroups, i32 width, i32 height);
 
+        /// @brief Location of the uniform, or -1 if the program has no such active uniform.
+        /// Elements of uniform arrays resolve by full name ("uValues[2]", "uLights[2].color"),
+        /// and the first element of an array of basic types also resolves by the bare name.
+        [[nodiscard]] i32 getUniformLocation(UniformId uniform) const;
+
         // TODO: Refactor these to use templates / generics
 
         // Common setters
-        void setBool(const str& name, bool value) const;
+        void setBool(UniformId uniform, bool value) const;
         void setBool(const u32 location, bool value) const;
-        void setInt(const str& name, i32 value) const;
+        void setInt(UniformId uniform, i32 value) const;
         void setInt(const u32 location, i32 value) const;
-        void setFloat(const str& name, f32 value) const;
+        void setFloat(UniformId uniform, f32 value) const;
         void setFloat(const u32 location, f32 value) const;
-        void setVec2(const str& name, const glm::vec2& value) const;
+        void setVec2(UniformId uniform, const glm::vec2& value) const;
         void setVec2(const u32 location, const glm::vec2& value) const;
-        void setVec2(const str& name, f32 x, f32 y) const;
+        void setVec2(UniformId uniform, f32 x, f32 y) const;
         void setVec2(const u32 location, f32 x, f32 y) const;
-        void setVec3(const str& name, const glm::vec3& value) const;
+        void setVec3(UniformId uniform, const glm::vec3& value) const;
         void setVec3(const u32 location, const glm::vec3& value) const;
-        void setVec3(const str& name, f32 x, f32 y, f32 z) const;
+        void setVec3(UniformId uniform, f32 x, f32 y, f32 z) const;
         void setVec3(const u32 location, f32 x, f32 y, f32 z) const;
-        void setVec4(const str& name, const glm::vec4& value) const;
+        void setVec4(UniformId uniform, const glm::vec4& value) const;
         void setVec4(const u32 location, const glm::vec4& value) const;
-        void setVec4(const str& name, f32 x, f32 y, f32 z, f32 w) const;
+        void setVec4(UniformId uniform, f32 x, f32 y, f32 z, f32 w) const;
         void setVec4(const u32 location, f32 x, f32 y, f32 z, f32 w) const;
-        void setMat2(const str& name, const glm::mat2& mat) const;
+        void setMat2(UniformId uniform, const glm::mat2& mat) const;
         void setMat2(const u32 location, const glm::mat2& mat) const;
-        void setMat3(const str& name, const glm::mat3& mat) const;
+        void setMat3(UniformId uniform, const glm::mat3& mat) const;
         void setMat3(const u32 location, const glm::mat3& mat) const;
-        void setMat4(const str& name, const glm::mat4& mat) const;
+        void setMat4(UniformId uniform, const glm::mat4& mat) const;
         void setMat4(const u32 location, const glm::mat4& mat) const;
 
         // Additional setters
-        void setVec2i(const str& name, i32 x, i32 y) const;
+        void setVec2i(UniformId uniform, i32 x, i32 y) const;
         void setVec2i(const u32 location, i32 x, i32 y) const;
-        void setVec3i(const str& name, i32 x, i32 y, i32 z) const;
+        void setVec3i(UniformId uniform, i32 x, i32 y, i32 z) const;
         void setVec3i(const u32 location, i32 x, i32 y, i32 z) const;
-        void setVec4i(const str& name, i32 x, i32 y, i32 z, i32 w) const;
+        void setVec4i(UniformId uniform, i32 x, i32 y, i32 z, i32 w) const;
         void setVec4i(const u32 location, i32 x, i32 y, i32 z, i32 w) const;
-        void setFloatArray(const str& name, const f32* values, size_t count) const;
+        void setFloatArray(UniformId uniform, const f32* values, size_t count) const;
         void setFloatArray(const u32 location, const f32* values, size_t count) const;
 
     private:
+        struct UniformSlot {
+            u64 hash;
+            i32 location;
+        };
+
         u32 _id;
         bool _containsCompute = false;
+        std::vector<UniformSlot> _uniforms;  // Sorted by hash
+
         void checkErrors() const;
-        i32 getUniformLocation(const str& name) const;
+        void reflectUniforms();
     };
 
     // Template implementations
@@ -1,30 +1,61 @@
 #pragma once
 static const char* PBR_VS_Source = R""(
 #version 460 core
-layout (location = 0) in vec3 aPos;
-layout (location = 1) in vec3 aNormal;
-layout (location = 2) in vec3 aTangent;
-layout (location = 3) in vec3 aBiTangent;
+// Graphics::VertexPacked. The position is in [0, 1] within the mesh bounds; the model transform
+// includes the mesh's dequantization. The bitangent is cross(normal, tangent) * (aPos.w * 2 - 1).
+layout (location = 0) in vec4 aPos;
+layout (location = 1) in vec2 aNormal;// Octahedral
+layout (location = 2) in vec2 aTangent;// Octahedral
 layout (location = 4) in vec2 aTexCoord;
 
-uniform mat4 M;
-uniform mat4 V;
-uniform mat4 P;
-uniform mat4 MV;
-uniform mat4 VP;
-uniform mat4 MVP;
+// Must match octDecode() in Graphics/VertexPacking.cpp
+vec3 octDecode(vec2 e) {
+    vec3 v = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    float t = max(-v.z, 0.0);
+    v.xy += vec2(v.x >= 0.0 ? -t : t, v.y >= 0.0 ? -t : t);
+    return normalize(v);
+}
+
+// Must match the blocks in Graphics/UniformBlocks.hpp
+layout (std140, binding = 1) uniform FrameData {
+    mat4 view;
+    mat4 projection;
+    mat4 viewProjection;
+    vec4 cameraPosition;
+} uFrame;
+
+layout (std140, binding = 3) uniform ObjectData {
+    mat4 model;
+    mat3 normalMatrix;
+} uObject;
+
+struct Material {
+    vec3 albedo;
+    float metallic;
+    float roughness;
+    float ao;
+};
+
+uniform Material uMaterial;
 
-out struct VSOut {
+out VSOut {
     vec2 texCoord;
     vec3 fragPos;
     vec3 normal;
+    flat vec3 albedo;
+    flat float metallic;
+    flat float roughness;
+    flat float ao;
 } vsOut;
 
 void main() {
-    vsOut.fragPos = vec3(M * vec4(aPos, 1.0));
-    mat3 normalMatrix = mat3(transpose(inverse(M)));
-    vsOut.normal = normalize(normalMatrix * aNormal);
+    vsOut.fragPos = vec3(uObject.model * vec4(aPos.xyz, 1.0));
+    vsOut.normal = normalize(uObject.normalMatrix * octDecode(aNormal));
     vsOut.texCoord = aTexCoord;
-    gl_Position = VP * vec4(vsOut.fragPos, 1.0);
+    vsOut.albedo = uMaterial.albedo;
+    vsOut.metallic = uMaterial.metallic;
+    vsOut.roughness = uMaterial.roughness;
+    vsOut.ao = uMaterial.ao;
+    gl_Position = uFrame.viewProjection * vec4(vsOut.fragPos, 1.0);
 }
 )"";
@@ -0,0 +1,157 @@
+#pragma once
+static const char* TonemapFXAA_CS_Source = R""(
+#version 460
+
+// Tonemapping and FXAA in one dispatch. Each 16x16 group tonemaps a 32x32 tile plus an apron
+// into shared memory, then every thread anti-aliases a 2x2 block of the tile, so the
+// tonemapped image never goes through memory.
+layout(local_size_x = 16, local_size_y = 16, local_size_z = 1) in;
+
+layout(rgba16f, binding = 0) uniform readonly image2D hdrBuffer;
+layout(rgba8, binding = 1) uniform writeonly image2D outputBuffer;
+
+layout(std140, binding = 0) uniform TonemapParams {
+    float exposure;
+    float gamma;
+    int tonemapOperator;// 0 = ACES, 1 = Reinhard, 2 = Exposure
+    int padding;
+};
+
+// FXAA constants, as in FXAA_CS
+const float EDGE_THRESHOLD_MIN = 0.0312;
+const float EDGE_THRESHOLD_MAX = 0.125;
+const float SUBPIXEL_QUALITY = 0.25;
+const int ITERATIONS = 6;
+
+// The edge walk reaches ITERATIONS texels past the pixel
+const int TILE = 32;
+const int APRON = ITERATIONS;
+const int TILE_SIZE = TILE + 2 * APRON;
+
+// Tonemapped colors packed as unorm8, the precision they are stored with anyway
+shared uint tile[TILE_SIZE * TILE_SIZE];
+
+vec3 ACESFilm(vec3 x) {
+    float a = 2.51f;
+    float b = 0.03f;
+    float c = 2.43f;
+    float d = 0.59f;
+    float e = 0.14f;
+    return clamp((x * (a * x + b)) / (x * (c * x + d) + e), 0.0, 1.0);
+}
+
+vec3 Reinhard(vec3 x) {
+    return x / (x + vec3(1.0));
+}
+
+vec3 ExposureTonemap(vec3 x, float exposure) {
+    return vec3(1.0) - exp(-x * exposure);
+}
+
+vec4 Tonemap(vec4 hdrColor) {
+    vec3 color = hdrColor.rgb;
+    switch (tonemapOperator) {
+        case 0:
+        color = ACESFilm(color * exposure);
+        break;
+        case 1:
+        color = Reinhard(color * exposure);
+        break;
+        case 2:
+        color = ExposureTonemap(color, exposure);
+        break;
+    }
+    return vec4(pow(color, vec3(1.0 / gamma)), hdrColor.a);
+}
+
+float GetLuminance(vec3 color) {
+    return sqrt(dot(color, vec3(0.299, 0.587, 0.114)));
+}
+
+// Tonemapped texel at an offset from a tile coordinate
+vec3 Fetch(ivec2 tileCoord, ivec2 offset) {
+    ivec2 p = tileCoord + offset;
+    return unpackUnorm4x8(tile[p.y * TILE_SIZE + p.x]).rgb;
+}
+
+vec4 FXAA(ivec2 tileCoord) {
+    vec4 center = unpackUnorm4x8(tile[tileCoord.y * TILE_SIZE + tileCoord.x]);
+    vec3 rgbM  = center.rgb;
+    vec3 rgbNW = Fetch(tileCoord, ivec2(-1, -1));
+    vec3 rgbNE = Fetch(tileCoord, ivec2(1, -1));
+    vec3 rgbSW = Fetch(tileCoord, ivec2(-1, 1));
+    vec3 rgbSE = Fetch(tileCoord, ivec2(1, 1));
+
+    float lumaNW = GetLuminance(rgbNW);
+    float lumaNE = GetLuminance(rgbNE);
+    float lumaSW = GetLuminance(rgbSW);
+    float lumaSE = GetLuminance(rgbSE);
+    float lumaM  = GetLuminance(rgbM);
+
+    float lumaMin = min(lumaM, min(min(lumaNW, lumaNE), min(lumaSW, lumaSE)));
+    float lumaMax = max(lumaM, max(max(lumaNW, lumaNE), max(lumaSW, lumaSE)));
+    float lumaRange = lumaMax - lumaMin;
+
+    if (lumaRange < max(EDGE_THRESHOLD_MIN, lumaMax * EDGE_THRESHOLD_MAX)) {
+        return vec4(rgbM, 1.0);
+    }
+
+    float lumaL = GetLuminance(Fetch(tileCoord, ivec2(-1, 0)));
+    float lumaR = GetLuminance(Fetch(tileCoord, ivec2(1, 0)));
+    float lumaT = GetLuminance(Fetch(tileCoord, ivec2(0, -1)));
+    float lumaB = GetLuminance(Fetch(tileCoord, ivec2(0, 1)));
+
+    float lumaGradH = abs((lumaNW + lumaNE) - (2.0 * lumaM)) * 2.0 +
+    abs(lumaT - lumaB);
+    float lumaGradV = abs((lumaNW + lumaSW) - (2.0 * lumaM)) * 2.0 +
+    abs(lumaL - lumaR);
+
+    bool isHorizontal = lumaGradH >= lumaGradV;
+    ivec2 stepSize = isHorizontal ? ivec2(1, 0) : ivec2(0, 1);
+
+    float lumaP1 = isHorizontal ? lumaT : lumaL;
+    float lumaP2 = isHorizontal ? lumaB : lumaR;
+    bool is1Steeper = abs(lumaP1 - lumaM) >= abs(lumaP2 - lumaM);
+    int stepDir = is1Steeper ? (lumaP1 > lumaM ? 1 : -1) :
+    (lumaP2 > lumaM ? 1 : -1);
+
+    // FXAA_CS steps whole texels from the pixel center, so its bilinear samples are exact
+    // texel reads and the tile gives the same result
+    vec3 rgbResult = rgbM;
+    ivec2 edgeStep = stepSize * stepDir;
+    for (int i = 0; i < ITERATIONS; i++) {
+        float weight = 1.0 - (float(i) / float(ITERATIONS));
+        vec3 rgbS1 = Fetch(tileCoord, -edgeStep * (i + 1));
+        vec3 rgbS2 = Fetch(tileCoord, edgeStep * (i + 1));
+        rgbResult = mix(rgbResult, (rgbS1 + rgbS2) * 0.5,
+        weight * SUBPIXEL_QUALITY);
+    }
+
+    return vec4(rgbResult, 1.0);
+}
+
+void main() {
+    ivec2 size = imageSize(hdrBuffer);
+    ivec2 tileOrigin = ivec2(gl_WorkGroupID.xy) * TILE - APRON;
+
+    // Load and tonemap the tile; coordinates clamp like the sampler FXAA_CS reads through
+    for (uint i = gl_LocalInvocationIndex; i < TILE_SIZE * TILE_SIZE; i += 256) {
+        ivec2 local = ivec2(i % TILE_SIZE, i / TILE_SIZE);
+        ivec2 coord = clamp(tileOrigin + local, ivec2(0), size - 1);
+        tile[i] = packUnorm4x8(Tonemap(imageLoad(hdrBuffer, coord)));
+    }
+    barrier();
+
+    ivec2 block = ivec2(gl_LocalInvocationID.xy) * 2;
+    for (int y = 0; y < 2; y++) {
+        for (int x = 0; x < 2; x++) {
+            ivec2 offset = block + ivec2(x, y);
+            ivec2 pixelCoord = tileOrigin + APRON + offset;
+            if (any(greaterThanEqual(pixelCoord, size))) {
+                continue;
+            }
+            imageStore(outputBuffer, pixelCoord, FXAA(offset + APRON));
+        }
+    }
+}
+)"";
@@ -1,12 +1,5 @@
 #version 460 core
 
-struct Material {
-    vec3 albedo;
-    float metallic;
-    float roughness;
-    float ao;
-};
-
 struct Sun {
     vec3 direction;
     vec3 color;
@@ -23,20 +16,34 @@ struct PointLight {
     float radius;
 };
 
-in vsOut {
+// Material values come from the vertex stage: uniforms or per-instance data
+in VSOut {
     vec2 texCoord;
     vec3 fragPos;
     vec3 normal;
+    flat vec3 albedo;
+    flat float metallic;
+    flat float roughness;
+    flat float ao;
 } fsIn;
 
 #define MAX_POINT_LIGHTS 100
 #define MAX_SPOT_LIGHTS 100
 #define MAX_AREA_LIGHTS 100
 
+// Must match the blocks in Graphics/UniformBlocks.hpp
+layout (std140, binding = 1) uniform FrameData {
+    mat4 view;
+    mat4 projection;
+    mat4 viewProjection;
+    vec4 cameraPosition;
+} uFrame;
+
+layout (std140, binding = 2) uniform LightingData {
+    Sun uSun;
+};
+
 uniform PointLight uPointLights[MAX_POINT_LIGHTS];
-uniform Sun uSun;
-uniform vec3 uViewPosition;
-uniform Material uMaterial;
 
 uniform samplerCube uIrradianceMap;
 uniform samplerCube uPrefilterMap;
@@ -113,11 +120,11 @@ vec3 CalculateSun(vec3 V, vec3 N, float roughness, vec3 F0) {
     // Calculate energy conservation
     vec3 kS = F;
     vec3 kD = vec3(1.0) - kS;
-    kD *= 1.0 - uMaterial.metallic;
+    kD *= 1.0 - fsIn.metallic;
 
     // Add to outgoing radiance Lo
     float NdotL = max(dot(N, L), 0.0);
-    Lo += (kD * uMaterial.albedo / PI + specular) * radiance * NdotL;// Normalize sun direction to position vector
+    Lo += (kD * fsIn.albedo / PI + specular) * radiance * NdotL;// Normalize sun direction to position vector
 
     return Lo;
 }
@@ -150,28 +157,28 @@ vec3 CalculatePointLight(vec3 V, vec3 N, float roughness, vec3 F0, PointLight li
     // Calculate energy conservation
     vec3 kS = F;
     vec3 kD = vec3(1.0) - kS;
-    kD *= 1.0 - uMaterial.metallic;
+    kD *= 1.0 - fsIn.metallic;
 
     // Add to outgoing radiance Lo
     float NdotL = max(dot(N, L), 0.0);
-    Lo += (kD * uMaterial.albedo / PI + specular) * radiance * NdotL;
+    Lo += (kD * fsIn.albedo / PI + specular) * radiance * NdotL;
 
     return Lo;
 }
 
 void main() {
     vec3 N = normalize(fsIn.normal);
-    vec3 V = normalize(uViewPosition - fsIn.fragPos);
+    vec3 V = normalize(uFrame.cameraPosition.xyz - fsIn.fragPos);
     vec3 R = reflect(-V, N);
 
     float NdotV = max(dot(N, V), 0.0);
-    float roughness = max(0.05, uMaterial.roughness);
+    float roughness = max(0.05, fsIn.roughness);
 
     // Calculate base reflectivity (F0)
     // Dialectrics (non-metals) have F0 of 0.04
     // Metals use their albedo as F0
     vec3 F0 = vec3(0.04);
-    F0 = mix(F0, uMaterial.albedo, uMaterial.metallic);
+    F0 = mix(F0, fsIn.albedo, fsIn.metallic);
 
     // Initialize reflectance
     vec3 Lo = vec3(0.0);
@@ -184,11 +191,11 @@ void main() {
     //    vec3 F = FresnelSchlickRoughness(NdotV, F0, roughness);
     //    vec3 kS = F;
     //    vec3 kD = 1.0 - kS;
-    //    kD *= 1.0 - uMaterial.metallic;
+    //    kD *= 1.0 - fsIn.metallic;
     //
     //    // Diffuse IBL
     //    vec3 irradiance = texture(uIrradianceMap, N).rgb;
-    //    vec3 diffuse = irradiance * uMaterial.albedo;
+    //    vec3 diffuse = irradiance * fsIn.albedo;
     //
     //    // Specular IBL
     //    // Sample both the prefilter map and the BRDF LUT and combine them together
@@ -196,10 +203,10 @@ void main() {
     //    vec2 brdf = texture(uBRDFLUT, vec2(NdotV, roughness)).rg;
     //    vec3 specular = prefilteredColor * (F * brdf.x + brdf.y);
 
-    //    vec3 ambient = (kD * diffuse + specular) * uMaterial.ao;
+    //    vec3 ambient = (kD * diffuse + specular) * fsIn.ao;
     //    vec3 color = ambient + Lo;
 
-    vec3 ambient = uSun.color * 0.01 * uMaterial.albedo * uMaterial.ao;
+    vec3 ambient = uSun.color * 0.01 * fsIn.albedo * fsIn.ao;
     vec3 color = ambient + Lo;
 
     FragColor = vec4(color, 1.0);
@@ -0,0 +1,64 @@
+#version 460 core
+// Graphics::VertexPacked. The position is in [0, 1] within the mesh bounds; the model transform
+// includes the mesh's dequantization. The bitangent is cross(normal, tangent) * (aPos.w * 2 - 1).
+layout (location = 0) in vec4 aPos;
+layout (location = 1) in vec2 aNormal;// Octahedral
+layout (location = 2) in vec2 aTangent;// Octahedral
+layout (location = 4) in vec2 aTexCoord;
+
+// Must match octDecode() in Graphics/VertexPacking.cpp
+vec3 octDecode(vec2 e) {
+    vec3 v = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    float t = max(-v.z, 0.0);
+    v.xy += vec2(v.x >= 0.0 ? -t : t, v.y >= 0.0 ? -t : t);
+    return normalize(v);
+}
+
+// Must match PBRInstanceData in PBRMaterial.hpp
+struct InstanceData {
+    vec4 model[3];// Rows of the 3x4 affine model matrix
+    vec4 normal[3];// Rows of the inverse transpose of the model matrix, xyz only
+    vec4 albedoMetallic;
+    vec4 roughnessAo;
+};
+
+layout (std430, binding = 0) readonly buffer Instances {
+    InstanceData instances[];
+};
+
+// Must match FrameBlock in Graphics/UniformBlocks.hpp
+layout (std140, binding = 1) uniform FrameData {
+    mat4 view;
+    mat4 projection;
+    mat4 viewProjection;
+    vec4 cameraPosition;
+} uFrame;
+
+out VSOut {
+    vec2 texCoord;
+    vec3 fragPos;
+    vec3 normal;
+    flat vec3 albedo;
+    flat float metallic;
+    flat float roughness;
+    flat float ao;
+} vsOut;
+
+void main() {
+    InstanceData instance = instances[gl_BaseInstance + gl_InstanceID];
+    vec4 position = vec4(aPos.xyz, 1.0);
+    vec3 normal = octDecode(aNormal);
+
+    vsOut.fragPos = vec3(dot(instance.model[0], position),
+                         dot(instance.model[1], position),
+                         dot(instance.model[2], position));
+    vsOut.normal = normalize(vec3(dot(instance.normal[0].xyz, normal),
+                                  dot(instance.normal[1].xyz, normal),
+                                  dot(instance.normal[2].xyz, normal)));
+    vsOut.texCoord = aTexCoord;
+    vsOut.albedo = instance.albedoMetallic.rgb;
+    vsOut.metallic = instance.albedoMetallic.a;
+    vsOut.roughness = instance.roughnessAo.x;
+    vsOut.ao = instance.roughnessAo.y;
+    gl_Position = uFrame.viewProjection * vec4(vsOut.fragPos, 1.0);
+}
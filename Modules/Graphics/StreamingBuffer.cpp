@@ -0,0 +1,109 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "StreamingBuffer.hpp"
+#include "RenderStats.hpp"
+
+#include <algorithm>
+
+namespace x::Graphics {
+    static size_t alignUp(size_t value, size_t alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    StreamingBuffer::StreamingBuffer(IStreamingBufferBackend& backend, size_t regionSize)
+        : _backend(backend) {
+        _alignment = std::max<size_t>(16, _backend.getAlignment());
+        create(alignUp(regionSize, _alignment));
+    }
+
+    StreamingBuffer::~StreamingBuffer() {
+        deleteFences();
+        _backend.destroyBuffer(_id);
+        // GL keeps the storage alive until draws already submitted against it complete
+        for (const auto& retired : _retired) {
+            if (retired.fence) { _backend.deleteFence(retired.fence); }
+            _backend.destroyBuffer(retired.id);
+        }
+    }
+
+    void StreamingBuffer::beginFrame() {
+        // Everything written to the current region has been submitted by now, and so has
+        // everything that read the buffers outgrown last frame
+        if (_head > 0) { _fences[_region] = _backend.createFence(); }
+        for (auto& retired : _retired) {
+            if (!retired.fence) { retired.fence = _backend.createFence(); }
+        }
+        releaseRetired();
+
+        _region = (_region + 1) % kRegionCount;
+        _head   = 0;
+        if (auto& fence = _fences[_region]) {
+            _backend.waitFence(fence);
+            _backend.deleteFence(fence);
+            fence = nullptr;
+        }
+    }
+
+    StreamingBuffer::Allocation StreamingBuffer::allocate(size_t size) {
+        size = alignUp(std::max<size_t>(size, 1), _alignment);
+        if (_head + size > _regionSize) { grow(size); }
+
+        Allocation allocation;
+        allocation.offset = _region * _regionSize + _head;
+        allocation.data   = _mapped + allocation.offset;
+        allocation.buffer = _id;
+        allocation.size   = size;
+        _head += size;
+        // The caller writes it straight into the mapping, which is as good as uploaded
+        RenderStats::current().recordUpload(size);
+        return allocation;
+    }
+
+    size_t StreamingBuffer::getRegionSize() const {
+        return _regionSize;
+    }
+
+    size_t StreamingBuffer::getUsed() const {
+        return _head;
+    }
+
+    size_t StreamingBuffer::getRetiredCount() const {
+        return _retired.size();
+    }
+
+    void StreamingBuffer::create(size_t regionSize) {
+        _regionSize = regionSize;
+        _region     = 0;
+        _head       = 0;
+        _id         = _backend.createBuffer(_regionSize * kRegionCount, _mapped);
+    }
+
+    void StreamingBuffer::grow(size_t minimumSize) {
+        // Deleting the buffer would unbind it from every binding point it still backs this
+        // frame, so it is retired instead. Its region fences are covered by the retirement
+        // fence, which is issued later.
+        const size_t regionSize =
+          alignUp(std::max(_regionSize * 2, _head + minimumSize), _alignment);
+        deleteFences();
+        _retired.push_back({_id, nullptr});
+        create(regionSize);
+    }
+
+    void StreamingBuffer::releaseRetired() {
+        std::erase_if(_retired, [&](const RetiredBuffer& retired) {
+            if (!retired.fence || !_backend.isSignaled(retired.fence)) { return false; }
+            _backend.deleteFence(retired.fence);
+            _backend.destroyBuffer(retired.id);
+            return true;
+        });
+    }
+
+    void StreamingBuffer::deleteFences() {
+        for (auto& fence : _fences) {
+            if (fence) { _backend.deleteFence(fence); }
+            fence = nullptr;
+        }
+    }
+}  // namespace x::Graphics
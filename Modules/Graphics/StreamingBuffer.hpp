@@ -0,0 +1,105 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+
+#include <array>
+#include <cstring>
+#include <vector>
+
+namespace x::Graphics {
+    /// @brief Creates, maps and fences the buffers behind a StreamingBuffer.
+    class IStreamingBufferBackend {
+    public:
+        using Fence = void*;
+
+        virtual ~IStreamingBufferBackend() = default;
+
+        /// @brief Alignment every allocation's offset must have to be bound as a range
+        virtual size_t getAlignment() = 0;
+        /// @brief Creates a persistently mapped, write-only buffer and returns its id
+        virtual u32 createBuffer(size_t size, u8*& mapped) = 0;
+        /// @brief Unmaps and deletes the buffer
+        virtual void destroyBuffer(u32 buffer) = 0;
+
+        /// @brief Signals once every command submitted so far has completed
+        virtual Fence createFence()           = 0;
+        virtual bool isSignaled(Fence fence)  = 0;
+        virtual void waitFence(Fence fence)   = 0;
+        virtual void deleteFence(Fence fence) = 0;
+    };
+
+    /// @brief Persistently mapped ring buffer for data rewritten every frame (per draw uniforms,
+    /// instance data, particles).
+    ///
+    /// The storage is split into kRegionCount regions and each frame sub-allocates from one of
+    /// them. beginFrame() fences the region just written and moves on to the next, waiting only
+    /// if the GPU is still reading that region from kRegionCount frames ago. Writes go straight
+    /// into the mapping, so there are no glBufferSubData calls and no driver copies.
+    ///
+    /// If a frame outgrows its region, later allocations move to a new buffer with larger
+    /// regions. The old buffer stays alive and mapped until the frame that used it is fenced
+    /// and the fence signals, so ranges bound and pointers handed out earlier in the frame stay
+    /// valid.
+    class StreamingBuffer {
+    public:
+        static constexpr u32 kRegionCount = 3;
+
+        struct Allocation {
+            void* data    = nullptr;
+            u32 buffer    = 0;
+            size_t offset = 0;
+            size_t size   = 0;
+        };
+
+        /// @brief backend must outlive the buffer
+        StreamingBuffer(IStreamingBufferBackend& backend, size_t regionSize);
+        ~StreamingBuffer();
+
+        StreamingBuffer(const StreamingBuffer&)            = delete;
+        StreamingBuffer& operator=(const StreamingBuffer&) = delete;
+
+        /// @brief Call once per frame before the first allocation
+        void beginFrame();
+
+        /// @brief Allocates size bytes aligned for binding as a uniform or shader storage range
+        Allocation allocate(size_t size);
+
+        template<typename T>
+        Allocation write(const T& value) {
+            const auto allocation = allocate(sizeof(T));
+            std::memcpy(allocation.data, &value, sizeof(T));
+            return allocation;
+        }
+
+        [[nodiscard]] size_t getRegionSize() const;
+        /// @brief Bytes allocated so far this frame
+        [[nodiscard]] size_t getUsed() const;
+        /// @brief Buffers outgrown but possibly still read by the GPU
+        [[nodiscard]] size_t getRetiredCount() const;
+
+    private:
+        struct RetiredBuffer {
+            u32 id;
+            IStreamingBufferBackend::Fence fence;  // Null until the frame using it is fenced
+        };
+
+        IStreamingBufferBackend& _backend;
+        u32 _id        = 0;
+        u8* _mapped    = nullptr;
+        size_t _regionSize;
+        size_t _alignment;
+        u32 _region    = 0;
+        size_t _head   = 0;
+        std::array<IStreamingBufferBackend::Fence, kRegionCount> _fences {};
+        std::vector<RetiredBuffer> _retired;
+
+        void create(size_t regionSize);
+        void grow(size_t minimumSize);
+        void releaseRetired();
+        void deleteFences();
+    };
+}  // namespace x::Graphics
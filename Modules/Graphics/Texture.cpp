@@ -6,6 +6,7 @@
 #include "Panic.hpp"
 #include "Texture.hpp"
 #include "DebugOpenGL.hpp"
+#include "GLState.hpp"
 
 namespace x::Graphics {
     bool Texture::loadFromFile(const str& filename, bool flipVertically) {
@@ -27,6 +28,8 @@ namespace x::Graphics {
 
         glGenTextures(1, &_textureId);
         glBindTexture(_target, _textureId);
+        // Bound through the active unit, behind the state tracker's back
+        GLState::current().invalidateTextures();
         if (CHECK_GL_ERROR()) {
             stbi_image_free(data);
             return false;
@@ -46,6 +49,7 @@ namespace x::Graphics {
 
             glGenTextures(1, &_textureId);
             glBindTexture(GL_TEXTURE_CUBE_MAP, _textureId);
+            GLState::current().invalidateTextures();
             for (int i = 0; i < faces.size(); i++) {
                 const auto& face = faces[i];
                 glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i,
@@ -108,6 +112,8 @@ namespace x::Graphics {
 
         glGenTextures(1, &_textureId);
         glBindTexture(_target, _textureId);
+        // Bound through the active unit, behind the state tracker's back
+        GLState::current().invalidateTextures();
         if (CHECK_GL_ERROR()) { return false; }
 
         glTexImage2D(_target,
@@ -137,6 +143,7 @@ namespace x::Graphics {
         if (_target == GL_TEXTURE_CUBE_MAP) {
             glGenTextures(1, &_textureId);
             glBindTexture(GL_TEXTURE_CUBE_MAP, _textureId);
+            GLState::current().invalidateTextures();
             for (int i = 0; i < 6; i++) {
                 glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i,
                              0,
@@ -163,6 +170,8 @@ namespace x::Graphics {
 
         glGenTextures(1, &_textureId);
         glBindTexture(_target, _textureId);
+        // Bound through the active unit, behind the state tracker's back
+        GLState::current().invalidateTextures();
         if (CHECK_GL_ERROR()) {
             glDeleteTextures(1, &_textureId);
             return false;
@@ -222,14 +231,13 @@ namespace x::Graphics {
     }
 
     void Texture::bind(u32 slot) const {
-        glActiveTexture(GL_TEXTURE0 + slot);
-        glBindTexture(_target, _textureId);
-        CHECK_GL_ERROR();
+        GLState::current().bindTexture(slot, _textureId);
     }
 
     void Texture::unbind() const {
         glBindTexture(_target, 0);
         CHECK_GL_ERROR();
+        GLState::current().invalidateTextures();
     }
 
     void Texture::bindImage(u32 unit, GLenum access, GLenum format) const {
@@ -237,16 +245,14 @@ namespace x::Graphics {
     }
 
     void Texture::setWrapMode(GLenum mode) const {
-        glBindTexture(_target, _textureId);
-        glTexParameteri(_target, GL_TEXTURE_WRAP_S, mode);
-        glTexParameteri(_target, GL_TEXTURE_WRAP_T, mode);
+        glTextureParameteri(_textureId, GL_TEXTURE_WRAP_S, mode);
+        glTextureParameteri(_textureId, GL_TEXTURE_WRAP_T, mode);
         CHECK_GL_ERROR();
     }
 
     void Texture::setFilterMode(GLenum min, GLenum mag) const {
-        glBindTexture(_target, _textureId);
-        glTexParameteri(_target, GL_TEXTURE_MIN_FILTER, min);
-        glTexParameteri(_target, GL_TEXTURE_MAG_FILTER, mag);
+        glTextureParameteri(_textureId, GL_TEXTURE_MIN_FILTER, min);
+        glTextureParameteri(_textureId, GL_TEXTURE_MAG_FILTER, mag);
         CHECK_GL_ERROR();
     }
 
@@ -254,6 +260,7 @@ namespace x::Graphics {
         _width  = width;
         _height = height;
         glBindTexture(_target, _textureId);
+        GLState::current().invalidateTextures();
         glTexImage2D(_target,
                      0,
                      _internalFormat,
@@ -397,6 +404,7 @@ namespace x::Graphics {
         if (_textureId) {
             glDeleteTextures(1, &_textureId);
             CHECK_GL_ERROR();
+            GLState::current().forgetTexture(_textureId);
             _textureId = 0;
         }
     }
@@ -0,0 +1,43 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include <glm/glm.hpp>
+
+namespace x::Graphics {
+    /// @brief Uniform buffer binding points shared by every shader. Binding 0 holds the
+    /// Tonemapper's parameters.
+    namespace UniformBinding {
+        constexpr u32 Frame    = 1;  // FrameBlock, uploaded once per frame
+        constexpr u32 Lighting = 2;  // LightingBlock, uploaded once per frame
+        constexpr u32 Object   = 3;  // ObjectBlock, uploaded per draw
+    }  // namespace UniformBinding
+
+    // std140 mirrors of the uniform blocks declared in Shaders/Source
+
+    struct FrameBlock {
+        glm::mat4 view;
+        glm::mat4 projection;
+        glm::mat4 viewProjection;
+        glm::vec4 cameraPosition;  // xyz
+    };
+
+    struct LightingBlock {
+        glm::vec3 sunDirection;
+        f32 padding;
+        glm::vec3 sunColor;
+        f32 sunIntensity;
+    };
+
+    struct ObjectBlock {
+        glm::mat4 model;
+        glm::vec4 normalMatrix[3];  // mat3 columns are padded to vec4 in std140
+    };
+
+    static_assert(sizeof(FrameBlock) == 208);
+    static_assert(sizeof(LightingBlock) == 32);
+    static_assert(sizeof(ObjectBlock) == 112);
+}  // namespace x::Graphics
@@ -0,0 +1,40 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+
+#include <string_view>
+
+namespace x::Graphics {
+    /// @brief Handle to a uniform, the 64-bit FNV-1a hash of its name.
+    ///
+    /// String literals are hashed at compile time, so setUniform("uMaterial.albedo", ...) does no
+    /// string work at runtime. Runtime strings are hashed on the spot. ShaderProgram resolves the
+    /// hash to a location through the table it reflects at link time.
+    class UniformId {
+    public:
+        consteval UniformId(const char* name) : _hash(hash(name)) {}
+        UniformId(const str& name) : _hash(hash(name)) {}
+
+        static constexpr u64 hash(std::string_view name) {
+            u64 result = 0xcbf29ce484222325ull;
+            for (const char c : name) {
+                result ^= CAST<u8>(c);
+                result *= 0x100000001b3ull;
+            }
+            return result;
+        }
+
+        [[nodiscard]] constexpr u64 value() const {
+            return _hash;
+        }
+
+        constexpr bool operator==(const UniformId& other) const = default;
+
+    private:
+        u64 _hash;
+    };
+}  // namespace x::Graphics
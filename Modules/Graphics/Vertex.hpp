@@ -20,6 +20,16 @@ namespace x::Graphics {
         glm::vec2 texCoords;
     };
 
+    /// @brief 20 byte form of VertexPosNormTanBiTanTex, see VertexPacking.hpp
+    struct VertexPacked {
+        u16 position[4];   // xyz: unorm16 within the mesh bounds, w: bitangent sign (0 or 65535)
+        i16 normal[2];     // Octahedral, snorm16
+        i16 tangent[2];    // Octahedral, snorm16
+        u16 texCoords[2];  // Half float
+    };
+
+    static_assert(sizeof(VertexPacked) == 20, "VertexPacked must stay 20 bytes");
+
     struct VertexPosNormTex {
         glm::vec3 position;
         glm::vec3 normal;
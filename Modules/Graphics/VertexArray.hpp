@@ -11,6 +11,7 @@
 #include "Memory/GpuBuffer.hpp"
 #include "VertexAttribute.hpp"
 #include "DebugOpenGL.hpp"
+#include "GLState.hpp"
 
 #include <vector>
 
@@ -31,6 +32,9 @@ namespace x::Graphics {
         void bindVertexBuffer() const;
         void bindIndexBuffer() const;
 
+        [[nodiscard]] u32 getId() const;
+        [[nodiscard]] u32 getIndexBufferId() const;
+
         static void unbind();
         static void unbindVertexBuffer();
         static void unbindIndexBuffer();
@@ -48,11 +52,14 @@ namespace x::Graphics {
     VertexArray<V, I>::VertexArray(const std::vector<VertexAttribute>& attributes,
                                    const std::vector<V>& vertices,
                                    const std::vector<I>& indices) {
-        _attributes   = attributes;
-        _vertexBuffer = std::make_unique<Memory::GpuBuffer<V, Memory::Vertex>>(vertices);
-        _indexBuffer  = std::make_unique<Memory::GpuBuffer<I, Memory::Index>>(indices);
+        _attributes = attributes;
         glGenVertexArrays(1, &_vao);
         CHECK_GL_ERROR();
+        // Bind first so the index buffer is captured in the vertex array's state; drawing then
+        // only needs bind()
+        bind();
+        _vertexBuffer = std::make_unique<Memory::GpuBuffer<V, Memory::Vertex>>(vertices);
+        _indexBuffer  = std::make_unique<Memory::GpuBuffer<I, Memory::Index>>(indices);
         for (const auto& attribute : _attributes) {
             enableAttribute(attribute);
         }
@@ -65,8 +72,7 @@ namespace x::Graphics {
 
     template<typename V, typename I>
     void VertexArray<V, I>::bind() const {
-        glBindVertexArray(_vao);
-        CHECK_GL_ERROR();
+        GLState::current().bindVertexArray(_vao);
     }
 
     template<typename V, typename I>
@@ -95,6 +101,7 @@ namespace x::Graphics {
     void VertexArray<V, I>::cleanup() {
         glDeleteVertexArrays(1, &_vao);
         CHECK_GL_ERROR();
+        GLState::current().forgetVertexArray(_vao);
         _cleanedUp = true;
     }
 
@@ -108,21 +115,29 @@ namespace x::Graphics {
         _indexBuffer->bind();
     }
 
+    template<typename V, typename I>
+    u32 VertexArray<V, I>::getId() const {
+        return _vao;
+    }
+
+    template<typename V, typename I>
+    u32 VertexArray<V, I>::getIndexBufferId() const {
+        return _indexBuffer->getId();
+    }
+
     template<typename V, typename I>
     void VertexArray<V, I>::unbind() {
-        glBindVertexArray(0);
+        GLState::current().bindVertexArray(0);
     }
 
     template<typename V, typename I>
     void VertexArray<V, I>::unbindVertexBuffer() {
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
-        CHECK_GL_ERROR();
+        GLState::current().bindBuffer(GL_ARRAY_BUFFER, 0);
     }
 
     template<typename V, typename I>
     void VertexArray<V, I>::unbindIndexBuffer() {
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-        CHECK_GL_ERROR();
+        GLState::current().bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
     }
 
     template<typename V, typename I>
@@ -43,5 +43,14 @@ namespace x::Graphics {
           {3, 3, GL_FLOAT, GL_FALSE, 14 * sizeof(f32), (void*)(9 * sizeof(f32))},
           {4, 2, GL_FLOAT, GL_FALSE, 14 * sizeof(f32), (void*)(12 * sizeof(f32))},
         };
+
+        // VertexPacked; location 3 (bitangent) is rebuilt from the normal, tangent and the sign
+        // stored in the position's w
+        static std::vector<VertexAttribute> VertexPackedPosition4_Normal2_Tangent2_Tex2 = {
+          {0, 4, GL_UNSIGNED_SHORT, GL_TRUE, 10 * sizeof(u16), (void*)0},
+          {1, 2, GL_SHORT, GL_TRUE, 10 * sizeof(u16), (void*)(4 * sizeof(u16))},
+          {2, 2, GL_SHORT, GL_TRUE, 10 * sizeof(u16), (void*)(6 * sizeof(u16))},
+          {4, 2, GL_HALF_FLOAT, GL_FALSE, 10 * sizeof(u16), (void*)(8 * sizeof(u16))},
+        };
     }  // namespace VertexAttributes
 }  // namespace x::Graphics
\ No newline at end of file
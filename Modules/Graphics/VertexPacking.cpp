@@ -0,0 +1,143 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "VertexPacking.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace x::Graphics {
+    namespace {
+        f32 signNotZero(f32 value) {
+            return value >= 0.f ? 1.f : -1.f;
+        }
+
+        i16 toSnorm16(f32 value) {
+            return CAST<i16>(std::round(std::clamp(value, -1.f, 1.f) * 32767.f));
+        }
+
+        // Matches GL's normalized fixed point conversion
+        f32 fromSnorm16(i16 value) {
+            return std::max(CAST<f32>(value) / 32767.f, -1.f);
+        }
+
+        u16 toUnorm16(f32 value) {
+            return CAST<u16>(std::round(std::clamp(value, 0.f, 1.f) * 65535.f));
+        }
+
+        f32 fromUnorm16(u16 value) {
+            return CAST<f32>(value) / 65535.f;
+        }
+    }  // namespace
+
+    glm::vec2 octEncode(const glm::vec3& direction) {
+        const f32 l1 = std::abs(direction.x) + std::abs(direction.y) + std::abs(direction.z);
+        if (l1 <= 0.f) { return glm::vec2(0.f); }
+        glm::vec2 p(direction.x / l1, direction.y / l1);
+        // The lower hemisphere is folded over the diagonals onto the corners of the square
+        if (direction.z < 0.f) {
+            p = glm::vec2((1.f - std::abs(p.y)) * signNotZero(p.x),
+                          (1.f - std::abs(p.x)) * signNotZero(p.y));
+        }
+        return p;
+    }
+
+    glm::vec3 octDecode(const glm::vec2& encoded) {
+        glm::vec3 v(encoded.x, encoded.y, 1.f - std::abs(encoded.x) - std::abs(encoded.y));
+        const f32 t = std::max(-v.z, 0.f);
+        v.x += v.x >= 0.f ? -t : t;
+        v.y += v.y >= 0.f ? -t : t;
+        return glm::normalize(v);
+    }
+
+    u16 floatToHalf(f32 value) {
+        const u32 bits     = std::bit_cast<u32>(value);
+        const u32 sign     = (bits >> 16) & 0x8000;
+        const u32 biased   = (bits >> 23) & 0xFF;
+        u32 mantissa       = bits & 0x7FFFFF;
+        const i32 exponent = CAST<i32>(biased) - 127 + 15;
+
+        if (biased == 0xFF) { return CAST<u16>(sign | 0x7C00 | (mantissa ? 0x200 : 0)); }
+        if (exponent >= 31) { return CAST<u16>(sign | 0x7C00); }
+        if (exponent <= 0) {
+            // Subnormal half, or zero once the value is below half the smallest subnormal
+            if (exponent < -10) { return CAST<u16>(sign); }
+            mantissa |= 0x800000;
+            const u32 shift = CAST<u32>(14 - exponent);
+            u32 half        = mantissa >> shift;
+            if ((mantissa >> (shift - 1)) & 1) { half++; }
+            return CAST<u16>(sign | half);
+        }
+
+        // Rounding may carry into the exponent, which is still the correctly rounded value
+        u32 half = sign | (CAST<u32>(exponent) << 10) | (mantissa >> 13);
+        if (mantissa & 0x1000) { half++; }
+        return CAST<u16>(half);
+    }
+
+    f32 halfToFloat(u16 value) {
+        const u32 sign     = CAST<u32>(value & 0x8000) << 16;
+        const u32 exponent = (value >> 10) & 0x1F;
+        const u32 mantissa = value & 0x3FF;
+
+        if (exponent == 0) {
+            const f32 magnitude = std::ldexp(CAST<f32>(mantissa), -24);
+            return sign ? -magnitude : magnitude;
+        }
+        if (exponent == 31) { return std::bit_cast<f32>(sign | 0x7F800000 | (mantissa << 13)); }
+        return std::bit_cast<f32>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+    }
+
+    Math::AffineTransform packVertices(std::span<const VertexPosNormTanBiTanTex> vertices,
+                                       const Math::AABB& bounds,
+                                       std::vector<VertexPacked>& packed) {
+        const glm::vec3 origin = vertices.empty() ? glm::vec3(0.f) : bounds.min;
+        const glm::vec3 extent = vertices.empty() ? glm::vec3(0.f) : bounds.max - bounds.min;
+        const f32 scale        = std::max({extent.x, extent.y, extent.z, 1e-6f});
+
+        packed.clear();
+        packed.reserve(vertices.size());
+        for (const auto& vertex : vertices) {
+            const glm::vec3 position = (vertex.position - origin) / scale;
+            const glm::vec2 normal   = octEncode(vertex.normal);
+            const glm::vec2 tangent  = octEncode(vertex.tangent);
+            // Mirrored UVs flip the bitangent; that handedness is all it adds to the frame
+            const bool flipped =
+              glm::dot(glm::cross(vertex.normal, vertex.tangent), vertex.biTangent) < 0.f;
+
+            VertexPacked& out = packed.emplace_back();
+            out.position[0]   = toUnorm16(position.x);
+            out.position[1]   = toUnorm16(position.y);
+            out.position[2]   = toUnorm16(position.z);
+            out.position[3]   = flipped ? 0 : 65535;
+            out.normal[0]     = toSnorm16(normal.x);
+            out.normal[1]     = toSnorm16(normal.y);
+            out.tangent[0]    = toSnorm16(tangent.x);
+            out.tangent[1]    = toSnorm16(tangent.y);
+            out.texCoords[0]  = floatToHalf(vertex.texCoords.x);
+            out.texCoords[1]  = floatToHalf(vertex.texCoords.y);
+        }
+
+        Math::AffineTransform dequantize;
+        dequantize.rows[0] = glm::vec4(scale, 0.f, 0.f, origin.x);
+        dequantize.rows[1] = glm::vec4(0.f, scale, 0.f, origin.y);
+        dequantize.rows[2] = glm::vec4(0.f, 0.f, scale, origin.z);
+        return dequantize;
+    }
+
+    VertexPosNormTanBiTanTex unpackVertex(const VertexPacked& vertex,
+                                          const Math::AffineTransform& dequantize) {
+        VertexPosNormTanBiTanTex out;
+        out.position  = dequantize.transformPoint(glm::vec3(fromUnorm16(vertex.position[0]),
+                                                           fromUnorm16(vertex.position[1]),
+                                                           fromUnorm16(vertex.position[2])));
+        out.normal    = octDecode({fromSnorm16(vertex.normal[0]), fromSnorm16(vertex.normal[1])});
+        out.tangent   = octDecode({fromSnorm16(vertex.tangent[0]), fromSnorm16(vertex.tangent[1])});
+        out.biTangent = glm::cross(out.normal, out.tangent) *
+                        (fromUnorm16(vertex.position[3]) * 2.f - 1.f);
+        out.texCoords = {halfToFloat(vertex.texCoords[0]), halfToFloat(vertex.texCoords[1])};
+        return out;
+    }
+}  // namespace x::Graphics
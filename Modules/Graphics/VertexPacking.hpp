@@ -0,0 +1,36 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "Vertex.hpp"
+#include "Math/AffineTransform.hpp"
+#include "Math/Bounds.hpp"
+
+#include <span>
+#include <vector>
+
+namespace x::Graphics {
+    /// @brief Maps a unit vector onto the [-1, 1] square of an octahedron unfolded around +z.
+    [[nodiscard]] glm::vec2 octEncode(const glm::vec3& direction);
+    [[nodiscard]] glm::vec3 octDecode(const glm::vec2& encoded);
+
+    [[nodiscard]] u16 floatToHalf(f32 value);
+    [[nodiscard]] f32 halfToFloat(u16 value);
+
+    /// @brief Quantizes vertices into VertexPacked.
+    ///
+    /// Positions are stored as unorm16 offsets from bounds.min, scaled by the longest side of
+    /// bounds so the mapping stays uniform and normals need no correction. The returned transform
+    /// turns stored positions (as the GPU reads them, in [0, 1]) back into model space; it is
+    /// meant to be folded into the draw transform. UVs become half floats, so heavily tiled
+    /// coordinates lose precision away from zero.
+    Math::AffineTransform packVertices(std::span<const VertexPosNormTanBiTanTex> vertices,
+                                       const Math::AABB& bounds,
+                                       std::vector<VertexPacked>& packed);
+    /// @brief Reverses packVertices for one vertex, the same way PBR_VS.glsl does.
+    [[nodiscard]] VertexPosNormTanBiTanTex unpackVertex(const VertexPacked& vertex,
+                                                        const Math::AffineTransform& dequantize);
+}  // namespace x::Graphics
@@ -0,0 +1,149 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "AffineTransform.hpp"
+
+#include <cmath>
+
+namespace x::Math {
+    AffineTransform AffineTransform::identity() {
+        return {{
+          glm::vec4(1.f, 0.f, 0.f, 0.f),
+          glm::vec4(0.f, 1.f, 0.f, 0.f),
+          glm::vec4(0.f, 0.f, 1.f, 0.f),
+        }};
+    }
+
+    AffineTransform AffineTransform::fromMat4(const glm::mat4& matrix) {
+        // glm is column-major, so row i is gathered from element i of each column
+        AffineTransform result;
+        for (i32 i = 0; i < 3; i++) {
+            result.rows[i] = glm::vec4(matrix[0][i], matrix[1][i], matrix[2][i], matrix[3][i]);
+        }
+        return result;
+    }
+
+    AffineTransform AffineTransform::fromTRS(const glm::vec3& translation,
+                                             const glm::vec3& eulerDegrees,
+                                             const glm::vec3& scale) {
+        const f32 a  = glm::radians(eulerDegrees.x);
+        const f32 b  = glm::radians(eulerDegrees.y);
+        const f32 c  = glm::radians(eulerDegrees.z);
+        const f32 sa = std::sin(a), ca = std::cos(a);
+        const f32 sb = std::sin(b), cb = std::cos(b);
+        const f32 sc = std::sin(c), cc = std::cos(c);
+
+        // Closed form of Rx * Ry * Rz, with each column multiplied by the matching scale axis
+        return {{
+          glm::vec4(cb * cc * scale.x, -cb * sc * scale.y, sb * scale.z, translation.x),
+          glm::vec4((ca * sc + sa * sb * cc) * scale.x,
+                    (ca * cc - sa * sb * sc) * scale.y,
+                    -sa * cb * scale.z,
+                    translation.y),
+          glm::vec4((sa * sc - ca * sb * cc) * scale.x,
+                    (sa * cc + ca * sb * sc) * scale.y,
+                    ca * cb * scale.z,
+                    translation.z),
+        }};
+    }
+
+    glm::mat4 AffineTransform::toMat4() const {
+        return {
+          glm::vec4(rows[0].x, rows[1].x, rows[2].x, 0.f),
+          glm::vec4(rows[0].y, rows[1].y, rows[2].y, 0.f),
+          glm::vec4(rows[0].z, rows[1].z, rows[2].z, 0.f),
+          glm::vec4(rows[0].w, rows[1].w, rows[2].w, 1.f),
+        };
+    }
+
+    glm::vec3 AffineTransform::getTranslation() const {
+        return {rows[0].w, rows[1].w, rows[2].w};
+    }
+
+    glm::vec3 AffineTransform::transformPoint(const glm::vec3& point) const {
+        const glm::vec4 p(point, 1.f);
+        return {glm::dot(rows[0], p), glm::dot(rows[1], p), glm::dot(rows[2], p)};
+    }
+
+    glm::vec3 AffineTransform::transformVector(const glm::vec3& vector) const {
+        const glm::vec4 v(vector, 0.f);
+        return {glm::dot(rows[0], v), glm::dot(rows[1], v), glm::dot(rows[2], v)};
+    }
+
+    AffineTransform multiply(const AffineTransform& a, const AffineTransform& b) {
+        AffineTransform result;
+        for (i32 i = 0; i < 3; i++) {
+            const auto& row = a.rows[i];
+            result.rows[i]  = row.x * b.rows[0] + row.y * b.rows[1] + row.z * b.rows[2];
+            result.rows[i].w += row.w;
+        }
+        return result;
+    }
+
+    AffineTransform inverse(const AffineTransform& transform) {
+        const auto& r = transform.rows;
+
+        // Inverse of the linear 3x3 part via cofactors
+        const glm::vec3 c0(r[1].y * r[2].z - r[1].z * r[2].y,
+                           r[0].z * r[2].y - r[0].y * r[2].z,
+                           r[0].y * r[1].z - r[0].z * r[1].y);
+        const glm::vec3 c1(r[1].z * r[2].x - r[1].x * r[2].z,
+                           r[0].x * r[2].z - r[0].z * r[2].x,
+                           r[0].z * r[1].x - r[0].x * r[1].z);
+        const glm::vec3 c2(r[1].x * r[2].y - r[1].y * r[2].x,
+                           r[0].y * r[2].x - r[0].x * r[2].y,
+                           r[0].x * r[1].y - r[0].y * r[1].x);
+        const f32 det = r[0].x * c0.x + r[0].y * c1.x + r[0].z * c2.x;
+        if (std::abs(det) < 1e-12f) { return AffineTransform::identity(); }
+        const f32 invDet = 1.f / det;
+
+        AffineTransform result;
+        result.rows[0] = glm::vec4(c0.x, c0.y, c0.z, 0.f) * invDet;
+        result.rows[1] = glm::vec4(c1.x, c1.y, c1.z, 0.f) * invDet;
+        result.rows[2] = glm::vec4(c2.x, c2.y, c2.z, 0.f) * invDet;
+
+        // Translation becomes -(L^-1 * t)
+        const glm::vec3 t = transform.getTranslation();
+        for (auto& row : result.rows) {
+            row.w = -(row.x * t.x + row.y * t.y + row.z * t.z);
+        }
+        return result;
+    }
+
+    void decompose(const AffineTransform& transform,
+                   glm::vec3& translation,
+                   glm::vec3& eulerDegrees,
+                   glm::vec3& scale) {
+        const auto& r = transform.rows;
+        translation   = transform.getTranslation();
+
+        // Scale is the length of each column of the linear part
+        scale = glm::vec3(glm::length(glm::vec3(r[0].x, r[1].x, r[2].x)),
+                          glm::length(glm::vec3(r[0].y, r[1].y, r[2].y)),
+                          glm::length(glm::vec3(r[0].z, r[1].z, r[2].z)));
+
+        const auto safeScale = [](f32 s) { return s != 0.f ? s : 1.f; };
+        const f32 sx         = safeScale(scale.x);
+        const f32 sy         = safeScale(scale.y);
+        const f32 sz         = safeScale(scale.z);
+
+        // Pure rotation element (row, column)
+        const auto rot = [&](i32 row, i32 col) {
+            const f32 divisor = col == 0 ? sx : col == 1 ? sy : sz;
+            return r[row][col] / divisor;
+        };
+
+        // Inverse of the closed form used in fromTRS (R = Rx * Ry * Rz)
+        const f32 sinY = glm::clamp(rot(0, 2), -1.f, 1.f);
+        eulerDegrees.y = glm::degrees(std::asin(sinY));
+        if (std::abs(sinY) < 0.9999f) {
+            eulerDegrees.x = glm::degrees(std::atan2(-rot(1, 2), rot(2, 2)));
+            eulerDegrees.z = glm::degrees(std::atan2(-rot(0, 1), rot(0, 0)));
+        } else {
+            // Gimbal lock, roll folds into pitch
+            eulerDegrees.x = glm::degrees(std::atan2(rot(2, 1), rot(1, 1)));
+            eulerDegrees.z = 0.f;
+        }
+    }
+}  // namespace x::Math
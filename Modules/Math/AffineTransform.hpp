@@ -0,0 +1,49 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include <glm/glm.hpp>
+
+namespace x::Math {
+    /// @brief Compact affine transform stored as a 3x4 row-major matrix (48 bytes).
+    ///
+    /// The bottom row of an affine matrix is always (0, 0, 0, 1), so it is left implicit. Each
+    /// stored row holds the linear part in xyz and the translation component in w. Use toMat4()
+    /// only where a full matrix is actually required (i.e. uploading to the GPU).
+    struct AffineTransform {
+        glm::vec4 rows[3];
+
+        static AffineTransform identity();
+        static AffineTransform fromMat4(const glm::mat4& matrix);
+        /// @brief Builds translation * rotation * scale, with rotation given as XYZ euler angles
+        /// in degrees (same convention as TransformComponent).
+        static AffineTransform fromTRS(const glm::vec3& translation,
+                                       const glm::vec3& eulerDegrees,
+                                       const glm::vec3& scale);
+
+        [[nodiscard]] glm::mat4 toMat4() const;
+        [[nodiscard]] glm::vec3 getTranslation() const;
+        [[nodiscard]] glm::vec3 transformPoint(const glm::vec3& point) const;
+        [[nodiscard]] glm::vec3 transformVector(const glm::vec3& vector) const;
+    };
+
+    static_assert(sizeof(AffineTransform) == 48, "AffineTransform must stay 48 bytes");
+
+    /// @brief Returns a * b (b is applied first).
+    AffineTransform multiply(const AffineTransform& a, const AffineTransform& b);
+    AffineTransform inverse(const AffineTransform& transform);
+
+    /// @brief Splits a transform into translation, XYZ euler angles (degrees) and scale. Assumes
+    /// the transform contains no shear.
+    void decompose(const AffineTransform& transform,
+                   glm::vec3& translation,
+                   glm::vec3& eulerDegrees,
+                   glm::vec3& scale);
+
+    inline AffineTransform operator*(const AffineTransform& a, const AffineTransform& b) {
+        return multiply(a, b);
+    }
+}  // namespace x::Math
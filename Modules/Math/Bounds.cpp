@@ -0,0 +1,166 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "Bounds.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace x::Math {
+    AABB AABB::fromCenterExtents(const glm::vec3& center, const glm::vec3& extents) {
+        return {center - extents, center + extents};
+    }
+
+    bool AABB::valid() const {
+        return min.x <= max.x && min.y <= max.y && min.z <= max.z;
+    }
+
+    glm::vec3 AABB::getCenter() const {
+        return (min + max) * 0.5f;
+    }
+
+    glm::vec3 AABB::getExtents() const {
+        return (max - min) * 0.5f;
+    }
+
+    f32 AABB::getSurfaceArea() const {
+        const auto d = max - min;
+        return 2.f * (d.x * d.y + d.y * d.z + d.z * d.x);
+    }
+
+    bool AABB::contains(const AABB& other) const {
+        return min.x <= other.min.x && min.y <= other.min.y && min.z <= other.min.z &&
+               max.x >= other.max.x && max.y >= other.max.y && max.z >= other.max.z;
+    }
+
+    bool AABB::overlaps(const AABB& other) const {
+        return min.x <= other.max.x && max.x >= other.min.x && min.y <= other.max.y &&
+               max.y >= other.min.y && min.z <= other.max.z && max.z >= other.min.z;
+    }
+
+    void AABB::expand(const glm::vec3& point) {
+        min = glm::min(min, point);
+        max = glm::max(max, point);
+    }
+
+    void AABB::expand(const AABB& other) {
+        min = glm::min(min, other.min);
+        max = glm::max(max, other.max);
+    }
+
+    AABB AABB::fattened(f32 margin) const {
+        const glm::vec3 m(margin);
+        return {min - m, max + m};
+    }
+
+    AABB merge(const AABB& a, const AABB& b) {
+        return {glm::min(a.min, b.min), glm::max(a.max, b.max)};
+    }
+
+    AABB transformAABB(const AABB& aabb, const AffineTransform& transform) {
+        // Arvo's method: project the extents onto each world axis
+        const auto center  = transform.transformPoint(aabb.getCenter());
+        const auto extents = aabb.getExtents();
+        glm::vec3 worldExtents;
+        for (i32 i = 0; i < 3; i++) {
+            const auto& row = transform.rows[i];
+            worldExtents[i] = std::abs(row.x) * extents.x + std::abs(row.y) * extents.y +
+                              std::abs(row.z) * extents.z;
+        }
+        return AABB::fromCenterExtents(center, worldExtents);
+    }
+
+    BoundingSphere BoundingSphere::fromAABB(const AABB& aabb) {
+        return {aabb.getCenter(), glm::length(aabb.getExtents())};
+    }
+
+    BoundingSphere transformSphere(const BoundingSphere& sphere, const AffineTransform& transform) {
+        const auto& r = transform.rows;
+        // Conservative radius, scaled by the largest axis scale
+        const f32 maxScaleSq =
+          std::max({r[0].x * r[0].x + r[1].x * r[1].x + r[2].x * r[2].x,
+                    r[0].y * r[0].y + r[1].y * r[1].y + r[2].y * r[2].y,
+                    r[0].z * r[0].z + r[1].z * r[1].z + r[2].z * r[2].z});
+        return {transform.transformPoint(sphere.center), sphere.radius * std::sqrt(maxScaleSq)};
+    }
+
+    f32 Plane::signedDistance(const glm::vec3& point) const {
+        return glm::dot(normal, point) + distance;
+    }
+
+    Frustum Frustum::fromMatrix(const glm::mat4& viewProjection) {
+        // Gribb/Hartmann plane extraction. glm is column-major, so gather the rows first.
+        const auto& m = viewProjection;
+        glm::vec4 rows[4];
+        for (i32 i = 0; i < 4; i++) {
+            rows[i] = glm::vec4(m[0][i], m[1][i], m[2][i], m[3][i]);
+        }
+
+        const glm::vec4 equations[Count] = {
+          rows[3] + rows[0],
+          rows[3] - rows[0],
+          rows[3] + rows[1],
+          rows[3] - rows[1],
+          rows[3] + rows[2],
+          rows[3] - rows[2],
+        };
+
+        Frustum frustum;
+        for (i32 i = 0; i < Count; i++) {
+            const auto& e     = equations[i];
+            const f32 length  = glm::length(glm::vec3(e));
+            frustum.planes[i] = {glm::vec3(e) / length, e.w / length};
+        }
+        return frustum;
+    }
+
+    bool intersects(const AABB& a, const AABB& b) {
+        return a.overlaps(b);
+    }
+
+    bool intersects(const AABB& aabb, const BoundingSphere& sphere) {
+        const auto closest = glm::min(glm::max(sphere.center, aabb.min), aabb.max);
+        const auto delta   = closest - sphere.center;
+        return glm::dot(delta, delta) <= sphere.radius * sphere.radius;
+    }
+
+    bool intersects(const Frustum& frustum, const AABB& aabb) {
+        const auto center  = aabb.getCenter();
+        const auto extents = aabb.getExtents();
+        for (const auto& plane : frustum.planes) {
+            const f32 radius = glm::dot(extents, glm::abs(plane.normal));
+            if (plane.signedDistance(center) < -radius) { return false; }
+        }
+        return true;
+    }
+
+    bool intersects(const Frustum& frustum, const BoundingSphere& sphere) {
+        for (const auto& plane : frustum.planes) {
+            if (plane.signedDistance(sphere.center) < -sphere.radius) { return false; }
+        }
+        return true;
+    }
+
+    bool intersects(const Ray& ray, const AABB& aabb, f32 maxDistance, f32& tMin) {
+        f32 tNear = 0.f;
+        f32 tFar  = maxDistance;
+        for (i32 i = 0; i < 3; i++) {
+            // Parallel to the slab. The division below would give 0 * inf = NaN for an origin
+            // on one of its planes, so test the origin directly.
+            if (ray.direction[i] == 0.f) {
+                if (ray.origin[i] < aabb.min[i] || ray.origin[i] > aabb.max[i]) { return false; }
+                continue;
+            }
+            const f32 invDir = 1.f / ray.direction[i];
+            f32 t0           = (aabb.min[i] - ray.origin[i]) * invDir;
+            f32 t1           = (aabb.max[i] - ray.origin[i]) * invDir;
+            if (invDir < 0.f) { std::swap(t0, t1); }
+            tNear = t0 > tNear ? t0 : tNear;
+            tFar  = t1 < tFar ? t1 : tFar;
+            if (tFar < tNear) { return false; }
+        }
+        tMin = tNear;
+        return true;
+    }
+}  // namespace x::Math
@@ -0,0 +1,72 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "AffineTransform.hpp"
+
+#include <limits>
+#include <glm/glm.hpp>
+
+namespace x::Math {
+    struct AABB {
+        glm::vec3 min = glm::vec3(std::numeric_limits<f32>::max());
+        glm::vec3 max = glm::vec3(std::numeric_limits<f32>::lowest());
+
+        static AABB fromCenterExtents(const glm::vec3& center, const glm::vec3& extents);
+
+        [[nodiscard]] bool valid() const;
+        [[nodiscard]] glm::vec3 getCenter() const;
+        [[nodiscard]] glm::vec3 getExtents() const;
+        [[nodiscard]] f32 getSurfaceArea() const;
+        [[nodiscard]] bool contains(const AABB& other) const;
+        [[nodiscard]] bool overlaps(const AABB& other) const;
+
+        void expand(const glm::vec3& point);
+        void expand(const AABB& other);
+        [[nodiscard]] AABB fattened(f32 margin) const;
+    };
+
+    AABB merge(const AABB& a, const AABB& b);
+    /// @brief Returns the world space AABB enclosing a local space AABB moved by transform.
+    AABB transformAABB(const AABB& aabb, const AffineTransform& transform);
+
+    struct BoundingSphere {
+        glm::vec3 center = glm::vec3(0.f);
+        f32 radius       = 0.f;
+
+        static BoundingSphere fromAABB(const AABB& aabb);
+    };
+
+    BoundingSphere transformSphere(const BoundingSphere& sphere, const AffineTransform& transform);
+
+    struct Ray {
+        glm::vec3 origin;
+        glm::vec3 direction;  // Does not need to be normalized; hit distances are in its units
+    };
+
+    /// @brief Plane in the form dot(normal, p) + distance = 0, normal pointing inward.
+    struct Plane {
+        glm::vec3 normal = glm::vec3(0.f, 1.f, 0.f);
+        f32 distance     = 0.f;
+
+        [[nodiscard]] f32 signedDistance(const glm::vec3& point) const;
+    };
+
+    struct Frustum {
+        enum Side { Left, Right, Bottom, Top, Near, Far, Count };
+        Plane planes[Count];
+
+        /// @brief Extracts the six planes from a (projection * view) matrix.
+        static Frustum fromMatrix(const glm::mat4& viewProjection);
+    };
+
+    bool intersects(const AABB& a, const AABB& b);
+    bool intersects(const AABB& aabb, const BoundingSphere& sphere);
+    bool intersects(const Frustum& frustum, const AABB& aabb);
+    bool intersects(const Frustum& frustum, const BoundingSphere& sphere);
+    /// @brief Slab test. On hit, tMin receives the entry distance along the ray.
+    bool intersects(const Ray& ray, const AABB& aabb, f32 maxDistance, f32& tMin);
+}  // namespace x::Math
@@ -0,0 +1,330 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "DynamicAABBTree.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace x::Math {
+    DynamicAABBTree::DynamicAABBTree(f32 margin) : _margin(margin) {}
+
+    void DynamicAABBTree::reserve(size_t entityCount) {
+        // A tree with n leaves has n - 1 internal nodes
+        _nodes.reserve(entityCount * 2);
+        _leaves.reserve(entityCount);
+    }
+
+    void DynamicAABBTree::clear() {
+        _nodes.clear();
+        _leaves.clear();
+        _root     = kNullNode;
+        _freeList = kNullNode;
+    }
+
+    void DynamicAABBTree::insert(EntityId entity, const AABB& bounds) {
+        if (_leaves.find(entity) != _leaves.end()) {
+            update(entity, bounds);
+            return;
+        }
+
+        const i32 leaf       = allocateNode();
+        _nodes[leaf].bounds  = bounds.fattened(_margin);
+        _nodes[leaf].entity  = entity;
+        _nodes[leaf].height  = 0;
+        _leaves[entity]      = leaf;
+        insertLeaf(leaf);
+    }
+
+    void DynamicAABBTree::remove(EntityId entity) {
+        const auto it = _leaves.find(entity);
+        if (it == _leaves.end()) { return; }
+        removeLeaf(it->second);
+        freeNode(it->second);
+        _leaves.erase(it);
+    }
+
+    bool DynamicAABBTree::update(EntityId entity, const AABB& bounds) {
+        const auto it = _leaves.find(entity);
+        if (it == _leaves.end()) {
+            insert(entity, bounds);
+            return true;
+        }
+
+        const i32 leaf = it->second;
+        if (_nodes[leaf].bounds.contains(bounds)) { return false; }
+
+        removeLeaf(leaf);
+        _nodes[leaf].bounds = bounds.fattened(_margin);
+        insertLeaf(leaf);
+        return true;
+    }
+
+    size_t DynamicAABBTree::refit(std::span<const LeafUpdate> updates) {
+        size_t enlarged = 0;
+        for (const auto& [entity, bounds] : updates) {
+            const auto it = _leaves.find(entity);
+            if (it == _leaves.end()) { continue; }
+
+            auto& leaf = _nodes[it->second];
+            if (leaf.bounds.contains(bounds)) { continue; }
+            leaf.bounds = bounds.fattened(_margin);
+            enlarged++;
+
+            // Flag the path to the root; stop as soon as we meet a path already flagged
+            for (i32 node = leaf.parent; node != kNullNode && !_nodes[node].dirty;
+                 node     = _nodes[node].parent) {
+                _nodes[node].dirty = true;
+            }
+        }
+
+        if (enlarged > 0 && _root != kNullNode) { refitDirty(_root); }
+        return enlarged;
+    }
+
+    bool DynamicAABBTree::contains(EntityId entity) const {
+        return _leaves.find(entity) != _leaves.end();
+    }
+
+    const AABB* DynamicAABBTree::getFatBounds(EntityId entity) const {
+        const auto it = _leaves.find(entity);
+        if (it == _leaves.end()) { return nullptr; }
+        return &_nodes[it->second].bounds;
+    }
+
+    size_t DynamicAABBTree::size() const {
+        return _leaves.size();
+    }
+
+    i32 DynamicAABBTree::getHeight() const {
+        return _root == kNullNode ? 0 : _nodes[_root].height;
+    }
+
+    bool DynamicAABBTree::validate() const {
+        if (_root == kNullNode) { return _leaves.empty(); }
+        if (_nodes[_root].parent != kNullNode) { return false; }
+
+        size_t leafCount = 0;
+        std::vector<i32> stack {_root};
+        while (!stack.empty()) {
+            const i32 index  = stack.back();
+            const auto& node = _nodes[index];
+            stack.pop_back();
+
+            if (node.isLeaf()) {
+                if (node.height != 0) { return false; }
+                leafCount++;
+                continue;
+            }
+
+            const auto& a = _nodes[node.child1];
+            const auto& b = _nodes[node.child2];
+            if (a.parent != index || b.parent != index) { return false; }
+            if (node.height != 1 + std::max(a.height, b.height)) { return false; }
+            if (!node.bounds.contains(a.bounds) || !node.bounds.contains(b.bounds)) {
+                return false;
+            }
+            stack.push_back(node.child1);
+            stack.push_back(node.child2);
+        }
+        return leafCount == _leaves.size();
+    }
+
+    i32 DynamicAABBTree::allocateNode() {
+        if (_freeList == kNullNode) {
+            _nodes.emplace_back();
+            return CAST<i32>(_nodes.size() - 1);
+        }
+
+        const i32 node = _freeList;
+        _freeList      = _nodes[node].parent;
+        _nodes[node]   = Node {};
+        return node;
+    }
+
+    void DynamicAABBTree::freeNode(i32 node) {
+        _nodes[node].parent = _freeList;
+        _nodes[node].height = -1;
+        _freeList           = node;
+    }
+
+    void DynamicAABBTree::insertLeaf(i32 leaf) {
+        if (_root == kNullNode) {
+            _root                = leaf;
+            _nodes[leaf].parent  = kNullNode;
+            return;
+        }
+
+        // Descend towards the cheapest sibling using the surface area heuristic. Moving a level
+        // down costs the area growth every ancestor pays (inheritance cost).
+        const AABB leafBounds = _nodes[leaf].bounds;
+        i32 index             = _root;
+        while (!_nodes[index].isLeaf()) {
+            const auto& node = _nodes[index];
+            const f32 area   = node.bounds.getSurfaceArea();
+            const f32 combinedArea = merge(node.bounds, leafBounds).getSurfaceArea();
+
+            // Cost of creating a new parent for this node and the new leaf
+            const f32 cost = 2.f * combinedArea;
+            // Minimum cost of pushing the leaf further down the tree
+            const f32 inheritanceCost = 2.f * (combinedArea - area);
+
+            const auto descendCost = [&](i32 child) {
+                const auto& childBounds = _nodes[child].bounds;
+                const f32 mergedArea    = merge(leafBounds, childBounds).getSurfaceArea();
+                if (_nodes[child].isLeaf()) { return mergedArea + inheritanceCost; }
+                return (mergedArea - childBounds.getSurfaceArea()) + inheritanceCost;
+            };
+
+            const f32 cost1 = descendCost(node.child1);
+            const f32 cost2 = descendCost(node.child2);
+            if (cost < cost1 && cost < cost2) { break; }
+            index = cost1 < cost2 ? node.child1 : node.child2;
+        }
+
+        // Splice in a new parent above the chosen sibling
+        const i32 sibling   = index;
+        const i32 oldParent = _nodes[sibling].parent;
+        const i32 newParent = allocateNode();
+        auto& parentNode    = _nodes[newParent];
+        parentNode.parent   = oldParent;
+        parentNode.bounds   = merge(leafBounds, _nodes[sibling].bounds);
+        parentNode.height   = _nodes[sibling].height + 1;
+        parentNode.child1   = sibling;
+        parentNode.child2   = leaf;
+        _nodes[sibling].parent = newParent;
+        _nodes[leaf].parent    = newParent;
+
+        if (oldParent != kNullNode) {
+            if (_nodes[oldParent].child1 == sibling) {
+                _nodes[oldParent].child1 = newParent;
+            } else {
+                _nodes[oldParent].child2 = newParent;
+            }
+        } else {
+            _root = newParent;
+        }
+
+        refitAncestors(_nodes[leaf].parent);
+    }
+
+    void DynamicAABBTree::removeLeaf(i32 leaf) {
+        if (leaf == _root) {
+            _root = kNullNode;
+            return;
+        }
+
+        const i32 parent      = _nodes[leaf].parent;
+        const i32 grandParent = _nodes[parent].parent;
+        const i32 sibling =
+          _nodes[parent].child1 == leaf ? _nodes[parent].child2 : _nodes[parent].child1;
+
+        if (grandParent != kNullNode) {
+            // Replace the parent with the sibling
+            if (_nodes[grandParent].child1 == parent) {
+                _nodes[grandParent].child1 = sibling;
+            } else {
+                _nodes[grandParent].child2 = sibling;
+            }
+            _nodes[sibling].parent = grandParent;
+            freeNode(parent);
+            refitAncestors(grandParent);
+        } else {
+            _root                  = sibling;
+            _nodes[sibling].parent = kNullNode;
+            freeNode(parent);
+        }
+    }
+
+    void DynamicAABBTree::refitAncestors(i32 node) {
+        while (node != kNullNode) {
+            node = balance(node);
+
+            auto& current         = _nodes[node];
+            const auto& child1    = _nodes[current.child1];
+            const auto& child2    = _nodes[current.child2];
+            current.height        = 1 + std::max(child1.height, child2.height);
+            current.bounds        = merge(child1.bounds, child2.bounds);
+            node                  = current.parent;
+        }
+    }
+
+    void DynamicAABBTree::refitDirty(i32 node) {
+        auto& current = _nodes[node];
+        if (current.isLeaf() || !current.dirty) { return; }
+        refitDirty(current.child1);
+        refitDirty(current.child2);
+        current.bounds = merge(_nodes[current.child1].bounds, _nodes[current.child2].bounds);
+        current.dirty  = false;
+    }
+
+    i32 DynamicAABBTree::balance(i32 iA) {
+        // Performs a left or right rotation if node A is imbalanced. Returns the new subtree root.
+        auto& A = _nodes[iA];
+        if (A.isLeaf() || A.height < 2) { return iA; }
+
+        const i32 iB = A.child1;
+        const i32 iC = A.child2;
+        auto& B      = _nodes[iB];
+        auto& C      = _nodes[iC];
+
+        const i32 heightDelta = C.height - B.height;
+
+        const auto rotateUp = [&](i32 iUp, i32 iOther) {
+            // Promote iUp (a child of A) above A. iOther is A's remaining child.
+            auto& up          = _nodes[iUp];
+            const i32 iF      = up.child1;
+            const i32 iG      = up.child2;
+            auto& F           = _nodes[iF];
+            auto& G           = _nodes[iG];
+            auto& other       = _nodes[iOther];
+
+            up.child1 = iA;
+            up.parent = A.parent;
+            A.parent  = iUp;
+
+            if (up.parent != kNullNode) {
+                if (_nodes[up.parent].child1 == iA) {
+                    _nodes[up.parent].child1 = iUp;
+                } else {
+                    _nodes[up.parent].child2 = iUp;
+                }
+            } else {
+                _root = iUp;
+            }
+
+            // Keep the taller grandchild under iUp, hand the shorter one to A
+            const bool aIsFirst = A.child1 == iOther;
+            const auto rotate   = [&](i32 iKeep, Node& keep, i32 iGive, Node& give) {
+                up.child2   = iKeep;
+                give.parent = iA;
+                if (aIsFirst) {
+                    A.child2 = iGive;
+                } else {
+                    A.child1 = iGive;
+                }
+                A.bounds   = merge(other.bounds, give.bounds);
+                up.bounds  = merge(A.bounds, keep.bounds);
+                A.height   = 1 + std::max(other.height, give.height);
+                up.height  = 1 + std::max(A.height, keep.height);
+            };
+
+            if (F.height > G.height) {
+                rotate(iF, F, iG, G);
+            } else {
+                rotate(iG, G, iF, F);
+            }
+        };
+
+        if (heightDelta > 1) {
+            rotateUp(iC, iB);
+            return iC;
+        }
+        if (heightDelta < -1) {
+            rotateUp(iB, iC);
+            return iB;
+        }
+        return iA;
+    }
+}  // namespace x::Math
@@ -0,0 +1,235 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "Bounds.hpp"
+#include "EntityId.hpp"
+
+#include <span>
+#include <vector>
+#include <unordered_map>
+
+namespace x::Math {
+    /// @brief Incrementally updated bounding volume hierarchy keyed by EntityId.
+    ///
+    /// Leaves store a fattened copy of the entity bounds so small movements don't touch the tree.
+    /// New leaves are placed with a surface area heuristic and the tree is kept balanced with
+    /// rotations, so queries stay logarithmic as entities are added, moved and removed.
+    class DynamicAABBTree {
+    public:
+        static constexpr i32 kNullNode = -1;
+
+        struct LeafUpdate {
+            EntityId entity;
+            AABB bounds;
+        };
+
+        explicit DynamicAABBTree(f32 margin = 0.1f);
+
+        void reserve(size_t entityCount);
+        void clear();
+
+        void insert(EntityId entity, const AABB& bounds);
+        void remove(EntityId entity);
+        /// @brief Moves an entity's bounds. Returns true if the leaf escaped its fat bounds and
+        /// was re-inserted.
+        bool update(EntityId entity, const AABB& bounds);
+        /// @brief Updates many leaves at once (typically every entity whose transform changed this
+        /// frame) and refits only the affected ancestors in a single bottom-up pass. Topology is
+        /// left untouched. Returns the number of leaves whose fat bounds were enlarged.
+        size_t refit(std::span<const LeafUpdate> updates);
+
+        [[nodiscard]] bool contains(EntityId entity) const;
+        [[nodiscard]] const AABB* getFatBounds(EntityId entity) const;
+        [[nodiscard]] size_t size() const;
+        [[nodiscard]] i32 getHeight() const;
+        /// @brief Recomputes every node's height and checks parent links. Used by tests.
+        [[nodiscard]] bool validate() const;
+
+        /// @brief Invokes callback(EntityId) for every leaf overlapping the bounds.
+        template<typename Callback>
+        void query(const AABB& bounds, Callback&& callback) const;
+
+        template<typename Callback>
+        void query(const BoundingSphere& sphere, Callback&& callback) const;
+
+        /// @brief Invokes callback(EntityId) for every leaf inside or intersecting the frustum.
+        /// Subtrees fully inside the frustum are reported without further plane tests.
+        template<typename Callback>
+        void query(const Frustum& frustum, Callback&& callback) const;
+
+        /// @brief Invokes callback(EntityId, entryDistance) for leaves hit by the ray. The
+        /// callback returns the new max distance: return the current value to keep going, a
+        /// shorter one to clip the ray (closest hit), or 0 to stop.
+        template<typename Callback>
+        void raycast(const Ray& ray, f32 maxDistance, Callback&& callback) const;
+
+    private:
+        struct Node {
+            AABB bounds;
+            i32 parent = kNullNode;  // Doubles as the next link while on the free list
+            i32 child1 = kNullNode;
+            i32 child2 = kNullNode;
+            i32 height = 0;  // 0 for leaves, -1 for free nodes
+            EntityId entity;
+            bool dirty = false;
+
+            [[nodiscard]] bool isLeaf() const {
+                return child1 == kNullNode;
+            }
+        };
+
+        /// @brief Traversal stack that stays on the C++ stack for any reasonably balanced tree.
+        class NodeStack {
+        public:
+            void push(i32 node) {
+                if (_count < kInline) {
+                    _inline[_count++] = node;
+                } else {
+                    _overflow.push_back(node);
+                }
+            }
+
+            i32 pop() {
+                if (!_overflow.empty()) {
+                    const i32 node = _overflow.back();
+                    _overflow.pop_back();
+                    return node;
+                }
+                return _inline[--_count];
+            }
+
+            [[nodiscard]] bool empty() const {
+                return _count == 0 && _overflow.empty();
+            }
+
+        private:
+            static constexpr i32 kInline = 128;
+            i32 _inline[kInline] {};
+            i32 _count = 0;
+            std::vector<i32> _overflow;
+        };
+
+        std::vector<Node> _nodes;
+        std::unordered_map<EntityId, i32> _leaves;
+        i32 _root     = kNullNode;
+        i32 _freeList = kNullNode;
+        f32 _margin;
+
+        i32 allocateNode();
+        void freeNode(i32 node);
+        void insertLeaf(i32 leaf);
+        void removeLeaf(i32 leaf);
+        i32 balance(i32 node);
+        void refitAncestors(i32 node);
+        void refitDirty(i32 node);
+        template<typename Callback>
+        void reportSubtree(i32 node, Callback& callback) const;
+    };
+
+    template<typename Callback>
+    void DynamicAABBTree::query(const AABB& bounds, Callback&& callback) const {
+        if (_root == kNullNode) { return; }
+        NodeStack stack;
+        stack.push(_root);
+        while (!stack.empty()) {
+            const auto& node = _nodes[stack.pop()];
+            if (!node.bounds.overlaps(bounds)) { continue; }
+            if (node.isLeaf()) {
+                callback(node.entity);
+            } else {
+                stack.push(node.child1);
+                stack.push(node.child2);
+            }
+        }
+    }
+
+    template<typename Callback>
+    void DynamicAABBTree::query(const BoundingSphere& sphere, Callback&& callback) const {
+        if (_root == kNullNode) { return; }
+        NodeStack stack;
+        stack.push(_root);
+        while (!stack.empty()) {
+            const auto& node = _nodes[stack.pop()];
+            if (!intersects(node.bounds, sphere)) { continue; }
+            if (node.isLeaf()) {
+                callback(node.entity);
+            } else {
+                stack.push(node.child1);
+                stack.push(node.child2);
+            }
+        }
+    }
+
+    template<typename Callback>
+    void DynamicAABBTree::query(const Frustum& frustum, Callback&& callback) const {
+        if (_root == kNullNode) { return; }
+        NodeStack stack;
+        stack.push(_root);
+        while (!stack.empty()) {
+            const i32 index  = stack.pop();
+            const auto& node = _nodes[index];
+
+            const auto center  = node.bounds.getCenter();
+            const auto extents = node.bounds.getExtents();
+            bool inside        = true;
+            bool outside       = false;
+            for (const auto& plane : frustum.planes) {
+                const f32 radius   = glm::dot(extents, glm::abs(plane.normal));
+                const f32 distance = plane.signedDistance(center);
+                if (distance < -radius) {
+                    outside = true;
+                    break;
+                }
+                if (distance < radius) { inside = false; }
+            }
+
+            if (outside) { continue; }
+            if (inside) {
+                reportSubtree(index, callback);
+            } else if (node.isLeaf()) {
+                callback(node.entity);
+            } else {
+                stack.push(node.child1);
+                stack.push(node.child2);
+            }
+        }
+    }
+
+    template<typename Callback>
+    void DynamicAABBTree::raycast(const Ray& ray, f32 maxDistance, Callback&& callback) const {
+        if (_root == kNullNode) { return; }
+        NodeStack stack;
+        stack.push(_root);
+        while (!stack.empty()) {
+            const auto& node = _nodes[stack.pop()];
+            f32 entry        = 0.f;
+            if (!intersects(ray, node.bounds, maxDistance, entry)) { continue; }
+            if (node.isLeaf()) {
+                maxDistance = callback(node.entity, entry);
+                if (maxDistance <= 0.f) { return; }
+            } else {
+                stack.push(node.child1);
+                stack.push(node.child2);
+            }
+        }
+    }
+
+    template<typename Callback>
+    void DynamicAABBTree::reportSubtree(i32 node, Callback& callback) const {
+        NodeStack stack;
+        stack.push(node);
+        while (!stack.empty()) {
+            const auto& current = _nodes[stack.pop()];
+            if (current.isLeaf()) {
+                callback(current.entity);
+            } else {
+                stack.push(current.child1);
+                stack.push(current.child2);
+            }
+        }
+    }
+}  // namespace x::Math
@@ -0,0 +1,121 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "FrustumCuller.hpp"
+
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define X_FRUSTUM_CULLER_SSE
+    #include <emmintrin.h>
+#endif
+
+namespace x::Math {
+    void FrustumCuller::resize(size_t count) {
+        _centerX.resize(count);
+        _centerY.resize(count);
+        _centerZ.resize(count);
+        _extentX.resize(count);
+        _extentY.resize(count);
+        _extentZ.resize(count);
+    }
+
+    void FrustumCuller::set(size_t index, const AABB& bounds) {
+        const auto center  = bounds.getCenter();
+        const auto extents = bounds.getExtents();
+        _centerX[index]    = center.x;
+        _centerY[index]    = center.y;
+        _centerZ[index]    = center.z;
+        _extentX[index]    = extents.x;
+        _extentY[index]    = extents.y;
+        _extentZ[index]    = extents.z;
+    }
+
+    void FrustumCuller::setEmpty(size_t index) {
+        // A hugely negative extent puts the box outside of every plane. Finite, so that zero
+        // normal components don't turn the radius into NaN.
+        constexpr f32 kEmptyExtent = -1e30f;
+        _centerX[index] = _centerY[index] = _centerZ[index] = 0.f;
+        _extentX[index] = _extentY[index] = _extentZ[index] = kEmptyExtent;
+    }
+
+    size_t FrustumCuller::size() const {
+        return _centerX.size();
+    }
+
+    size_t
+    FrustumCuller::cull(const Frustum& frustum, size_t begin, size_t end, u8* visible) const {
+#ifdef X_FRUSTUM_CULLER_SSE
+        // Broadcast each plane once; the absolute normal gives the box's projected radius
+        __m128 nx[Frustum::Count], ny[Frustum::Count], nz[Frustum::Count], d[Frustum::Count];
+        __m128 ax[Frustum::Count], ay[Frustum::Count], az[Frustum::Count];
+        for (i32 p = 0; p < Frustum::Count; p++) {
+            const auto& plane = frustum.planes[p];
+            nx[p]             = _mm_set1_ps(plane.normal.x);
+            ny[p]             = _mm_set1_ps(plane.normal.y);
+            nz[p]             = _mm_set1_ps(plane.normal.z);
+            d[p]              = _mm_set1_ps(plane.distance);
+            ax[p]             = _mm_set1_ps(std::abs(plane.normal.x));
+            ay[p]             = _mm_set1_ps(std::abs(plane.normal.y));
+            az[p]             = _mm_set1_ps(std::abs(plane.normal.z));
+        }
+
+        size_t count = 0;
+        size_t i     = begin;
+        for (; i + 4 <= end; i += 4) {
+            const __m128 cx = _mm_loadu_ps(&_centerX[i]);
+            const __m128 cy = _mm_loadu_ps(&_centerY[i]);
+            const __m128 cz = _mm_loadu_ps(&_centerZ[i]);
+            const __m128 ex = _mm_loadu_ps(&_extentX[i]);
+            const __m128 ey = _mm_loadu_ps(&_extentY[i]);
+            const __m128 ez = _mm_loadu_ps(&_extentZ[i]);
+
+            __m128 outside = _mm_setzero_ps();
+            for (i32 p = 0; p < Frustum::Count; p++) {
+                const __m128 distance = _mm_add_ps(
+                  _mm_add_ps(_mm_mul_ps(nx[p], cx), _mm_mul_ps(ny[p], cy)),
+                  _mm_add_ps(_mm_mul_ps(nz[p], cz), d[p]));
+                const __m128 radius = _mm_add_ps(
+                  _mm_add_ps(_mm_mul_ps(ax[p], ex), _mm_mul_ps(ay[p], ey)),
+                  _mm_mul_ps(az[p], ez));
+                // distance < -radius  <=>  distance + radius < 0
+                outside = _mm_or_ps(outside,
+                                    _mm_cmplt_ps(_mm_add_ps(distance, radius), _mm_setzero_ps()));
+            }
+
+            const i32 mask = ~_mm_movemask_ps(outside);
+            for (i32 lane = 0; lane < 4; lane++) {
+                const u8 inside           = CAST<u8>((mask >> lane) & 1);
+                visible[i - begin + lane] = inside;
+                count += inside;
+            }
+        }
+        return count + cullScalar(frustum, i, end, visible + (i - begin));
+#else
+        return cullScalar(frustum, begin, end, visible);
+#endif
+    }
+
+    size_t
+    FrustumCuller::cullScalar(const Frustum& frustum, size_t begin, size_t end, u8* visible) const {
+        size_t count = 0;
+        for (size_t i = begin; i < end; i++) {
+            bool inside = true;
+            for (const auto& plane : frustum.planes) {
+                const f32 distance = plane.normal.x * _centerX[i] + plane.normal.y * _centerY[i] +
+                                     plane.normal.z * _centerZ[i] + plane.distance;
+                const f32 radius = std::abs(plane.normal.x) * _extentX[i] +
+                                   std::abs(plane.normal.y) * _extentY[i] +
+                                   std::abs(plane.normal.z) * _extentZ[i];
+                if (distance + radius < 0.f) {
+                    inside = false;
+                    break;
+                }
+            }
+            visible[i - begin] = inside ? 1 : 0;
+            count += inside;
+        }
+        return count;
+    }
+}  // namespace x::Math
@@ -0,0 +1,36 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "Bounds.hpp"
+
+#include <vector>
+
+namespace x::Math {
+    /// @brief World space boxes stored as structure-of-arrays and tested against a frustum four
+    /// at a time with SSE, or one at a time where SSE is unavailable.
+    ///
+    /// set() and cull() only touch the given indices, so disjoint ranges can be filled and
+    /// culled from different threads once the culler has been resized.
+    class FrustumCuller {
+    public:
+        void resize(size_t count);
+        void set(size_t index, const AABB& bounds);
+        /// @brief Marks the box as never visible (e.g. a hidden or unbounded renderable)
+        void setEmpty(size_t index);
+        [[nodiscard]] size_t size() const;
+
+        /// @brief Writes 1 to visible[i - begin] for every box in [begin, end) that may be
+        /// visible and 0 otherwise. Returns the number of visible boxes.
+        size_t cull(const Frustum& frustum, size_t begin, size_t end, u8* visible) const;
+
+    private:
+        std::vector<f32> _centerX, _centerY, _centerZ;
+        std::vector<f32> _extentX, _extentY, _extentZ;
+
+        size_t cullScalar(const Frustum& frustum, size_t begin, size_t end, u8* visible) const;
+    };
+}  // namespace x::Math
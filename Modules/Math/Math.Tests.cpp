@@ -0,0 +1,362 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "AffineTransform.hpp"
+#include "Bounds.hpp"
+#include "DynamicAABBTree.hpp"
+#include "FrustumCuller.hpp"
+#include "OcclusionBuffer.hpp"
+#include "Random.inl"
+
+#include <set>
+#include <glm/gtc/matrix_transform.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace x::Math;
+
+static bool approxEqual(const glm::vec3& a, const glm::vec3& b, f32 epsilon = 1e-4f) {
+    return glm::length(a - b) <= epsilon;
+}
+
+TEST_CASE("AffineTransform - TRS round trip", "[Math]") {
+    const glm::vec3 position(1.f, -2.f, 3.f);
+    const glm::vec3 rotation(30.f, -45.f, 60.f);
+    const glm::vec3 scale(2.f, 0.5f, 1.5f);
+
+    const auto transform = AffineTransform::fromTRS(position, rotation, scale);
+    REQUIRE(approxEqual(transform.getTranslation(), position));
+
+    glm::vec3 outPosition, outRotation, outScale;
+    decompose(transform, outPosition, outRotation, outScale);
+    REQUIRE(approxEqual(outPosition, position));
+    REQUIRE(approxEqual(outRotation, rotation, 1e-2f));
+    REQUIRE(approxEqual(outScale, scale));
+}
+
+TEST_CASE("AffineTransform - Multiply matches mat4", "[Math]") {
+    const auto a = AffineTransform::fromTRS({1.f, 2.f, 3.f}, {10.f, 20.f, 30.f}, glm::vec3(2.f));
+    const auto b = AffineTransform::fromTRS({-4.f, 0.f, 1.f}, {0.f, 90.f, 0.f}, {1.f, 3.f, 1.f});
+
+    const auto compact = (a * b).toMat4();
+    const auto full    = a.toMat4() * b.toMat4();
+    for (i32 col = 0; col < 4; col++) {
+        for (i32 row = 0; row < 4; row++) {
+            REQUIRE(std::abs(compact[col][row] - full[col][row]) < 1e-4f);
+        }
+    }
+
+    const glm::vec3 point(0.5f, -1.f, 2.f);
+    const auto expected = glm::vec3(full * glm::vec4(point, 1.f));
+    REQUIRE(approxEqual((a * b).transformPoint(point), expected));
+    REQUIRE(approxEqual(AffineTransform::fromMat4(full).transformPoint(point), expected));
+}
+
+TEST_CASE("AffineTransform - Inverse", "[Math]") {
+    const auto transform =
+      AffineTransform::fromTRS({5.f, -1.f, 2.f}, {15.f, 25.f, -35.f}, {0.25f, 4.f, 1.f});
+    const auto identity = transform * inverse(transform);
+
+    const glm::vec3 point(3.f, 7.f, -2.f);
+    REQUIRE(approxEqual(identity.transformPoint(point), point));
+    REQUIRE(approxEqual(inverse(transform).transformPoint(transform.transformPoint(point)), point));
+}
+
+static std::vector<AABB> makeRandomBounds(size_t count) {
+    std::vector<AABB> bounds;
+    bounds.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        const glm::vec3 center(Random::getRandomRange(-100.f, 100.f),
+                               Random::getRandomRange(-100.f, 100.f),
+                               Random::getRandomRange(-100.f, 100.f));
+        const glm::vec3 extents(Random::getRandomRange(0.1f, 2.f),
+                                Random::getRandomRange(0.1f, 2.f),
+                                Random::getRandomRange(0.1f, 2.f));
+        bounds.push_back(AABB::fromCenterExtents(center, extents));
+    }
+    return bounds;
+}
+
+TEST_CASE("DynamicAABBTree - Queries match brute force", "[Math]") {
+    constexpr size_t kCount = 2000;
+    const auto bounds       = makeRandomBounds(kCount);
+
+    DynamicAABBTree tree(0.f);
+    tree.reserve(kCount);
+    for (size_t i = 0; i < kCount; i++) {
+        tree.insert(x::EntityId(i), bounds[i]);
+    }
+    REQUIRE(tree.size() == kCount);
+    REQUIRE(tree.validate());
+    REQUIRE(tree.getHeight() < 32);
+
+    const auto box = AABB::fromCenterExtents(glm::vec3(10.f, 0.f, -5.f), glm::vec3(25.f));
+    std::set<u64> expected, found;
+    for (size_t i = 0; i < kCount; i++) {
+        if (bounds[i].overlaps(box)) { expected.insert(i); }
+    }
+    tree.query(box, [&](x::EntityId entity) { found.insert(entity.value()); });
+    REQUIRE(found == expected);
+
+    const BoundingSphere sphere {glm::vec3(-20.f, 30.f, 0.f), 40.f};
+    expected.clear();
+    found.clear();
+    for (size_t i = 0; i < kCount; i++) {
+        if (intersects(bounds[i], sphere)) { expected.insert(i); }
+    }
+    tree.query(sphere, [&](x::EntityId entity) { found.insert(entity.value()); });
+    REQUIRE(found == expected);
+
+    const auto viewProjection =
+      glm::perspective(glm::radians(60.f), 16.f / 9.f, 0.1f, 150.f) *
+      glm::lookAt(glm::vec3(0.f, 0.f, 50.f), glm::vec3(0.f), glm::vec3(0.f, 1.f, 0.f));
+    const auto frustum = Frustum::fromMatrix(viewProjection);
+    expected.clear();
+    found.clear();
+    for (size_t i = 0; i < kCount; i++) {
+        if (intersects(frustum, bounds[i])) { expected.insert(i); }
+    }
+    tree.query(frustum, [&](x::EntityId entity) { found.insert(entity.value()); });
+    REQUIRE(found == expected);
+}
+
+TEST_CASE("DynamicAABBTree - Raycast finds closest hit", "[Math]") {
+    DynamicAABBTree tree(0.f);
+    for (i32 i = 0; i < 10; i++) {
+        const glm::vec3 center(0.f, 0.f, -10.f * CAST<f32>(i + 1));
+        tree.insert(x::EntityId(i), AABB::fromCenterExtents(center, glm::vec3(1.f)));
+    }
+
+    const Ray ray {glm::vec3(0.f), glm::vec3(0.f, 0.f, -1.f)};
+    x::EntityId closest;
+    f32 closestDistance = 1000.f;
+    tree.raycast(ray, closestDistance, [&](x::EntityId entity, f32 distance) {
+        if (distance < closestDistance) {
+            closestDistance = distance;
+            closest         = entity;
+        }
+        return closestDistance;
+    });
+    REQUIRE(closest == x::EntityId(0));
+    REQUIRE(std::abs(closestDistance - 9.f) < 1e-4f);
+}
+
+TEST_CASE("DynamicAABBTree - Axis aligned rays graze box faces", "[Math]") {
+    DynamicAABBTree tree(0.f);
+    const auto box = AABB::fromCenterExtents(glm::vec3(0.f, 0.f, -10.f), glm::vec3(1.f));
+    tree.insert(x::EntityId(0), box);
+
+    const auto hitDistance = [&](const Ray& ray) {
+        f32 hit = -1.f;
+        tree.raycast(ray, 1000.f, [&](x::EntityId, f32 distance) {
+            hit = distance;
+            return distance;
+        });
+        return hit;
+    };
+
+    // Origins on the planes of the slabs the rays run parallel to, with both signs of zero
+    REQUIRE(std::abs(hitDistance({glm::vec3(1.f, 0.f, 0.f), glm::vec3(0.f, 0.f, -1.f)}) - 9.f) <
+            1e-4f);
+    REQUIRE(std::abs(hitDistance({glm::vec3(-1.f, 1.f, 0.f), glm::vec3(-0.f, 0.f, -2.f)}) -
+                     4.5f) < 1e-4f);
+    REQUIRE(hitDistance({glm::vec3(1.f, -1.f, -20.f), glm::vec3(0.f, -0.f, 1.f)}) >= 0.f);
+    // Just outside a face
+    REQUIRE(hitDistance({glm::vec3(1.001f, 0.f, 0.f), glm::vec3(0.f, 0.f, -1.f)}) < 0.f);
+    REQUIRE(hitDistance({glm::vec3(0.f, -1.001f, 0.f), glm::vec3(-0.f, 0.f, -1.f)}) < 0.f);
+}
+
+TEST_CASE("DynamicAABBTree - Update, refit and remove", "[Math]") {
+    constexpr size_t kCount = 500;
+    auto bounds             = makeRandomBounds(kCount);
+
+    DynamicAABBTree tree(0.5f);
+    for (size_t i = 0; i < kCount; i++) {
+        tree.insert(x::EntityId(i), bounds[i]);
+    }
+
+    // Small moves stay inside the fat bounds
+    const glm::vec3 nudge(0.25f, 0.f, 0.f);
+    REQUIRE_FALSE(tree.update(x::EntityId(0), {bounds[0].min + nudge, bounds[0].max + nudge}));
+
+    std::vector<DynamicAABBTree::LeafUpdate> updates;
+    for (size_t i = 0; i < kCount; i += 2) {
+        const glm::vec3 offset(5.f, -3.f, 1.f);
+        bounds[i] = {bounds[i].min + offset, bounds[i].max + offset};
+        updates.push_back({x::EntityId(i), bounds[i]});
+    }
+    REQUIRE(tree.refit(updates) == updates.size());
+    REQUIRE(tree.validate());
+    for (size_t i = 0; i < kCount; i++) {
+        REQUIRE(tree.getFatBounds(x::EntityId(i))->contains(bounds[i]));
+    }
+
+    for (size_t i = 0; i < kCount; i += 3) {
+        tree.remove(x::EntityId(i));
+    }
+    REQUIRE(tree.validate());
+    REQUIRE_FALSE(tree.contains(x::EntityId(0)));
+    REQUIRE(tree.contains(x::EntityId(1)));
+}
+
+TEST_CASE("FrustumCuller - Matches scalar frustum test", "[Math]") {
+    constexpr size_t kCount = 1003;  // Not a multiple of the SIMD width
+    const auto bounds       = makeRandomBounds(kCount);
+
+    const auto viewProjection =
+      glm::perspective(glm::radians(60.f), 16.f / 9.f, 0.1f, 150.f) *
+      glm::lookAt(glm::vec3(0.f, 0.f, 50.f), glm::vec3(0.f), glm::vec3(0.f, 1.f, 0.f));
+    const auto frustum = Frustum::fromMatrix(viewProjection);
+
+    FrustumCuller culler;
+    culler.resize(kCount);
+    for (size_t i = 0; i < kCount; i++) {
+        culler.set(i, bounds[i]);
+    }
+    culler.setEmpty(7);
+
+    // Cull in uneven chunks, the way the render thread splits work
+    std::vector<u8> visible(kCount);
+    size_t count = 0;
+    for (size_t begin = 0; begin < kCount; begin += 250) {
+        const size_t end = std::min(begin + 250, kCount);
+        count += culler.cull(frustum, begin, end, &visible[begin]);
+    }
+
+    size_t expected = 0;
+    for (size_t i = 0; i < kCount; i++) {
+        const bool inside = i != 7 && intersects(frustum, bounds[i]);
+        REQUIRE(visible[i] == (inside ? 1 : 0));
+        expected += inside;
+    }
+    REQUIRE(count == expected);
+    REQUIRE(count > 0);
+    REQUIRE(count < kCount);
+}
+
+TEST_CASE("OcclusionBuffer - Hides boxes behind an occluder", "[Math]") {
+    const auto viewProjection =
+      glm::perspective(glm::radians(60.f), 2.f, 0.1f, 100.f) *
+      glm::lookAt(glm::vec3(0.f), glm::vec3(0.f, 0.f, -1.f), glm::vec3(0.f, 1.f, 0.f));
+
+    // A 4x4 wall, 5 units in front of the camera, wound clockwise on one triangle
+    const std::vector<glm::vec3> wall = {{-2.f, -2.f, 0.f},
+                                         {2.f, -2.f, 0.f},
+                                         {2.f, 2.f, 0.f},
+                                         {-2.f, 2.f, 0.f}};
+    const std::vector<u32> indices    = {0, 1, 2, 0, 3, 2};
+
+    OcclusionBuffer buffer;
+    buffer.begin(viewProjection);
+    buffer.addOccluder(wall, indices, AffineTransform::fromTRS({0.f, 0.f, -5.f}, {}, {1, 1, 1}));
+    REQUIRE(buffer.getTriangleCount() == 2);
+    // Tiles in any order, the way worker threads pick them up
+    for (u32 tile = OcclusionBuffer::kTileCount; tile-- > 0;) {
+        buffer.rasterizeTile(tile);
+    }
+
+    // Depth at the screen center matches the wall's projected depth
+    const glm::vec4 clip = viewProjection * glm::vec4(0.f, 0.f, -5.f, 1.f);
+    const f32 expected   = clip.z / clip.w * 0.5f + 0.5f;
+    REQUIRE(std::abs(buffer.getDepth(OcclusionBuffer::kWidth / 2, OcclusionBuffer::kHeight / 2) -
+                     expected) < 1e-4f);
+    REQUIRE(buffer.getDepth(0, 0) == 1.f);
+
+    const auto box = [](const glm::vec3& center, f32 extent) {
+        return AABB::fromCenterExtents(center, glm::vec3(extent));
+    };
+    REQUIRE_FALSE(buffer.isVisible(box({0.f, 0.f, -10.f}, 1.f)));  // Behind the wall
+    REQUIRE(buffer.isVisible(box({0.f, 0.f, -3.f}, 1.f)));         // In front of it
+    REQUIRE(buffer.isVisible(box({0.f, 0.f, -8.f}, 5.f)));         // Sticks out of its sides
+    REQUIRE(buffer.isVisible(box({8.f, 0.f, -10.f}, 1.f)));        // Beside it
+    REQUIRE(buffer.isVisible(box({0.f, 0.f, 0.f}, 1.f)));          // Crosses the near plane
+
+    // Without occluders everything on screen is visible
+    buffer.begin(viewProjection);
+    buffer.rasterize();
+    REQUIRE(buffer.getTriangleCount() == 0);
+    REQUIRE(buffer.isVisible(box({0.f, 0.f, -10.f}, 1.f)));
+}
+
+/// Maps world x and y straight to occlusion buffer pixels, looking down -z
+static glm::mat4 pixelProjection() {
+    return glm::ortho(0.f,
+                      CAST<f32>(OcclusionBuffer::kWidth),
+                      0.f,
+                      CAST<f32>(OcclusionBuffer::kHeight),
+                      0.1f,
+                      100.f);
+}
+
+/// Two triangles spanning [min, max] at depth z, wound clockwise on one of them
+static void addWall(OcclusionBuffer& buffer, const glm::vec2& min, const glm::vec2& max, f32 z) {
+    const std::vector<glm::vec3> wall = {{min.x, min.y, z},
+                                         {max.x, min.y, z},
+                                         {max.x, max.y, z},
+                                         {min.x, max.y, z}};
+    const std::vector<u32> indices    = {0, 1, 2, 0, 3, 2};
+    buffer.addOccluder(wall, indices, AffineTransform::identity());
+}
+
+TEST_CASE("OcclusionBuffer - Occluders only hide what they cover entirely", "[Math]") {
+    OcclusionBuffer buffer;
+    buffer.begin(pixelProjection());
+    addWall(buffer, {10.f, 10.f}, {150.7f, 100.f}, -5.f);
+    buffer.rasterize();
+
+    // Pixel 150 is mostly behind the wall, but not all of it
+    REQUIRE(buffer.getDepth(149, 50) < 1.f);
+    REQUIRE(buffer.getDepth(150, 50) == 1.f);
+    REQUIRE_FALSE(buffer.isVisible(AABB {{140.f, 20.f, -20.f}, {149.9f, 30.f, -10.f}}));
+    REQUIRE(buffer.isVisible(AABB {{140.f, 20.f, -20.f}, {150.9f, 30.f, -10.f}}));
+}
+
+TEST_CASE("OcclusionBuffer - Occluders are hidden only by other occluders", "[Math]") {
+    OcclusionBuffer buffer;
+    buffer.begin(pixelProjection());
+    // A wall framed by nearer walls that cover the pixels along its border
+    addWall(buffer, {50.f, 50.f}, {100.f, 100.f}, -10.f);
+    addWall(buffer, {40.f, 40.f}, {110.f, 52.f}, -5.f);
+    addWall(buffer, {40.f, 98.f}, {110.f, 110.f}, -5.f);
+    addWall(buffer, {40.f, 40.f}, {52.f, 110.f}, -5.f);
+    addWall(buffer, {98.f, 40.f}, {110.f, 110.f}, -5.f);
+    buffer.rasterize();
+    REQUIRE(buffer.isVisible(AABB {{50.f, 50.f, -10.f}, {100.f, 100.f, -10.f}}));
+    REQUIRE_FALSE(buffer.isVisible(AABB {{60.f, 60.f, -30.f}, {90.f, 90.f, -20.f}}));
+
+    // Behind a wall covering it entirely, it is
+    addWall(buffer, {20.f, 20.f}, {120.f, 120.f}, -2.f);
+    buffer.rasterize();
+    REQUIRE_FALSE(buffer.isVisible(AABB {{50.f, 50.f, -10.f}, {100.f, 100.f, -10.f}}));
+}
+
+TEST_CASE("OcclusionBuffer - Prepared occluders keep quads whole", "[Math]") {
+    // A quad split along a UV seam, with an unrelated triangle between its halves
+    std::vector<glm::vec3> vertices = {{10.f, 10.f, -5.f},
+                                       {200.f, 10.f, -5.f},
+                                       {200.f, 110.f, -5.f},
+                                       {10.f, 10.f, -5.f},
+                                       {200.f, 110.f, -5.f},
+                                       {10.f, 110.f, -5.f},
+                                       {220.f, 10.f, -5.f},
+                                       {240.f, 10.f, -5.f},
+                                       {230.f, 30.f, -5.f}};
+    std::vector<u32> indices        = {0, 1, 2, 6, 7, 8, 3, 4, 5};
+    const AABB behindDiagonal {{100.f, 55.f, -20.f}, {110.f, 65.f, -10.f}};
+
+    OcclusionBuffer buffer;
+    buffer.begin(pixelProjection());
+    buffer.addOccluder(vertices, indices, AffineTransform::identity());
+    buffer.rasterize();
+    // Pixels along the diagonal are split between the two triangles
+    REQUIRE(buffer.isVisible(behindDiagonal));
+
+    OcclusionBuffer::prepareOccluder(vertices, indices);
+    REQUIRE(vertices.size() == 7);
+    REQUIRE(indices.size() == 9);
+    buffer.begin(pixelProjection());
+    buffer.addOccluder(vertices, indices, AffineTransform::identity());
+    buffer.rasterize();
+    REQUIRE(buffer.getTriangleCount() == 3);
+    REQUIRE_FALSE(buffer.isVisible(behindDiagonal));
+}
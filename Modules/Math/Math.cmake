@@ -1,3 +1,28 @@
 set(MATH_SRCS
         ${MODULES}/Math/Random.inl
+        ${MODULES}/Math/AffineTransform.hpp
+        ${MODULES}/Math/AffineTransform.cpp
+        ${MODULES}/Math/Bounds.hpp
+        ${MODULES}/Math/Bounds.cpp
+        ${MODULES}/Math/DynamicAABBTree.hpp
+        ${MODULES}/Math/DynamicAABBTree.cpp
+        ${MODULES}/Math/FrustumCuller.hpp
+        ${MODULES}/Math/FrustumCuller.cpp
+        ${MODULES}/Math/OcclusionBuffer.hpp
+        ${MODULES}/Math/OcclusionBuffer.cpp
+)
+
+set(MATH_TESTS
+        ${MODULES}/Math/Math.Tests.cpp
+)
+
+add_executable(Tests.Math
+        ${MATH_SRCS}
+        ${MATH_TESTS}
+)
+
+find_package(Catch2 3 REQUIRED)
+target_link_libraries(Tests.Math PRIVATE
+        glm::glm-header-only
+        Catch2::Catch2WithMain
 )
\ No newline at end of file
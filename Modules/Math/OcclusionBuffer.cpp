@@ -0,0 +1,453 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "OcclusionBuffer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#ifdef __AVX2__
+    #define X_OCCLUSION_BUFFER_AVX2
+    #include <immintrin.h>
+#endif
+
+namespace x::Math {
+    static_assert(OcclusionBuffer::kWidth % OcclusionBuffer::kTileWidth == 0);
+    static_assert(OcclusionBuffer::kHeight % OcclusionBuffer::kTileHeight == 0);
+    static_assert(OcclusionBuffer::kTileWidth % 8 == 0, "Tile rows are filled 8 pixels at a time");
+
+    static constexpr f32 kClearDepth = 1.f;
+    // Covers rounding between an occluder's rasterized depth and the corners of its own bounds
+    static constexpr f32 kDepthBias = 1e-6f;
+
+    /// @brief If two triangles share exactly one edge, writes the quad they form to quad, in the
+    /// winding of the first with the shared edge as the diagonal from quad[0] to quad[2].
+    static bool findQuad(const u32* first, const u32* second, u32 quad[4]) {
+        if (first[0] == first[1] || first[1] == first[2] || first[2] == first[0]) { return false; }
+
+        const auto contains = [](const u32* triangle, u32 index) {
+            return triangle[0] == index || triangle[1] == index || triangle[2] == index;
+        };
+        i32 unshared = -1;
+        for (i32 i = 0; i < 3; i++) {
+            if (contains(second, first[i])) { continue; }
+            if (unshared >= 0) { return false; }
+            unshared = i;
+        }
+        if (unshared < 0) { return false; }
+
+        const u32 shared0 = first[(unshared + 1) % 3];
+        const u32 shared1 = first[(unshared + 2) % 3];
+        for (i32 i = 0; i < 3; i++) {
+            if (second[i] == shared0 || second[i] == shared1) { continue; }
+            quad[0] = shared0;
+            quad[1] = second[i];
+            quad[2] = shared1;
+            quad[3] = first[unshared];
+            return true;
+        }
+        return false;
+    }
+
+    OcclusionBuffer::OcclusionBuffer() : _depth(CAST<size_t>(kWidth) * kHeight, kClearDepth) {
+        std::fill_n(_tileMaxDepth, kTileCount, kClearDepth);
+    }
+
+    void OcclusionBuffer::begin(const glm::mat4& viewProjection) {
+        _viewProjection = viewProjection;
+        _polygons.clear();
+        _triangleCount = 0;
+        for (auto& bin : _bins) {
+            bin.clear();
+        }
+    }
+
+    void OcclusionBuffer::addOccluder(std::span<const glm::vec3> vertices,
+                                      std::span<const u32> indices,
+                                      const AffineTransform& transform) {
+        const glm::mat4 modelViewProjection = _viewProjection * transform.toMat4();
+
+        std::vector<glm::vec4> clip(vertices.size());
+        for (size_t i = 0; i < vertices.size(); i++) {
+            clip[i] = modelViewProjection * glm::vec4(vertices[i], 1.f);
+        }
+        const auto inRange = [&clip](const u32* triangle) {
+            return triangle[0] < clip.size() && triangle[1] < clip.size() &&
+                   triangle[2] < clip.size();
+        };
+
+        for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+            const u32* triangle = &indices[i];
+            if (!inRange(triangle)) { continue; }
+
+            // Two triangles making up a quad are rasterized as one, so the pixels along their
+            // shared edge, which neither covers alone, are still written
+            u32 quad[4];
+            if (i + 5 < indices.size() && inRange(triangle + 3) &&
+                findQuad(triangle, triangle + 3, quad)) {
+                const glm::vec4* corners[] = {
+                  &clip[quad[0]], &clip[quad[1]], &clip[quad[2]], &clip[quad[3]]};
+                if (addPolygon(corners)) {
+                    i += 3;
+                    continue;
+                }
+            }
+            const glm::vec4* corners[] = {
+              &clip[triangle[0]], &clip[triangle[1]], &clip[triangle[2]]};
+            addPolygon(corners);
+        }
+    }
+
+    void OcclusionBuffer::prepareOccluder(std::vector<glm::vec3>& vertices,
+                                          std::vector<u32>& indices) {
+        // Weld exact copies, such as vertices split along UV seams. Open addressing at under half
+        // load; slots hold unique vertex indices.
+        size_t capacity = 16;
+        while (capacity < vertices.size() * 2) {
+            capacity *= 2;
+        }
+        constexpr u32 kEmpty = ~0u;
+        std::vector<u32> table(capacity, kEmpty);
+        std::vector<u32> remap(vertices.size());
+
+        u32 uniqueCount = 0;
+        for (size_t i = 0; i < vertices.size(); i++) {
+            u32 bits[3];
+            std::memcpy(bits, &vertices[i], sizeof(bits));
+            size_t slot = (bits[0] * 73856093u ^ bits[1] * 19349663u ^ bits[2] * 83492791u) &
+                          (capacity - 1);
+            while (table[slot] != kEmpty &&
+                   std::memcmp(&vertices[table[slot]], &vertices[i], sizeof(glm::vec3)) != 0) {
+                slot = (slot + 1) & (capacity - 1);
+            }
+            if (table[slot] == kEmpty) {
+                // Compacting in place is safe, uniqueCount never passes i
+                vertices[uniqueCount] = vertices[i];
+                table[slot]           = uniqueCount++;
+            }
+            remap[i] = table[slot];
+        }
+        vertices.resize(uniqueCount);
+
+        std::vector<u32> triangles;
+        triangles.reserve(indices.size());
+        for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+            const u32 a = remap[indices[i]], b = remap[indices[i + 1]], c = remap[indices[i + 2]];
+            if (a == b || b == c || c == a) { continue; }
+            triangles.insert(triangles.end(), {a, b, c});
+        }
+
+        // Edges sorted by vertex pair, so the two triangles sharing an edge end up side by side
+        const u32 triangleCount = CAST<u32>(triangles.size() / 3);
+        std::vector<std::pair<u64, u32>> edges;
+        edges.reserve(triangles.size());
+        for (u32 t = 0; t < triangleCount; t++) {
+            for (u32 i = 0; i < 3; i++) {
+                const u32 from = triangles[t * 3 + i];
+                const u32 to   = triangles[t * 3 + (i + 1) % 3];
+                edges.emplace_back(CAST<u64>(std::min(from, to)) << 32 | std::max(from, to), t);
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+
+        const auto normal = [&](u32 t) {
+            const glm::vec3& a = vertices[triangles[t * 3]];
+            return glm::cross(vertices[triangles[t * 3 + 1]] - a,
+                              vertices[triangles[t * 3 + 2]] - a);
+        };
+        // Pairs flat, convex quads; addOccluder() checks again after projection
+        const auto mergeable = [&](u32 first, u32 second) {
+            u32 quad[4];
+            if (!findQuad(&triangles[first * 3], &triangles[second * 3], quad)) { return false; }
+            const glm::vec3 n1 = normal(first);
+            const glm::vec3 n2 = normal(second);
+            if (glm::dot(n1, n2) < 0.9999f * glm::length(n1) * glm::length(n2)) { return false; }
+            for (u32 i = 0; i < 4; i++) {
+                const glm::vec3& p0 = vertices[quad[i]];
+                const glm::vec3& p1 = vertices[quad[(i + 1) % 4]];
+                const glm::vec3& p2 = vertices[quad[(i + 2) % 4]];
+                if (glm::dot(glm::cross(p1 - p0, p2 - p1), n1) <= 0.f) { return false; }
+            }
+            return true;
+        };
+
+        constexpr u32 kUnpaired = ~0u;
+        std::vector<u32> partner(triangleCount, kUnpaired);
+        for (size_t i = 0; i + 1 < edges.size(); i++) {
+            // Only edges with exactly two triangles; anything else is not a plain surface
+            if (edges[i].first != edges[i + 1].first) { continue; }
+            const bool manifold = (i + 2 >= edges.size() || edges[i + 2].first != edges[i].first) &&
+                                  (i == 0 || edges[i - 1].first != edges[i].first);
+            const u32 first  = edges[i].second;
+            const u32 second = edges[i + 1].second;
+            if (manifold && first != second && partner[first] == kUnpaired &&
+                partner[second] == kUnpaired && mergeable(first, second)) {
+                partner[first]  = second;
+                partner[second] = first;
+            }
+        }
+
+        indices.clear();
+        indices.reserve(triangles.size());
+        std::vector<bool> emitted(triangleCount, false);
+        for (u32 t = 0; t < triangleCount; t++) {
+            for (const u32 next : {t, partner[t]}) {
+                if (next == kUnpaired || emitted[next]) { continue; }
+                indices.insert(indices.end(), &triangles[next * 3], &triangles[next * 3 + 3]);
+                emitted[next] = true;
+            }
+        }
+    }
+
+    bool OcclusionBuffer::addPolygon(std::span<const glm::vec4* const> clip) {
+        // In front of the near plane means -w <= z, which also guarantees a positive w
+        for (const auto* vertex : clip) {
+            if (vertex->w <= 1e-6f || vertex->z < -vertex->w) { return false; }
+        }
+
+        const u32 count = CAST<u32>(clip.size());
+        glm::vec3 screen[4];
+        for (u32 i = 0; i < count; i++) {
+            const f32 invW = 1.f / clip[i]->w;
+            screen[i].x    = (clip[i]->x * invW * 0.5f + 0.5f) * CAST<f32>(kWidth);
+            screen[i].y    = (clip[i]->y * invW * 0.5f + 0.5f) * CAST<f32>(kHeight);
+            screen[i].z    = clip[i]->z * invW * 0.5f + 0.5f;
+        }
+
+        // Occluders are drawn double sided, so flip clockwise polygons instead of culling them.
+        // Swapping the neighbors of the first vertex keeps a quad's diagonal from 0 to 2.
+        f32 area = (screen[1].x - screen[0].x) * (screen[2].y - screen[0].y) -
+                   (screen[2].x - screen[0].x) * (screen[1].y - screen[0].y);
+        if (std::abs(area) < 1e-6f) { return false; }
+        if (area < 0.f) {
+            std::swap(screen[1], screen[count - 1]);
+            area = -area;
+        }
+        if (count == 4) {
+            for (u32 i = 0; i < count; i++) {
+                const auto& p0 = screen[i];
+                const auto& p1 = screen[(i + 1) % count];
+                const auto& p2 = screen[(i + 2) % count];
+                if ((p1.x - p0.x) * (p2.y - p1.y) - (p2.x - p1.x) * (p1.y - p0.y) <= 0.f) {
+                    return false;
+                }
+            }
+        }
+
+        Polygon polygon;
+        f32 minX = screen[0].x, minY = screen[0].y, maxX = screen[0].x, maxY = screen[0].y;
+        for (u32 i = 1; i < count; i++) {
+            minX = std::min(minX, screen[i].x);
+            minY = std::min(minY, screen[i].y);
+            maxX = std::max(maxX, screen[i].x);
+            maxY = std::max(maxY, screen[i].y);
+        }
+        polygon.minX = std::max(0, CAST<i32>(std::floor(minX)));
+        polygon.minY = std::max(0, CAST<i32>(std::floor(minY)));
+        polygon.maxX = std::min(CAST<i32>(kWidth) - 1, CAST<i32>(std::floor(maxX)));
+        polygon.maxY = std::min(CAST<i32>(kHeight) - 1, CAST<i32>(std::floor(maxY)));
+        if (polygon.minX > polygon.maxX || polygon.minY > polygon.maxY) { return false; }
+
+        // The depth plane of the triangle (0, 1, 2) is raised to its farthest value over a
+        // pixel. A quad's other triangle (0, 2, 3) differs from it by at most the depth of
+        // vertex 3 above the plane, which raises it further; too bent and it is two triangles.
+        const glm::vec3 d1 = screen[1] - screen[0];
+        const glm::vec3 d2 = screen[2] - screen[0];
+        polygon.depthA     = (d1.z * d2.y - d2.z * d1.y) / area;
+        polygon.depthB     = (d2.z * d1.x - d1.z * d2.x) / area;
+        polygon.depthC =
+          screen[0].z - polygon.depthA * screen[0].x - polygon.depthB * screen[0].y;
+        const f32 pixelRaise = 0.5f * (std::abs(polygon.depthA) + std::abs(polygon.depthB));
+        if (count == 4) {
+            const f32 bend = screen[3].z - (polygon.depthA * screen[3].x +
+                                            polygon.depthB * screen[3].y + polygon.depthC);
+            if (bend > pixelRaise + kDepthBias) { return false; }
+            polygon.depthC += std::max(bend, 0.f);
+        }
+        polygon.depthC += pixelRaise;
+
+        // Edge i runs from vertex i to vertex i + 1 and is positive on the inside. Each edge is
+        // moved inwards by half a pixel along both axes, so a pixel center passes only if the
+        // whole pixel is inside. Triangles leave the fourth edge at 0, which always passes.
+        for (u32 i = 0; i < 4; i++) {
+            if (i >= count) {
+                polygon.edgeA[i] = polygon.edgeB[i] = polygon.edgeC[i] = 0.f;
+                continue;
+            }
+            const auto& from = screen[i];
+            const auto& to   = screen[(i + 1) % count];
+            polygon.edgeA[i] = from.y - to.y;
+            polygon.edgeB[i] = to.x - from.x;
+            polygon.edgeC[i] = from.x * to.y - from.y * to.x -
+                               0.5f * (std::abs(polygon.edgeA[i]) + std::abs(polygon.edgeB[i]));
+        }
+
+        const u32 index = CAST<u32>(_polygons.size());
+        _polygons.push_back(polygon);
+        _triangleCount += count - 2;
+        for (u32 ty = polygon.minY / kTileHeight; ty <= polygon.maxY / kTileHeight; ty++) {
+            for (u32 tx = polygon.minX / kTileWidth; tx <= polygon.maxX / kTileWidth; tx++) {
+                _bins[ty * kTilesX + tx].push_back(index);
+            }
+        }
+        return true;
+    }
+
+    void OcclusionBuffer::rasterizeTile(u32 tile) {
+        const i32 tileMinX = CAST<i32>(tile % kTilesX * kTileWidth);
+        const i32 tileMinY = CAST<i32>(tile / kTilesX * kTileHeight);
+        const i32 tileMaxX = tileMinX + CAST<i32>(kTileWidth) - 1;
+        const i32 tileMaxY = tileMinY + CAST<i32>(kTileHeight) - 1;
+
+        for (i32 y = tileMinY; y <= tileMaxY; y++) {
+            std::fill_n(&_depth[CAST<size_t>(y) * kWidth + tileMinX], kTileWidth, kClearDepth);
+        }
+        for (const u32 index : _bins[tile]) {
+            const auto& polygon = _polygons[index];
+            rasterizePolygon(polygon,
+                             std::max(polygon.minX, tileMinX),
+                             std::max(polygon.minY, tileMinY),
+                             std::min(polygon.maxX, tileMaxX),
+                             std::min(polygon.maxY, tileMaxY));
+        }
+
+        f32 maxDepth = 0.f;
+        for (i32 y = tileMinY; y <= tileMaxY; y++) {
+            const f32* row = &_depth[CAST<size_t>(y) * kWidth + tileMinX];
+            maxDepth       = std::max(maxDepth, *std::max_element(row, row + kTileWidth));
+        }
+        _tileMaxDepth[tile] = maxDepth;
+    }
+
+    void OcclusionBuffer::rasterize() {
+        for (u32 tile = 0; tile < kTileCount; tile++) {
+            rasterizeTile(tile);
+        }
+    }
+
+    void OcclusionBuffer::rasterizePolygon(
+      const Polygon& polygon, i32 minX, i32 minY, i32 maxX, i32 maxY) {
+        // Pixel centers are tested against the inset edges, so only pixels the polygon covers
+        // entirely are written. A pixel split between polygons keeps its depth, which costs some
+        // occlusion along their edges but never hides anything in view.
+#ifdef X_OCCLUSION_BUFFER_AVX2
+        // Tile edges are multiples of 8, so widening the span to 8 pixel blocks stays in the tile
+        const i32 startX  = minX & ~7;
+        const __m256 lane = _mm256_setr_ps(0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f);
+        const __m256 zero = _mm256_setzero_ps();
+        __m256 edgeA[4];
+        for (i32 i = 0; i < 4; i++) {
+            edgeA[i] = _mm256_set1_ps(polygon.edgeA[i]);
+        }
+        const __m256 depthA = _mm256_set1_ps(polygon.depthA);
+
+        for (i32 y = minY; y <= maxY; y++) {
+            const f32 py = CAST<f32>(y) + 0.5f;
+            __m256 edgeRow[4];
+            for (i32 i = 0; i < 4; i++) {
+                edgeRow[i] = _mm256_set1_ps(polygon.edgeB[i] * py + polygon.edgeC[i]);
+            }
+            const __m256 depthRow = _mm256_set1_ps(polygon.depthB * py + polygon.depthC);
+            f32* row              = &_depth[CAST<size_t>(y) * kWidth];
+
+            for (i32 x = startX; x <= maxX; x += 8) {
+                const __m256 px = _mm256_add_ps(_mm256_set1_ps(CAST<f32>(x)), lane);
+                __m256 inside   = _mm256_cmp_ps(
+                  _mm256_add_ps(_mm256_mul_ps(edgeA[0], px), edgeRow[0]), zero, _CMP_GE_OQ);
+                for (i32 i = 1; i < 4; i++) {
+                    const __m256 edge = _mm256_add_ps(_mm256_mul_ps(edgeA[i], px), edgeRow[i]);
+                    inside = _mm256_and_ps(inside, _mm256_cmp_ps(edge, zero, _CMP_GE_OQ));
+                }
+                if (_mm256_movemask_ps(inside) == 0) { continue; }
+
+                const __m256 depth   = _mm256_add_ps(_mm256_mul_ps(depthA, px), depthRow);
+                const __m256 current = _mm256_loadu_ps(row + x);
+                const __m256 nearest = _mm256_min_ps(current, depth);
+                _mm256_storeu_ps(row + x, _mm256_blendv_ps(current, nearest, inside));
+            }
+        }
+#else
+        for (i32 y = minY; y <= maxY; y++) {
+            const f32 py = CAST<f32>(y) + 0.5f;
+            f32* row     = &_depth[CAST<size_t>(y) * kWidth];
+            for (i32 x = minX; x <= maxX; x++) {
+                const f32 px = CAST<f32>(x) + 0.5f;
+                bool inside  = true;
+                for (i32 i = 0; i < 4 && inside; i++) {
+                    inside =
+                      polygon.edgeA[i] * px + polygon.edgeB[i] * py + polygon.edgeC[i] >= 0.f;
+                }
+                if (!inside) { continue; }
+
+                const f32 depth = polygon.depthA * px + polygon.depthB * py + polygon.depthC;
+                row[x]          = std::min(row[x], depth);
+            }
+        }
+#endif
+    }
+
+    bool OcclusionBuffer::isVisible(const AABB& worldBounds) const {
+        if (!worldBounds.valid()) { return false; }
+
+        f32 minX = std::numeric_limits<f32>::max(), maxX = std::numeric_limits<f32>::lowest();
+        f32 minY = minX, maxY = maxX;
+        f32 nearestDepth = minX;
+        for (i32 corner = 0; corner < 8; corner++) {
+            const glm::vec4 point((corner & 1) ? worldBounds.max.x : worldBounds.min.x,
+                                  (corner & 2) ? worldBounds.max.y : worldBounds.min.y,
+                                  (corner & 4) ? worldBounds.max.z : worldBounds.min.z,
+                                  1.f);
+            const glm::vec4 clip = _viewProjection * point;
+            if (clip.w <= 1e-6f || clip.z < -clip.w) { return true; }
+
+            const f32 invW = 1.f / clip.w;
+            const f32 x    = (clip.x * invW * 0.5f + 0.5f) * CAST<f32>(kWidth);
+            const f32 y    = (clip.y * invW * 0.5f + 0.5f) * CAST<f32>(kHeight);
+            minX           = std::min(minX, x);
+            maxX           = std::max(maxX, x);
+            minY           = std::min(minY, y);
+            maxY           = std::max(maxY, y);
+            nearestDepth   = std::min(nearestDepth, clip.z * invW * 0.5f + 0.5f);
+        }
+        // An occluder tested against its own depth must never come out hidden
+        nearestDepth -= kDepthBias;
+
+        // Every pixel the rectangle touches, even partially. Occluders only write pixels they
+        // cover entirely, at their farthest depth, so any part of the box in front shows.
+        const i32 x0 = std::max(0, CAST<i32>(std::floor(minX)));
+        const i32 y0 = std::max(0, CAST<i32>(std::floor(minY)));
+        const i32 x1 = std::min(CAST<i32>(kWidth) - 1, CAST<i32>(std::floor(maxX)));
+        const i32 y1 = std::min(CAST<i32>(kHeight) - 1, CAST<i32>(std::floor(maxY)));
+        if (x0 > x1 || y0 > y1) { return false; }
+
+        for (i32 ty = y0 / CAST<i32>(kTileHeight); ty <= y1 / CAST<i32>(kTileHeight); ty++) {
+            for (i32 tx = x0 / CAST<i32>(kTileWidth); tx <= x1 / CAST<i32>(kTileWidth); tx++) {
+                // The whole tile is nearer than the box, no need to look at its pixels
+                if (_tileMaxDepth[ty * kTilesX + tx] < nearestDepth) { continue; }
+
+                const i32 minTileX = std::max(x0, tx * CAST<i32>(kTileWidth));
+                const i32 maxTileX = std::min(x1, (tx + 1) * CAST<i32>(kTileWidth) - 1);
+                const i32 minTileY = std::max(y0, ty * CAST<i32>(kTileHeight));
+                const i32 maxTileY = std::min(y1, (ty + 1) * CAST<i32>(kTileHeight) - 1);
+                for (i32 y = minTileY; y <= maxTileY; y++) {
+                    const f32* row = &_depth[CAST<size_t>(y) * kWidth];
+                    for (i32 x = minTileX; x <= maxTileX; x++) {
+                        if (row[x] >= nearestDepth) { return true; }
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+    f32 OcclusionBuffer::getDepth(u32 x, u32 y) const {
+        return _depth[CAST<size_t>(y) * kWidth + x];
+    }
+
+    size_t OcclusionBuffer::getTriangleCount() const {
+        return _triangleCount;
+    }
+}  // namespace x::Math
@@ -0,0 +1,85 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "Bounds.hpp"
+
+#include <span>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace x::Math {
+    /// @brief Low resolution software depth buffer used to reject renderables hidden behind
+    /// occluders before they reach the GPU.
+    ///
+    /// Usage per frame: begin() with the camera's (projection * view) matrix, addOccluder() for
+    /// each occluder mesh, rasterizeTile() for every tile, then isVisible() for candidates.
+    /// addOccluder() sets triangles up and bins them into screen tiles; each tile owns its own
+    /// part of the depth buffer, so different tiles can be rasterized from different threads.
+    /// Rows are filled eight pixels at a time with AVX2 when the compiler targets it.
+    ///
+    /// Depth is window space [0, 1] with 1 being the far plane. Occluders only write pixels they
+    /// cover entirely, at the farthest depth they reach over the pixel, so a box is only ever
+    /// hidden behind actual occluder surface. Occluder triangles crossing the near plane are
+    /// dropped rather than clipped, which likewise only makes the buffer less occluding.
+    class OcclusionBuffer {
+    public:
+        static constexpr u32 kWidth      = 256;
+        static constexpr u32 kHeight     = 128;
+        static constexpr u32 kTileWidth  = 64;
+        static constexpr u32 kTileHeight = 32;
+        static constexpr u32 kTilesX     = kWidth / kTileWidth;
+        static constexpr u32 kTilesY     = kHeight / kTileHeight;
+        static constexpr u32 kTileCount  = kTilesX * kTilesY;
+
+        OcclusionBuffer();
+
+        /// @brief Drops the previous frame's occluders.
+        void begin(const glm::mat4& viewProjection);
+        /// @brief Bins an indexed triangle list, given in model space. Two consecutive triangles
+        /// sharing an edge are binned as one quad if they still form a flat, convex one on
+        /// screen, so the pixels along that edge are not lost; see prepareOccluder().
+        void addOccluder(std::span<const glm::vec3> vertices,
+                         std::span<const u32> indices,
+                         const AffineTransform& transform);
+        /// @brief Welds vertices at identical positions, drops degenerate triangles and orders
+        /// the rest so that neighbors forming a flat, convex quad come in pairs. Run once per
+        /// occluder mesh, before handing it to addOccluder().
+        static void prepareOccluder(std::vector<glm::vec3>& vertices, std::vector<u32>& indices);
+        /// @brief Clears the tile and rasterizes the triangles binned to it.
+        void rasterizeTile(u32 tile);
+        /// @brief Rasterizes every tile on the calling thread.
+        void rasterize();
+
+        /// @brief False only if every pixel the box covers is behind an occluder. Boxes crossing
+        /// the near plane are always visible; boxes entirely off screen never are.
+        [[nodiscard]] bool isVisible(const AABB& worldBounds) const;
+        [[nodiscard]] f32 getDepth(u32 x, u32 y) const;
+        /// @brief Number of occluder triangles that survived setup since begin()
+        [[nodiscard]] size_t getTriangleCount() const;
+
+    private:
+        /// @brief Screen space edge functions and depth plane of a triangle or of a quad made of
+        /// two, wound counter-clockwise
+        struct Polygon {
+            f32 edgeA[4], edgeB[4], edgeC[4];
+            f32 depthA, depthB, depthC;
+            i32 minX, minY, maxX, maxY;  // Pixel bounds, clamped to the screen
+        };
+
+        glm::mat4 _viewProjection {1.f};
+        std::vector<Polygon> _polygons;
+        size_t _triangleCount = 0;
+        std::vector<u32> _bins[kTileCount];
+        std::vector<f32> _depth;
+        f32 _tileMaxDepth[kTileCount];
+
+        /// @brief Sets up a triangle, or a quad given as four corners with the diagonal from the
+        /// first to the third. False if the polygon is dropped; a quad then needs splitting.
+        bool addPolygon(std::span<const glm::vec4* const> clip);
+        void rasterizePolygon(const Polygon& polygon, i32 minX, i32 minY, i32 maxX, i32 maxY);
+    };
+}  // namespace x::Math
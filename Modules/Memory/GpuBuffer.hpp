@@ -5,8 +5,14 @@
 #pragma once
 
 #include "Types.hpp"
+#include "Panic.hpp"
 #include "Context.hpp"
 #include "Graphics/DebugOpenGL.hpp"
+#include "Graphics/GLState.hpp"
+#include "Graphics/RenderStats.hpp"
+
+#include <algorithm>
+#include <vector>
 
 namespace x::Memory {
     enum GpuBufferType {
@@ -29,21 +35,41 @@ namespace x::Memory {
                          data.data(),
                          dynamic ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
             CHECK_GL_ERROR();
+            Graphics::RenderStats::current().recordUpload(_size);
         }
 
         ~GpuBuffer() {
             glDeleteBuffers(1, &_id);
             CHECK_GL_ERROR();
+            Graphics::GLState::current().forgetBuffer(_id);
         }
 
         void bind() const {
-            glBindBuffer(getTarget(), _id);
-            CHECK_GL_ERROR();
+            Graphics::GLState::current().bindBuffer(getTarget(), _id);
+        }
+
+        /// @brief Binds the buffer to an indexed target (uniform blocks, shader storage)
+        void bindBase(u32 index) const {
+            Graphics::GLState::current().bindBufferBase(getTarget(), index, _id);
         }
 
-        void updateData(const void* data, size_t offset = 0) const {
-            glBufferSubData(getTarget(), offset, _size, data);
+        /// @brief Uploads size bytes to [offset, offset + size). A size of 0 updates everything
+        /// from offset to the end of the buffer. Data rewritten every frame belongs in a
+        /// Graphics::StreamingBuffer instead, which never waits on the GPU.
+        void updateData(const void* data, size_t offset = 0, size_t size = 0) const {
+            if (size == 0) { size = _size - std::min(offset, _size); }
+            if (offset + size > _size) { Panic("GpuBuffer update out of range"); }
+            glNamedBufferSubData(_id, CAST<GLintptr>(offset), CAST<GLsizeiptr>(size), data);
             CHECK_GL_ERROR();
+            Graphics::RenderStats::current().recordUpload(size);
+        }
+
+        void updateElement(size_t index, const T& value) const {
+            updateData(&value, index * sizeof(T), sizeof(T));
+        }
+
+        [[nodiscard]] size_t getSize() const {
+            return _size;
         }
 
         u32 getId() const {
@@ -4,8 +4,11 @@
 
 #include "PoolAllocator.hpp"
 #include "ArenaAllocator.hpp"
+#include "OffsetAllocator.hpp"
 
 #include <iostream>
+#include <random>
+#include <vector>
 #include <catch2/catch_test_macros.hpp>
 
 using namespace x::Memory;
@@ -68,4 +71,75 @@ TEST_CASE("Arena Allocator", "[Memory]") {
 
     arena.reset();
     REQUIRE(arena.getOffset() == 0);
-}
\ No newline at end of file
+}
+
+TEST_CASE("Offset Allocator", "[Memory]") {
+    OffsetAllocator allocator(100);
+    REQUIRE(allocator.getCapacity() == 100);
+
+    const auto a = allocator.allocate(30);
+    const auto b = allocator.allocate(30);
+    const auto c = allocator.allocate(30);
+    REQUIRE(a.offset == 0);
+    REQUIRE(b.offset == 30);
+    REQUIRE(c.offset == 60);
+    REQUIRE(allocator.getUsed() == 90);
+    REQUIRE_FALSE(allocator.allocate(20).valid());
+
+    // Freed neighbours merge back into a single range
+    allocator.free(a);
+    allocator.free(c);
+    REQUIRE(allocator.getFreeRangeCount() == 2);
+    allocator.free(b);
+    REQUIRE(allocator.getFreeRangeCount() == 1);
+    REQUIRE(allocator.getLargestFreeRange() == 100);
+    REQUIRE(allocator.getUsed() == 0);
+
+    // Best fit picks the smallest range that is large enough
+    const auto big   = allocator.allocate(50);
+    const auto gap   = allocator.allocate(10);
+    const auto small = allocator.allocate(5);
+    allocator.free(big);
+    allocator.free(small);
+    REQUIRE(allocator.allocate(4).offset == small.offset);
+
+    // Growing extends the free range at the end
+    allocator.grow(200);
+    REQUIRE(allocator.getCapacity() == 200);
+    REQUIRE(allocator.allocate(130).offset == gap.offset + gap.size + 4);
+}
+
+TEST_CASE("Offset Allocator - Random allocations never overlap", "[Memory]") {
+    constexpr u32 kCapacity = 4096;
+    OffsetAllocator allocator(kCapacity);
+    std::vector<OffsetAllocator::Allocation> live;
+    std::vector<u8> owned(kCapacity, 0);
+
+    std::mt19937 random(3);
+    for (i32 i = 0; i < 10000; i++) {
+        if (live.empty() || random() % 3 != 0) {
+            const auto allocation = allocator.allocate(1 + random() % 64);
+            if (!allocation.valid()) { continue; }
+            for (u32 j = allocation.offset; j < allocation.offset + allocation.size; j++) {
+                REQUIRE(owned[j] == 0);
+                owned[j] = 1;
+            }
+            live.push_back(allocation);
+        } else {
+            const size_t index = random() % live.size();
+            for (u32 j = live[index].offset; j < live[index].offset + live[index].size; j++) {
+                owned[j] = 0;
+            }
+            allocator.free(live[index]);
+            live[index] = live.back();
+            live.pop_back();
+        }
+    }
+
+    for (const auto& allocation : live) {
+        allocator.free(allocation);
+    }
+    REQUIRE(allocator.getUsed() == 0);
+    REQUIRE(allocator.getFreeRangeCount() == 1);
+    REQUIRE(allocator.getLargestFreeRange() == kCapacity);
+}
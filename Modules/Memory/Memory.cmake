@@ -3,6 +3,8 @@ set(MEMORY_SRCS
         ${MODULES}/Memory/PoolAllocator.cpp
         ${MODULES}/Memory/ArenaAllocator.hpp
         ${MODULES}/Memory/ArenaAllocator.cpp
+        ${MODULES}/Memory/OffsetAllocator.hpp
+        ${MODULES}/Memory/OffsetAllocator.cpp
         ${MODULES}/Memory/GpuBuffer.hpp
 )
 
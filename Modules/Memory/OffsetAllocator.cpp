@@ -0,0 +1,114 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "OffsetAllocator.hpp"
+#include "Panic.hpp"
+
+namespace x::Memory {
+    OffsetAllocator::OffsetAllocator(u32 capacity) : _capacity(capacity) {
+        if (capacity > 0) { insertFree(0, capacity); }
+    }
+
+    OffsetAllocator::Allocation OffsetAllocator::allocate(u32 size) {
+        if (size == 0) { Panic("allocate() called with invalid size (0)!"); }
+
+        const auto best = _freeBySize.lower_bound(size);
+        if (best == _freeBySize.end()) { return {}; }
+
+        const u32 offset    = best->second;
+        const u32 rangeSize = best->first;
+        eraseFree(_freeByOffset.find(offset));
+        // Allocate from the front of the range; whatever is left stays free
+        if (rangeSize > size) { insertFree(offset + size, rangeSize - size); }
+
+        _used += size;
+        return {offset, size};
+    }
+
+    void OffsetAllocator::free(const Allocation& allocation) {
+        if (!allocation.valid() || allocation.size == 0) { return; }
+        if (allocation.offset + allocation.size > _capacity) {
+            Panic("free() called with a range outside of the allocator!");
+        }
+
+        u32 offset = allocation.offset;
+        u32 size   = allocation.size;
+
+        // Merge with the free range directly after this one
+        auto next = _freeByOffset.lower_bound(offset);
+        if (next != _freeByOffset.end() && next->first < offset + size) {
+            Panic("free() called with a range that is already free!");
+        }
+        if (next != _freeByOffset.end() && next->first == offset + size) {
+            size += next->second;
+            next = std::next(next);
+            eraseFree(std::prev(next));
+        }
+
+        // And with the one directly before it
+        if (next != _freeByOffset.begin()) {
+            const auto previous = std::prev(next);
+            if (previous->first + previous->second > allocation.offset) {
+                Panic("free() called with a range that is already free!");
+            }
+            if (previous->first + previous->second == offset) {
+                offset = previous->first;
+                size += previous->second;
+                eraseFree(previous);
+            }
+        }
+
+        insertFree(offset, size);
+        _used -= allocation.size;
+    }
+
+    void OffsetAllocator::grow(u32 capacity) {
+        if (capacity <= _capacity) { return; }
+
+        u32 offset = _capacity;
+        u32 size   = capacity - _capacity;
+        if (!_freeByOffset.empty()) {
+            const auto last = std::prev(_freeByOffset.end());
+            if (last->first + last->second == _capacity) {
+                offset = last->first;
+                size += last->second;
+                eraseFree(last);
+            }
+        }
+        insertFree(offset, size);
+        _capacity = capacity;
+    }
+
+    u32 OffsetAllocator::getCapacity() const {
+        return _capacity;
+    }
+
+    u32 OffsetAllocator::getUsed() const {
+        return _used;
+    }
+
+    u32 OffsetAllocator::getLargestFreeRange() const {
+        return _freeBySize.empty() ? 0 : std::prev(_freeBySize.end())->first;
+    }
+
+    size_t OffsetAllocator::getFreeRangeCount() const {
+        return _freeByOffset.size();
+    }
+
+    void OffsetAllocator::insertFree(u32 offset, u32 size) {
+        _freeByOffset.emplace(offset, size);
+        _freeBySize.emplace(size, offset);
+    }
+
+    void OffsetAllocator::eraseFree(std::map<u32, u32>::iterator range) {
+        auto [first, last] = _freeBySize.equal_range(range->second);
+        for (; first != last; ++first) {
+            if (first->second == range->first) {
+                _freeBySize.erase(first);
+                break;
+            }
+        }
+        _freeByOffset.erase(range);
+    }
+}  // namespace x::Memory
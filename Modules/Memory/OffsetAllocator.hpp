@@ -0,0 +1,54 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+
+#include <limits>
+#include <map>
+
+namespace x::Memory {
+    /// @brief Hands out ranges of an externally owned resource, such as a GPU buffer, in
+    /// abstract units (bytes, vertices, indices...). Never touches the memory itself.
+    ///
+    /// Free ranges are kept ordered by offset, to merge neighbours on free(), and by size, so
+    /// allocate() picks the best fit in O(log n).
+    class OffsetAllocator {
+    public:
+        static constexpr u32 kInvalidOffset = std::numeric_limits<u32>::max();
+
+        struct Allocation {
+            u32 offset = kInvalidOffset;
+            u32 size   = 0;
+
+            [[nodiscard]] bool valid() const {
+                return offset != kInvalidOffset;
+            }
+        };
+
+        explicit OffsetAllocator(u32 capacity);
+
+        /// @brief Returns an invalid allocation if no free range is large enough.
+        [[nodiscard]] Allocation allocate(u32 size);
+        void free(const Allocation& allocation);
+        /// @brief Extends the managed range. The new space is appended to the end, so existing
+        /// allocations stay where they are.
+        void grow(u32 capacity);
+
+        [[nodiscard]] u32 getCapacity() const;
+        [[nodiscard]] u32 getUsed() const;
+        [[nodiscard]] u32 getLargestFreeRange() const;
+        [[nodiscard]] size_t getFreeRangeCount() const;
+
+    private:
+        std::map<u32, u32> _freeByOffset;     // offset -> size
+        std::multimap<u32, u32> _freeBySize;  // size -> offset
+        u32 _capacity;
+        u32 _used = 0;
+
+        void insertFree(u32 offset, u32 size);
+        void eraseFree(std::map<u32, u32>::iterator range);
+    };
+}  // namespace x::Memory
@@ -0,0 +1,34 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "ThreadPool.hpp"
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace x::Thread;
+
+TEST_CASE("ThreadPool - Runs submitted tasks", "[Thread]") {
+    ThreadPool pool(4);
+    REQUIRE(pool.getThreadCount() == 4);
+
+    std::vector<std::future<i32>> results;
+    for (i32 i = 0; i < 100; i++) {
+        results.push_back(pool.submit([i]() { return i * i; }));
+    }
+    for (i32 i = 0; i < 100; i++) {
+        REQUIRE(results[i].get() == i * i);
+    }
+}
+
+TEST_CASE("ThreadPool - Drains queue on destruction", "[Thread]") {
+    std::atomic<i32> counter = 0;
+    {
+        ThreadPool pool(2);
+        for (i32 i = 0; i < 1000; i++) {
+            pool.submit([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); });
+        }
+    }
+    REQUIRE(counter.load() == 1000);
+}
@@ -0,0 +1,18 @@
+set(THREAD_SRCS
+        ${MODULES}/Thread/ThreadPool.hpp
+        ${MODULES}/Thread/ThreadPool.cpp
+)
+
+set(THREAD_TESTS
+        ${MODULES}/Thread/Thread.Tests.cpp
+)
+
+add_executable(Tests.Thread
+        ${THREAD_SRCS}
+        ${THREAD_TESTS}
+)
+
+find_package(Catch2 3 REQUIRED)
+target_link_libraries(Tests.Thread PRIVATE
+        Catch2::Catch2WithMain
+)
\ No newline at end of file
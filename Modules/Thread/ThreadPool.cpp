@@ -0,0 +1,50 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+
+namespace x::Thread {
+    ThreadPool::ThreadPool(u32 threadCount) {
+        if (threadCount == 0) {
+            const u32 hardwareThreads = std::thread::hardware_concurrency();
+            threadCount               = std::max(hardwareThreads, 2u) - 1;
+        }
+
+        _workers.reserve(threadCount);
+        for (u32 i = 0; i < threadCount; i++) {
+            _workers.emplace_back(&ThreadPool::workerLoop, this);
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard lock(_mutex);
+            _stopping = true;
+        }
+        _condition.notify_all();
+        for (auto& worker : _workers) {
+            if (worker.joinable()) { worker.join(); }
+        }
+    }
+
+    u32 ThreadPool::getThreadCount() const {
+        return CAST<u32>(_workers.size());
+    }
+
+    void ThreadPool::workerLoop() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(_mutex);
+                _condition.wait(lock, [this]() { return _stopping || !_tasks.empty(); });
+                if (_tasks.empty()) { return; }  // Only reachable while stopping
+                task = std::move(_tasks.front());
+                _tasks.pop_front();
+            }
+            task();
+        }
+    }
+}  // namespace x::Thread
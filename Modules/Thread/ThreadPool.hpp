@@ -0,0 +1,61 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace x::Thread {
+    /// @brief Fixed set of worker threads pulling tasks from a shared FIFO queue.
+    ///
+    /// Tasks still queued when the pool is destroyed are run before the workers are joined, so
+    /// futures handed out by submit() are always eventually satisfied.
+    class ThreadPool {
+    public:
+        /// @param threadCount Number of workers. 0 uses one less than the hardware thread count
+        /// (leaving a core for the caller), with a minimum of one.
+        explicit ThreadPool(u32 threadCount = 0);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&)            = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        template<typename Func>
+        auto submit(Func&& func) -> std::future<std::invoke_result_t<Func>>;
+
+        [[nodiscard]] u32 getThreadCount() const;
+
+    private:
+        std::vector<std::thread> _workers;
+        std::deque<std::function<void()>> _tasks;
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        bool _stopping = false;
+
+        void workerLoop();
+    };
+
+    template<typename Func>
+    auto ThreadPool::submit(Func&& func) -> std::future<std::invoke_result_t<Func>> {
+        using ReturnType = std::invoke_result_t<Func>;
+        // std::function must be copyable, packaged_task isn't
+        auto task = std::make_shared<std::packaged_task<ReturnType()>>(std::forward<Func>(func));
+        std::future<ReturnType> future = task->get_future();
+        {
+            std::lock_guard lock(_mutex);
+            _tasks.emplace_back([task]() { (*task)(); });
+        }
+        _condition.notify_one();
+        return future;
+    }
+}  // namespace x::Thread
@@ -3,15 +3,35 @@
 //
 
 #include "Game.hpp"
+#include "ModelManager.hpp"
+#include "OpenGLBackend.hpp"
 #include "PBRMaterial.hpp"
 #include "PerspectiveCamera.hpp"
+#include "Prefab.hpp"
+#include "Profiler.hpp"
+#include "RenderCuller.hpp"
 #include "Scene.hpp"
+#include "ShaderManager.hpp"
 #include "Filesystem/Filesystem.hpp"
+#include "Graphics/DebugUI.hpp"
+#include "Graphics/GLState.hpp"
+#include "Graphics/OpenGLGraphBackend.hpp"
 #include "Graphics/Pipeline.hpp"
 #include "Graphics/PostProcessQuad.hpp"
+#include "Graphics/RenderGraph.hpp"
+#include "Graphics/RenderQueue.hpp"
+#include "Graphics/RenderStats.hpp"
 #include "Graphics/RenderTarget.hpp"
 #include "Graphics/Effects/Tonemapper.hpp"
-
+#include "Graphics/Shaders/Include/PBR_FS.h"
+#include "Graphics/Shaders/Include/PBR_Instanced_VS.h"
+#include "Graphics/Shaders/Include/PBR_VS.h"
+#include "Graphics/Shaders/Include/Quad_FS.h"
+#include "Graphics/Shaders/Include/Quad_VS.h"
+#include "Graphics/Shaders/Include/TonemapFXAA_CS.h"
+#include "Graphics/Shaders/Include/Tonemapper_CS.h"
+
+#include <atomic>
 #include <imgui/imgui.h>
 
 using namespace x::Filesystem;
@@ -43,45 +63,63 @@ public:
     void onMouseUp(u16 button, i32 x, i32 y) override;
 
 private:
+    static constexpr f64 kProfilerWindow = 50000.0;  // us
+    static constexpr i32 kRenderWidth    = 1600;
+    static constexpr i32 kRenderHeight   = 900;
+
     x::PerspectiveCamera _camera;
     x::ModelHandle _model;
     std::unique_ptr<x::Scene> _activeScene;
+    x::Thread::ThreadPool _workers;
+    x::RenderCuller _culler {&_workers};
+    x::Math::OcclusionBuffer _occlusion;
+    // Culling runs on the update thread; the debug UI reads its results from the render thread
+    std::atomic<size_t> _visibleCount {0};
+    std::atomic<size_t> _testedCount {0};
+    std::atomic<size_t> _occludedCount {0};
+    std::atomic<size_t> _commandCount {0};
+    RenderQueue _renderQueue;
+    x::OpenGLBackend _renderBackend;
+    RenderGraph _renderGraph;
+    OpenGLGraphBackend _graphBackend;
     std::unique_ptr<RenderTarget> _renderTarget;
     std::unique_ptr<PostProcessQuad> _postProcessQuad;
     std::unique_ptr<Tonemapper> _tonemapper;
 };
 
 void SpaceGame::loadContent(x::GameState& state) {
+    // Compile while the model loads; the renderer and effects pick the programs up as they ask
+    auto& shaders = x::ShaderManager::instance();
+    shaders.compileAsync(PBR_VS_Source, PBR_FS_Source);
+    shaders.compileAsync(PBR_Instanced_VS_Source, PBR_FS_Source);
+    shaders.compileAsync(Quad_VS_Source, Quad_FS_Source);
+    shaders.compileAsync(Tonemapper_CS_Source);
+    shaders.compileAsync(TonemapFXAA_CS_Source);
+
     _activeScene = std::make_unique<x::Scene>("MainScene", state);
     auto root    = _activeScene->createEntity();
 
     // Load the shader ball model
     auto modelPath = getDataPath() / "ShaderBall.fbx";
-    if (!x::ModelHandle::tryLoad(modelPath.string(), _model)) { Panic("Failed to load model"); }
-
-    auto model1      = _activeScene->createEntity(root);
-    auto& transform1 = state.addComponent<x::TransformComponent>(model1);
-    auto& renderer1  = state.addComponent<x::RenderComponent>(model1);
-    transform1.setScale(glm::vec3(0.01f));
-    transform1.setPosition(glm::vec3(0, -1.25, -3));
-    renderer1.setModel(_model);
-    renderer1.getMaterial()->As<x::PBRMaterial>()->setAlbedo(glm::vec3(1.f, 0.5f, 0.0f));
-    renderer1.getMaterial()->As<x::PBRMaterial>()->setMetallic(0.5f);
-    renderer1.getMaterial()->As<x::PBRMaterial>()->setRoughness(0.3f);
-
-    auto model2      = _activeScene->createEntity(root);
-    auto& transform2 = state.addComponent<x::TransformComponent>(model2);
-    auto& renderer2  = state.addComponent<x::RenderComponent>(model2);
-    transform2.setScale(glm::vec3(0.008f));
-    transform2.setPosition(glm::vec3(-2, -1.25, -1));
-    renderer2.setModel(_model);
-
-    auto model3      = _activeScene->createEntity(root);
-    auto& transform3 = state.addComponent<x::TransformComponent>(model3);
-    auto& renderer3  = state.addComponent<x::RenderComponent>(model3);
-    transform3.setScale(glm::vec3(0.008f));
-    transform3.setPosition(glm::vec3(2, -1.25, -1));
-    renderer3.setModel(_model);
+    _model         = x::ModelManager::instance().getModel(modelPath.string());
+    if (!_model.valid()) { Panic("Failed to load model"); }
+
+    // Every shader ball shares the model and its material; only the placement differs
+    x::Prefab shaderBall;
+    const auto ball = shaderBall.addNode();
+    shaderBall.addTransform(ball);
+    auto& renderer = shaderBall.addRenderer(ball);
+    renderer.setModel(_model);
+    renderer.getMaterial()->As<x::PBRMaterial>()->setAlbedo(glm::vec3(1.f, 0.5f, 0.0f));
+    renderer.getMaterial()->As<x::PBRMaterial>()->setMetallic(0.5f);
+    renderer.getMaterial()->As<x::PBRMaterial>()->setRoughness(0.3f);
+
+    const x::Prefab::Instance balls[] = {
+      {glm::vec3(0, -1.25, -3), glm::vec3(0.f), glm::vec3(0.01f)},
+      {glm::vec3(-2, -1.25, -1), glm::vec3(0.f), glm::vec3(0.008f)},
+      {glm::vec3(2, -1.25, -1), glm::vec3(0.f), glm::vec3(0.008f)},
+    };
+    _activeScene->instantiate(shaderBall, balls, root);
 
     x::DirectionalLight sun;
     sun.setDirection(glm::vec3(-0.577, -0.577, -0.577));
@@ -89,17 +127,21 @@ void SpaceGame::loadContent(x::GameState& state) {
     sun.setIntensity(10.f);
     state.setSun(sun);
 
-    _renderTarget    = std::make_unique<RenderTarget>(1600, 900, true);
+    // Post processing targets come from the render graph's pool, see draw()
+    _renderTarget    = std::make_unique<RenderTarget>(kRenderWidth, kRenderHeight, true);
     _postProcessQuad = std::make_unique<PostProcessQuad>();
     _tonemapper      = std::make_unique<Tonemapper>();
-    _tonemapper->setTextureSize(1600, 900);
-    _tonemapper->setInputTexture(_renderTarget->getColorTexture());
     _tonemapper->setTonemapOperator(0);
+    _tonemapper->setFxaa(true);
 }
 
 void SpaceGame::unloadContent() {
+    _renderGraph.releasePool(_graphBackend);
     _renderTarget.reset();
     _postProcessQuad.reset();
+    _renderBackend.release();
+    _model.release();
+    x::ModelManager::instance().clear();
 }
 
 void SpaceGame::update(x::GameState& state) {
@@ -112,25 +154,82 @@ void SpaceGame::update(x::GameState& state) {
     }
 
     // update other engine systems like physics or AI
+
+    // Record this tick's draws so the render thread never walks the ECS
+    const auto& cameraState = state.getCameraState();
+    _culler.cull(state, cameraState.projection * cameraState.view, &_occlusion);
+    _culler.record(cameraState, state.getRenderCommands());
+    _visibleCount.store(_culler.getVisible().size(), std::memory_order_relaxed);
+    _testedCount.store(_culler.getTestedCount(), std::memory_order_relaxed);
+    _occludedCount.store(_culler.getOccludedCount(), std::memory_order_relaxed);
+    _commandCount.store(state.getRenderCommands().size(), std::memory_order_relaxed);
+    X_PROFILE_COUNTER("Visible", _visibleCount.load(std::memory_order_relaxed));
+    X_PROFILE_COUNTER("Draw Commands", _commandCount.load(std::memory_order_relaxed));
 }
 
 void SpaceGame::draw(const x::GameState& state) {
     const auto& cameraState = state.getCameraState();
     const auto& lightState  = state.getLightingState();
 
-    // Scene pass
-    _renderTarget->bind();
-    x::Context::clear();
-    const auto& renderables = state.getComponents<x::RenderComponent>();
-    for (const auto& [entityId, renderable] : renderables) {
-        auto* transform = state.getComponent<x::TransformComponent>(entityId);
-        if (transform) { renderable.draw(cameraState, lightState, *transform); }
-    }
-    _renderTarget->unbind();
-
-    // Post processing pass
-    _tonemapper->apply();
-    _postProcessQuad->draw(_tonemapper->getOutputTexture());
+    // The scene target persists, so it is imported; intermediate targets are transient and
+    // alias each other through the graph's pool
+    _renderGraph.reset();
+    const RenderTextureDesc hdrDesc {kRenderWidth, kRenderHeight, GL_RGBA16F};
+    const RenderTextureDesc ldrDesc {kRenderWidth, kRenderHeight, GL_RGBA8};
+    const auto sceneColor =
+      _renderGraph.importTexture("SceneColor", _renderTarget->getColorTexture(), hdrDesc);
+    const auto tonemapped = _renderGraph.createTexture("Tonemapped", ldrDesc);
+
+    _renderGraph.addPass(
+      "Scene",
+      [&](RenderGraph::Builder& builder) {
+          builder.write(sceneColor, RenderAccess::ColorAttachment);
+      },
+      [&](const RenderGraph&) {
+          GpuProfiler::Scope scope(*_gpuProfiler, "Scene");
+          _renderTarget->bind();
+          x::Context::clear();
+          // Commands were sorted when recorded, so the queue needs no sort()
+          _renderQueue.clear();
+          {
+              X_PROFILE_SCOPE("DecodeCommands");
+              x::ModelManager::instance().submit(state.getRenderCommands().getCommands(),
+                                                 _renderQueue);
+          }
+          _renderBackend.beginFrame(cameraState, lightState);
+          {
+              X_PROFILE_SCOPE("FlushQueue");
+              _renderQueue.flush(_renderBackend);
+          }
+          _renderTarget->unbind();
+      });
+
+    _renderGraph.addPass(
+      "Tonemap",
+      [&](RenderGraph::Builder& builder) {
+          builder.read(sceneColor, RenderAccess::ImageRead);
+          builder.write(tonemapped, RenderAccess::ImageWrite);
+      },
+      [&](const RenderGraph& graph) {
+          GpuProfiler::Scope scope(*_gpuProfiler, "Tonemap");
+          _tonemapper->apply(graph.getTexture(sceneColor),
+                             graph.getTexture(tonemapped),
+                             kRenderWidth,
+                             kRenderHeight);
+      });
+
+    _renderGraph.addPass(
+      "Present",
+      [&](RenderGraph::Builder& builder) {
+          builder.read(tonemapped, RenderAccess::Sampled);
+          builder.setSideEffect();
+      },
+      [&](const RenderGraph& graph) {
+          GpuProfiler::Scope scope(*_gpuProfiler, "Present");
+          _postProcessQuad->draw(graph.getTexture(tonemapped));
+      });
+
+    _renderGraph.execute(_graphBackend);
 }
 
 void SpaceGame::drawDebugUI(const x::GameState& state) {
@@ -178,6 +277,27 @@ void SpaceGame::drawDebugUI(const x::GameState& state) {
     ImGui::Text("%.2f ms (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
     ImGui::NextColumn();
 
+    ImGui::Text("Visible:");
+    ImGui::NextColumn();
+    ImGui::Text("%zu / %zu", _visibleCount.load(), _testedCount.load());
+    ImGui::NextColumn();
+
+    ImGui::Text("Occluded:");
+    ImGui::NextColumn();
+    ImGui::Text("%zu", _occludedCount.load());
+    ImGui::NextColumn();
+
+    ImGui::Text("Draw Commands:");
+    ImGui::NextColumn();
+    ImGui::Text("%zu", _commandCount.load());
+    ImGui::NextColumn();
+
+    const auto& glStats = x::Graphics::GLState::current().getLastFrameStats();
+    ImGui::Text("GL Binds:");
+    ImGui::NextColumn();
+    ImGui::Text("%u issued, %u elided", glStats.issued, glStats.elided);
+    ImGui::NextColumn();
+
     ImGui::Columns(1);
     ImGui::Separator();
 
@@ -223,7 +343,50 @@ void SpaceGame::drawDebugUI(const x::GameState& state) {
     // Restore the original plot color
     ImGui::GetStyle().Colors[ImGuiCol_PlotLines] = oldPlotColor;
 
+    const ImVec2 frameGraphPos = ImGui::GetWindowPos();
+    const f32 frameGraphWidth  = ImGui::GetWindowWidth();
     ImGui::End();
+
+    // Render stats sit to the right of the frame graph
+    using Counter     = x::Graphics::RenderStats::Counter;
+    const auto& stats = x::Graphics::RenderStats::current();
+    const auto last   = stats.getLastFrameStats();
+    ImGui::SetNextWindowPos(ImVec2(frameGraphPos.x + frameGraphWidth + 4, frameGraphPos.y));
+    ImGui::SetNextWindowBgAlpha(0.4f);
+    ImGui::Begin("Render Stats", nullptr, windowFlags);
+    ImGui::Text("Per frame, over the last %zu frames:", stats.getHistorySize());
+    ImGui::Separator();
+    ImGui::Columns(5, "renderStats");
+    for (const char* header : {"", "Last", "Avg", "P95", "P99"}) {
+        ImGui::Text("%s", header);
+        ImGui::NextColumn();
+    }
+    for (u32 i = 0; i < CAST<u32>(Counter::Count); i++) {
+        const auto counter = CAST<Counter>(i);
+        ImGui::Text("%s", x::Graphics::RenderStats::getName(counter));
+        ImGui::NextColumn();
+        ImGui::Text("%llu", CAST<unsigned long long>(x::Graphics::RenderStats::get(last, counter)));
+        ImGui::NextColumn();
+        ImGui::Text("%.1f", stats.getAverage(counter));
+        ImGui::NextColumn();
+        ImGui::Text("%llu", CAST<unsigned long long>(stats.getPercentile(counter, 95.0)));
+        ImGui::NextColumn();
+        ImGui::Text("%llu", CAST<unsigned long long>(stats.getPercentile(counter, 99.0)));
+        ImGui::NextColumn();
+    }
+    ImGui::Columns(1);
+    ImGui::Separator();
+    ImGui::Text("Triangles: %llu", CAST<unsigned long long>(last.indices / 3));
+    ImGui::End();
+
+    if (x::Graphics::DebugUI::drawGpuProfiler(*_gpuProfiler)) {
+        FileWriter::writeAllText("GpuTrace.json", _gpuProfiler->exportTrace());
+    }
+    // The flame view shows the last few frames; exports take everything still in the rings
+    auto& profiler = x::Profiler::instance();
+    if (x::Graphics::DebugUI::drawCpuProfiler(profiler.capture(kProfilerWindow))) {
+        FileWriter::writeAllText("CpuTrace.json", x::Profiler::exportTrace(profiler.capture()));
+    }
 }
 
 void SpaceGame::configurePipeline() {